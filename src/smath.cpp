@@ -4,6 +4,10 @@
  * File Created: February 06, 2023
  * Includes:     <math.h> ONLY WITH MSVC COMPILER
 */
+// NOTE(alicia): included from smath.hpp when SMATH_HEADER_ONLY is defined
+#if !defined(SMUSHY_SMATH_IMPL)
+#define SMUSHY_SMATH_IMPL
+
 #include "smath.hpp"
 
 #if defined(SM_COMPILER_CLANG)
@@ -11,16 +15,6 @@
     #pragma clang diagnostic ignored "-Wmissing-braces"
 #endif
 
-#if defined(SMUSHY_SIMD_ENABLED)
-
-    #if defined(SMUSHY_X86_64_PLATFORM)
-
-    #include <immintrin.h>
-
-    #endif // simd::x86
-
-#endif // simd
-
 #if defined(_MSC_VER)
     #include <math.h>
 #endif
@@ -102,6 +96,13 @@ inline f64 _log_( f64 x ) {
     return log( x );
 }
 
+inline f32 _expf_( f32 x ) {
+    return expf( x );
+}
+inline f64 _exp_( f64 x ) {
+    return exp( x );
+}
+
 inline f32 _modf_( f32 numerator, f32 denominator ) {
     return fmodf( numerator, denominator );
 }
@@ -183,6 +184,13 @@ inline f64 _log_( f64 x ) {
     return __builtin_log( x );
 }
 
+inline f32 _expf_( f32 x ) {
+    return __builtin_expf( x );
+}
+inline f64 _exp_( f64 x ) {
+    return __builtin_exp( x );
+}
+
 inline f32 _modf_( f32 numerator, f32 denominator ) {
     return __builtin_fmodf( numerator, denominator );
 }
@@ -217,588 +225,343 @@ inline f32 signed_angle_to_unsigned( f32 radians ) {
 
 } // namespace smath::internal
 
-namespace simd {
-
-#if defined(SMUSHY_SIMD_ENABLED)
-
-#if defined(SMUSHY_X86_64_PLATFORM)
-
-lane4f::lane4f() : simd( _mm_setzero_ps() ) {}
-lane4f::lane4f( f32 a, f32 b, f32 c, f32 d ) : simd( _mm_setr_ps( a, b, c, d ) ) {}
-lane4f::lane4f( f32 scalar ) : simd( _mm_set1_ps( scalar ) ) {}
-lane4f::lane4f( const f32* four_wide_array ) : simd( _mm_loadu_ps( four_wide_array ) ) {}
-f32& lane4f::operator[]( u32 index ) { return (&a)[index]; }
-f32  lane4f::operator[]( u32 index ) const { return simd[index]; }
-lane4f& lane4f::operator+=( const lane4f& rhs ) {
-    this->simd = _mm_add_ps( this->simd, rhs.simd );
-    return *this;
-}
-lane4f& lane4f::operator-=( const lane4f& rhs ) {
-    this->simd = _mm_sub_ps( this->simd, rhs.simd );
-    return *this;
-}
-lane4f& lane4f::operator*=( const lane4f& rhs ) {
-    this->simd = _mm_mul_ps( this->simd, rhs.simd );
-    return *this;
-}
-lane4f& lane4f::operator/=( const lane4f& rhs ) {
-    this->simd = _mm_div_ps( this->simd, rhs.simd );
-    return *this;
-}
-lane4f sqrt( lane4f x ) {
-    x.simd = _mm_sqrt_ps( x.simd );
-    return x;
-}
-void store( f32* four_wide_array, lane4f registers ) {
-    _mm_storeu_ps( four_wide_array, registers.simd );
-}
-
-lane8f::lane8f() : simd( _mm256_setzero_ps() ) {}
-lane8f::lane8f( f32 a, f32 b, f32 c, f32 d, f32 e, f32 f, f32 g, f32 h )
-: simd( _mm256_setr_ps( a, b, c, d, e, f, g, h ) ){}
-lane8f::lane8f( f32 scalar ) : simd( _mm256_set1_ps( scalar ) ) {}
-lane8f::lane8f( const f32* eight_wide_array ) : simd( _mm256_loadu_ps( eight_wide_array ) ) {}
-f32& lane8f::operator[]( u32 index ) { return (&a)[index]; }
-f32  lane8f::operator[]( u32 index ) const { return simd[index]; }
-lane8f& lane8f::operator+=( const lane8f& rhs ) {
-    this->simd = _mm256_add_ps( this->simd, rhs.simd );
-    return *this;
-}
-lane8f& lane8f::operator-=( const lane8f& rhs ) {
-    this->simd = _mm256_sub_ps( this->simd, rhs.simd );
-    return *this;
-}
-lane8f& lane8f::operator*=( const lane8f& rhs ) {
-    this->simd = _mm256_mul_ps( this->simd, rhs.simd );
-    return *this;
-}
-lane8f& lane8f::operator/=( const lane8f& rhs ) {
-    this->simd = _mm256_div_ps( this->simd, rhs.simd );
-    return *this;
-}
-lane8f sqrt( lane8f x ) {
-    x.simd = _mm256_sqrt_ps( x.simd );
-    return x;
-}
-void store( f32* eight_wide_array, lane8f registers ) {
-    _mm256_storeu_ps( eight_wide_array, registers.simd );
-}
-lane4f extract_high( lane8f a ) {
-    lane4f result;
-    result.simd = _mm256_extractf128_ps( a.simd, 1 );
-    return result;
-}
-lane4f extract_low( lane8f a ) {
-    lane4f result;
-    result.simd = _mm256_castps256_ps128( a.simd );
-    return result;
-}
-
-#endif // x86
-
-#else // simd
-
-lane4f::lane4f() : a(0.0f), b(0.0f), c(0.0f), d(0.0f) {}
-lane4f::lane4f( f32 a, f32 b, f32 c, f32 d ) : a(a), b(b), c(c), d(d) {}
-lane4f::lane4f( f32 scalar ) : a(scalar), b(scalar), c(scalar), d(scalar) {}
-lane4f::lane4f( const f32* four_wide_array )
-: a(four_wide_array[0]), b(four_wide_array[1]), c(four_wide_array[2]), d(four_wide_array[3]) {}
-f32& lane4f::operator[]( u32 index ) { return (&a)[index]; }
-f32  lane4f::operator[]( u32 index ) const { return (&a)[index]; }
-lane4f& lane4f::operator+=( const lane4f& rhs ) {
-    this->a += rhs.a;
-    this->b += rhs.b;
-    this->c += rhs.c;
-    this->d += rhs.d;
-    return *this;
-}
-lane4f& lane4f::operator-=( const lane4f& rhs ) {
-    this->a -= rhs.a;
-    this->b -= rhs.b;
-    this->c -= rhs.c;
-    this->d -= rhs.d;
-    return *this;
-}
-lane4f& lane4f::operator*=( const lane4f& rhs ) {
-    this->a *= rhs.a;
-    this->b *= rhs.b;
-    this->c *= rhs.c;
-    this->d *= rhs.d;
-    return *this;
-}
-lane4f& lane4f::operator/=( const lane4f& rhs ) {
-    this->a /= rhs.a;
-    this->b /= rhs.b;
-    this->c /= rhs.c;
-    this->d /= rhs.d;
-    return *this;
-}
-lane4f sqrt( lane4f x ) {
-    return {
-        internal::_sqrtf_( x.a ),
-        internal::_sqrtf_( x.b ),
-        internal::_sqrtf_( x.c ),
-        internal::_sqrtf_( x.d )
-    };
-}
-void store( f32* four_wide_array, lane4f registers ) {
-    four_wide_array[0] = registers[0];
-    four_wide_array[1] = registers[1];
-    four_wide_array[2] = registers[2];
-    four_wide_array[3] = registers[3];
-}
-
-lane8f::lane8f()
-: a(0.0f), b(0.0f), c(0.0f), d(0.0f),
-e(0.0f), f(0.0f), g(0.0f), h(0.0f) {}
-lane8f::lane8f( f32 a, f32 b, f32 c, f32 d, f32 e, f32 f, f32 g, f32 h )
-: a(a), b(b), c(c), d(d), e(e), f(f), g(g), h(h) {}
-lane8f::lane8f( f32 scalar )
-: a(scalar), b(scalar), c(scalar), d(scalar), e(scalar), f(scalar), g(scalar), h(scalar) {}
-lane8f::lane8f( const f32* eight_wide_array )
-: a(eight_wide_array[0]), b(eight_wide_array[1]), c(eight_wide_array[2]), d(eight_wide_array[3]),
-e(eight_wide_array[4]), f(eight_wide_array[5]), g(eight_wide_array[6]), h(eight_wide_array[7]) {}
-f32& lane8f::operator[]( u32 index ) { return (&a)[index]; }
-f32  lane8f::operator[]( u32 index ) const { return (&a)[index]; }
-lane8f& lane8f::operator+=( const lane8f& rhs ) {
-    this->a += rhs.a;
-    this->b += rhs.b;
-    this->c += rhs.c;
-    this->d += rhs.d;
-    this->e += rhs.e;
-    this->f += rhs.f;
-    this->g += rhs.g;
-    this->h += rhs.h;
-    return *this;
-}
-lane8f& lane8f::operator-=( const lane8f& rhs ) {
-    this->a -= rhs.a;
-    this->b -= rhs.b;
-    this->c -= rhs.c;
-    this->d -= rhs.d;
-    this->e -= rhs.e;
-    this->f -= rhs.f;
-    this->g -= rhs.g;
-    this->h -= rhs.h;
-    return *this;
-}
-lane8f& lane8f::operator*=( const lane8f& rhs ) {
-    this->a *= rhs.a;
-    this->b *= rhs.b;
-    this->c *= rhs.c;
-    this->d *= rhs.d;
-    this->e *= rhs.e;
-    this->f *= rhs.f;
-    this->g *= rhs.g;
-    this->h *= rhs.h;
-    return *this;
-}
-lane8f& lane8f::operator/=( const lane8f& rhs ) {
-    this->a /= rhs.a;
-    this->b /= rhs.b;
-    this->c /= rhs.c;
-    this->d /= rhs.d;
-    this->e /= rhs.e;
-    this->f /= rhs.f;
-    this->g /= rhs.g;
-    this->h /= rhs.h;
-    return *this;
-}
-lane8f sqrt( lane8f x ) {
-    return {
-        internal::_sqrtf_( x.a ),
-        internal::_sqrtf_( x.b ),
-        internal::_sqrtf_( x.c ),
-        internal::_sqrtf_( x.d ),
-        internal::_sqrtf_( x.e ),
-        internal::_sqrtf_( x.f ),
-        internal::_sqrtf_( x.g ),
-        internal::_sqrtf_( x.h ),
-    };
-}
-void store( f32* eight_wide_array, lane8f registers ) {
-    eight_wide_array[0] = registers[0];
-    eight_wide_array[1] = registers[1];
-    eight_wide_array[2] = registers[2];
-    eight_wide_array[3] = registers[3];
-    eight_wide_array[4] = registers[4];
-    eight_wide_array[5] = registers[5];
-    eight_wide_array[6] = registers[6];
-    eight_wide_array[7] = registers[7];
-}
-lane4f extract_high( lane8f a ) {
-    return { a.e, a.f, a.g, a.h };
-}
-lane4f extract_low( lane8f a ) {
-    return { a.a, a.b, a.c, a.d };
-}
-
-#endif // no simd
-
-lane4f operator+( const lane4f& lhs, const lane4f& rhs ) {
-    return lane4f( lhs ) += rhs;
-}
-lane4f operator-( const lane4f& lhs, const lane4f& rhs ) {
-    return lane4f( lhs ) -= rhs;
-}
-lane4f operator*( const lane4f& lhs, const lane4f& rhs ) {
-    return lane4f( lhs ) *= rhs;
-}
-lane4f operator/( const lane4f& lhs, const lane4f& rhs ) {
-    return lane4f( lhs ) /= rhs;
-}
-lane8f operator+( const lane8f& lhs, const lane8f& rhs ) {
-    return lane8f(lhs) += rhs;
-}
-lane8f operator-( const lane8f& lhs, const lane8f& rhs ) {
-    return lane8f(lhs) -= rhs;
-}
-lane8f operator*( const lane8f& lhs, const lane8f& rhs ) {
-    return lane8f(lhs) *= rhs;
-}
-lane8f operator/( const lane8f& lhs, const lane8f& rhs ) {
-    return lane8f(lhs) /= rhs;
-}
-
-} // namespace smath::simd
-
-i64 trunc64( f32 x ) {
+SMATH_CONSTEXPR i64 trunc64( f32 x ) {
     return (i64)x;
 }
-i64 trunc64( f64 x ) {
+SMATH_CONSTEXPR i64 trunc64( f64 x ) {
     return (i64)x;
 }
-i32 trunc32( f32 x ) {
+SMATH_CONSTEXPR i32 trunc32( f32 x ) {
     return (i32)x;
 }
-i32 trunc32( f64 x ) {
+SMATH_CONSTEXPR i32 trunc32( f64 x ) {
     return (i32)x;
 }
-i16 trunc16( f32 x ) {
+SMATH_CONSTEXPR i16 trunc16( f32 x ) {
     return (i16)x;
 }
-i16 trunc16( f64 x ) {
+SMATH_CONSTEXPR i16 trunc16( f64 x ) {
     return (i16)x;
 }
-i8 trunc8( f32 x ) {
+SMATH_CONSTEXPR i8 trunc8( f32 x ) {
     return (i8)x;
 }
-i8 trunc8( f64 x ) {
+SMATH_CONSTEXPR i8 trunc8( f64 x ) {
     return (i8)x;
 }
 
-i64 floor64( f64 x ) {
+SMATH_CONSTEXPR i64 floor64( f64 x ) {
     return x > 0.0 ? trunc64(x) : trunc64(x - 0.99999999);
 }
-i64 floor64( f32 x ) {
+SMATH_CONSTEXPR i64 floor64( f32 x ) {
     return x > 0.0f ? trunc64(x) : trunc64(x - 0.999999f);
 }
-i32 floor32( f64 x ) {
+SMATH_CONSTEXPR i32 floor32( f64 x ) {
     return x > 0.0 ? trunc32(x) : trunc32(x - 0.99999999);
 }
-i32 floor32( f32 x ) {
+SMATH_CONSTEXPR i32 floor32( f32 x ) {
     return x > 0.0f ? trunc32(x) : trunc32(x - 0.999999f);
 }
-i16 floor16( f64 x ) {
+SMATH_CONSTEXPR i16 floor16( f64 x ) {
     return x > 0.0 ? trunc16(x) : trunc16(x - 0.99999999);
 }
-i16 floor16( f32 x ) {
+SMATH_CONSTEXPR i16 floor16( f32 x ) {
     return x > 0.0f ? trunc16(x) : trunc16(x - 0.999999f);
 }
-i8 floor8( f64 x ) {
+SMATH_CONSTEXPR i8 floor8( f64 x ) {
     return x > 0.0 ? trunc8(x) : trunc8(x - 0.99999999);
 }
-i8 floor8( f32 x ) {
+SMATH_CONSTEXPR i8 floor8( f32 x ) {
     return x > 0.0f ? trunc8(x) : trunc8(x - 0.999999f);
 }
 
-i64 ceil64( f64 x ) {
+SMATH_CONSTEXPR i64 ceil64( f64 x ) {
     return x > 0.0 ? trunc64( x + 0.99999999 ) : trunc64(x);
 }
-i64 ceil64( f32 x ) {
+SMATH_CONSTEXPR i64 ceil64( f32 x ) {
     return x > 0.0f ? trunc64( x + 0.999999f ) : trunc64(x);
 }
-i32 ceil32( f64 x ) {
+SMATH_CONSTEXPR i32 ceil32( f64 x ) {
     return x > 0.0 ? trunc32( x + 0.99999999 ) : trunc32(x);
 }
-i32 ceil32( f32 x ) {
+SMATH_CONSTEXPR i32 ceil32( f32 x ) {
     return x > 0.0f ? trunc32( x + 0.999999f ) : trunc32(x);
 }
-i16 ceil16( f64 x ) {
+SMATH_CONSTEXPR i16 ceil16( f64 x ) {
     return x > 0.0 ? trunc16( x + 0.99999999 ) : trunc16(x);
 }
-i16 ceil16( f32 x ) {
+SMATH_CONSTEXPR i16 ceil16( f32 x ) {
     return x > 0.0f ? trunc16( x + 0.999999f ) : trunc16(x);
 }
-i8 ceil8( f64 x ) {
+SMATH_CONSTEXPR i8 ceil8( f64 x ) {
     return x > 0.0 ? trunc8( x + 0.99999999 ) : trunc8(x);
 }
-i8 ceil8( f32 x ) {
+SMATH_CONSTEXPR i8 ceil8( f32 x ) {
     return x > 0.0f ? trunc8( x + 0.999999f ) : trunc8(x);
 }
 
-i64 round64( f64 x ) {
+SMATH_CONSTEXPR i64 round64( f64 x ) {
     return x > 0.0 ? trunc64( x + 0.5 ) : trunc64( x - 0.5 );
 }
-i64 round64( f32 x ) {
+SMATH_CONSTEXPR i64 round64( f32 x ) {
     return x > 0.0f ? trunc64( x + 0.5f ) : trunc64( x - 0.5f );
 }
-i32 round32( f64 x ) {
+SMATH_CONSTEXPR i32 round32( f64 x ) {
     return x > 0.0 ? trunc32( x + 0.5 ) : trunc32( x - 0.5 );
 }
-i32 round32( f32 x ) {
+SMATH_CONSTEXPR i32 round32( f32 x ) {
     return x > 0.0f ? trunc32( x + 0.5f ) : trunc32( x - 0.5f );
 }
-i16 round16( f64 x ) {
+SMATH_CONSTEXPR i16 round16( f64 x ) {
     return x > 0.0 ? trunc16( x + 0.5 ) : trunc16( x - 0.5 );
 }
-i16 round16( f32 x ) {
+SMATH_CONSTEXPR i16 round16( f32 x ) {
     return x > 0.0f ? trunc16( x + 0.5f ) : trunc16( x - 0.5f );
 }
-i8 round8( f64 x ) {
+SMATH_CONSTEXPR i8 round8( f64 x ) {
     return x > 0.0 ? trunc8( x + 0.5 ) : trunc8( x - 0.5 );
 }
-i8 round8( f32 x ) {
+SMATH_CONSTEXPR i8 round8( f32 x ) {
     return x > 0.0f ? trunc8( x + 0.5f ) : trunc8( x - 0.5f );
 }
 
-i8 sign( i8 x ) {
+SMATH_CONSTEXPR i8 sign( i8 x ) {
     return ( x > 0 ) - ( x < 0 );
 }
-i16 sign( i16 x ) {
+SMATH_CONSTEXPR i16 sign( i16 x ) {
     return ( x > 0 ) - ( x < 0 );
 }
-i32 sign( i32 x ) {
+SMATH_CONSTEXPR i32 sign( i32 x ) {
     return ( x > 0 ) - ( x < 0 );
 }
-i64 sign( i64 x ) {
+SMATH_CONSTEXPR i64 sign( i64 x ) {
     return ( x > 0 ) - ( x < 0 );
 }
-f32 sign( f32 x ) {
+SMATH_CONSTEXPR f32 sign( f32 x ) {
     return ( x > 0.0f ) - ( x < 0.0f );
 }
-f64 sign( f64 x ) {
+SMATH_CONSTEXPR f64 sign( f64 x ) {
     return ( x > 0.0 ) - ( x < 0.0 );
 }
 
-i8 absolute( i8 x ) {
+SMATH_CONSTEXPR i8 absolute( i8 x ) {
     return x * sign( x );
 }
-i16 absolute( i16 x ) {
+SMATH_CONSTEXPR i16 absolute( i16 x ) {
     return x * sign( x );
 }
-i32 absolute( i32 x ) {
+SMATH_CONSTEXPR i32 absolute( i32 x ) {
     return x * sign( x );
 }
-i64 absolute( i64 x ) {
+SMATH_CONSTEXPR i64 absolute( i64 x ) {
     return x * sign( x );
 }
-f32 absolute( f32 x ) {
+SMATH_CONSTEXPR f32 absolute( f32 x ) {
     return x * sign( x );
 }
-f64 absolute( f64 x ) {
+SMATH_CONSTEXPR f64 absolute( f64 x ) {
     return x * sign( x );
 }
 
-i8 clamp( i8 value, i8 min, i8 max ) {
+SMATH_CONSTEXPR i8 clamp( i8 value, i8 min, i8 max ) {
     const i8 t = value < min ? min : value;
     return t > max ? max : t;
 }
-i16 clamp( i16 value, i16 min, i16 max ) {
+SMATH_CONSTEXPR i16 clamp( i16 value, i16 min, i16 max ) {
     const i16 t = value < min ? min : value;
     return t > max ? max : t;
 }
-i32 clamp( i32 value, i32 min, i32 max ) {
+SMATH_CONSTEXPR i32 clamp( i32 value, i32 min, i32 max ) {
     const i32 t = value < min ? min : value;
     return t > max ? max : t;
 }
-i64 clamp( i64 value, i64 min, i64 max ) {
+SMATH_CONSTEXPR i64 clamp( i64 value, i64 min, i64 max ) {
     const i64 t = value < min ? min : value;
     return t > max ? max : t;
 }
-u8 clamp( u8 value, u8 min, u8 max ) {
+SMATH_CONSTEXPR u8 clamp( u8 value, u8 min, u8 max ) {
     const u8 t = value < min ? min : value;
     return t > max ? max : t;
 }
-u16 clamp( u16 value, u16 min, u16 max ) {
+SMATH_CONSTEXPR u16 clamp( u16 value, u16 min, u16 max ) {
     const u16 t = value < min ? min : value;
     return t > max ? max : t;
 }
-u32 clamp( u32 value, u32 min, u32 max ) {
+SMATH_CONSTEXPR u32 clamp( u32 value, u32 min, u32 max ) {
     const u32 t = value < min ? min : value;
     return t > max ? max : t;
 }
-u64 clamp( u64 value, u64 min, u64 max ) {
+SMATH_CONSTEXPR u64 clamp( u64 value, u64 min, u64 max ) {
     const u64 t = value < min ? min : value;
     return t > max ? max : t;
 }
-f32 clamp( f32 value, f32 min, f32 max ) {
+SMATH_CONSTEXPR f32 clamp( f32 value, f32 min, f32 max ) {
     const f32 t = value < min ? min : value;
     return t > max ? max : t;
 }
-f64 clamp( f64 value, f64 min, f64 max ) {
+SMATH_CONSTEXPR f64 clamp( f64 value, f64 min, f64 max ) {
     const f64 t = value < min ? min : value;
     return t > max ? max : t;
 }
-f32 clamp01( f32 value ) {
+SMATH_CONSTEXPR f32 clamp01( f32 value ) {
     return clamp( value, 0.0f, 1.0f );
 }
-f64 clamp01( f64 value ) {
+SMATH_CONSTEXPR f64 clamp01( f64 value ) {
     return clamp( value, 0.0, 1.0 );
 }
 
-i8 min( i8 a, i8 b) {
+SMATH_CONSTEXPR i8 min( i8 a, i8 b) {
     return a < b ? a : b;
 }
-i16 min( i16 a, i16 b) {
+SMATH_CONSTEXPR i16 min( i16 a, i16 b) {
     return a < b ? a : b;
 }
-i32 min( i32 a, i32 b) {
+SMATH_CONSTEXPR i32 min( i32 a, i32 b) {
     return a < b ? a : b;
 }
-i64 min( i64 a, i64 b) {
+SMATH_CONSTEXPR i64 min( i64 a, i64 b) {
     return a < b ? a : b;
 }
-u8 min( u8 a, u8 b) {
+SMATH_CONSTEXPR u8 min( u8 a, u8 b) {
     return a < b ? a : b;
 }
-u16 min( u16 a, u16 b) {
+SMATH_CONSTEXPR u16 min( u16 a, u16 b) {
     return a < b ? a : b;
 }
-u32 min( u32 a, u32 b) {
+SMATH_CONSTEXPR u32 min( u32 a, u32 b) {
     return a < b ? a : b;
 }
-u64 min( u64 a, u64 b) {
+SMATH_CONSTEXPR u64 min( u64 a, u64 b) {
     return a < b ? a : b;
 }
-f32 min( f32 a, f32 b) {
+SMATH_CONSTEXPR f32 min( f32 a, f32 b) {
     return a < b ? a : b;
 }
-f64 min( f64 a, f64 b) {
+SMATH_CONSTEXPR f64 min( f64 a, f64 b) {
     return a < b ? a : b;
 }
 
-i8 max( i8 a, i8 b) {
+SMATH_CONSTEXPR i8 max( i8 a, i8 b) {
     return a < b ? b : a;
 }
-i16 max( i16 a, i16 b) {
+SMATH_CONSTEXPR i16 max( i16 a, i16 b) {
     return a < b ? b : a;
 }
-i32 max( i32 a, i32 b) {
+SMATH_CONSTEXPR i32 max( i32 a, i32 b) {
     return a < b ? b : a;
 }
-i64 max( i64 a, i64 b) {
+SMATH_CONSTEXPR i64 max( i64 a, i64 b) {
     return a < b ? b : a;
 }
-u8 max( u8 a, u8 b) {
+SMATH_CONSTEXPR u8 max( u8 a, u8 b) {
     return a < b ? b : a;
 }
-u16 max( u16 a, u16 b) {
+SMATH_CONSTEXPR u16 max( u16 a, u16 b) {
     return a < b ? b : a;
 }
-u32 max( u32 a, u32 b) {
+SMATH_CONSTEXPR u32 max( u32 a, u32 b) {
     return a < b ? b : a;
 }
-u64 max( u64 a, u64 b) {
+SMATH_CONSTEXPR u64 max( u64 a, u64 b) {
     return a < b ? b : a;
 }
-f32 max( f32 a, f32 b) {
+SMATH_CONSTEXPR f32 max( f32 a, f32 b) {
     return a < b ? b : a;
 }
-f64 max( f64 a, f64 b) {
+SMATH_CONSTEXPR f64 max( f64 a, f64 b) {
     return a < b ? b : a;
 }
 
-f32 normalize_range( i8 x ) {
+SMATH_INLINE f32 normalize_range( i8 x ) {
     return (f32)x / (x > 0 ? (f32)I8::MAX : -((f32)I8::MIN));
 }
-f32 normalize_range( i16 x ) {
+SMATH_INLINE f32 normalize_range( i16 x ) {
     return (f32)x / (x > 0 ? (f32)I16::MAX : -((f32)I16::MIN));
 }
-f32 normalize_range( i32 x ) {
+SMATH_INLINE f32 normalize_range( i32 x ) {
     return (f32)x / (x > 0 ? (f32)I32::MAX : -((f32)I32::MIN));
 }
-f32 normalize_range( i64 x ) {
+SMATH_INLINE f32 normalize_range( i64 x ) {
     return (f32)x / (x > 0 ? (f32)I64::MAX : -((f32)I64::MIN));
 }
-f32 normalize_range( u8 x ) {
+SMATH_INLINE f32 normalize_range( u8 x ) {
     return (f32)x / (f32)U8::MAX;
 }
-f32 normalize_range( u16 x ) {
+SMATH_INLINE f32 normalize_range( u16 x ) {
     return (f32)x / (f32)U16::MAX;
 }
-f32 normalize_range( u32 x ) {
+SMATH_INLINE f32 normalize_range( u32 x ) {
     return (f32)x / (f32)U32::MAX;
 }
-f32 normalize_range( u64 x ) {
+SMATH_INLINE f32 normalize_range( u64 x ) {
     return (f32)x / (f32)U64::MAX;
 }
-f64 normalize_range64( i8 x ) {
+SMATH_INLINE f64 normalize_range64( i8 x ) {
     return (f64)x / (x > 0 ? (f64)I8::MAX : -((f64)I8::MIN));
 }
-f64 normalize_range64( i16 x ) {
+SMATH_INLINE f64 normalize_range64( i16 x ) {
     return (f64)x / (x > 0 ? (f64)I16::MAX : -((f64)I16::MIN));
 }
-f64 normalize_range64( i32 x ) {
+SMATH_INLINE f64 normalize_range64( i32 x ) {
     return (f64)x / (x > 0 ? (f64)I32::MAX : -((f64)I32::MIN));
 }
-f64 normalize_range64( i64 x ) {
+SMATH_INLINE f64 normalize_range64( i64 x ) {
     return (f64)x / (x > 0 ? (f64)I64::MAX : -((f64)I64::MIN));
 }
-f64 normalize_range64( u8 x ) {
+SMATH_INLINE f64 normalize_range64( u8 x ) {
     return (f64)x / (f64)U8::MAX;
 }
-f64 normalize_range64( u16 x ) {
+SMATH_INLINE f64 normalize_range64( u16 x ) {
     return (f64)x / (f64)U16::MAX;
 }
-f64 normalize_range64( u32 x ) {
+SMATH_INLINE f64 normalize_range64( u32 x ) {
     return (f64)x / (f64)U32::MAX;
 }
-f64 normalize_range64( u64 x ) {
+SMATH_INLINE f64 normalize_range64( u64 x ) {
     return (f64)x / (f64)U64::MAX;
 }
 
-f64 sqrt( f64 x ) {
+SMATH_INLINE f64 sqrt( f64 x ) {
     return internal::_sqrt_(x);
 }
-f32 sqrt( f32 x ) {
+SMATH_INLINE f32 sqrt( f32 x ) {
     return internal::_sqrtf_(x);
 }
 
-f32 powi( f32 base, i32 exponent ) {
+SMATH_INLINE f32 powi( f32 base, i32 exponent ) {
     return internal::_powif_( base, exponent );
 }
-f64 powi( f64 base, i32 exponent ) {
+SMATH_INLINE f64 powi( f64 base, i32 exponent ) {
     return internal::_powi_( base, exponent );
 }
-f32 pow( f32 base, f32 exponent ) {
+SMATH_INLINE f32 pow( f32 base, f32 exponent ) {
     return internal::_powf_( base, exponent );
 }
-f64 pow( f64 base, f64 exponent ) {
+SMATH_INLINE f64 pow( f64 base, f64 exponent ) {
     return internal::_pow_( base, exponent );
 }
 
-f32 mod( f32 lhs, f32 rhs ) {
+SMATH_INLINE f32 mod( f32 lhs, f32 rhs ) {
     return internal::_modf_( lhs, rhs );
 }
-f64 mod( f64 lhs, f64 rhs ) {
+SMATH_INLINE f64 mod( f64 lhs, f64 rhs ) {
     return internal::_mod_( lhs, rhs );
 }
 
-f32 sin( f32 x ) {
+SMATH_INLINE f32 sin( f32 x ) {
     return internal::_sinf_( x );
 }
-f64 sin( f64 x ) {
+SMATH_INLINE f64 sin( f64 x ) {
     return internal::_sin_( x );
 }
-f32 asin( f32 x ) {
+SMATH_INLINE f32 asin( f32 x ) {
     return internal::_asinf_( x );
 }
-f64 asin( f64 x ) {
+SMATH_INLINE f64 asin( f64 x ) {
     return internal::_asin_( x );
 }
 
-f32 asin_real( f32 x ) {
+SMATH_INLINE f32 asin_real( f32 x ) {
     if( absolute( x ) >= 1.0f ) {
         const f32 PI_2 = ( F32::PI / 2.0f );
         return PI_2 * sign( x );
@@ -806,7 +569,7 @@ f32 asin_real( f32 x ) {
         return asin( x );
     }
 }
-f64 asin_real( f64 x ) {
+SMATH_INLINE f64 asin_real( f64 x ) {
     if( absolute( x ) >= 1.0 ) {
         const f64 PI_2 = ( F64::PI / 2.0 );
         return PI_2 * sign( x );
@@ -815,108 +578,108 @@ f64 asin_real( f64 x ) {
     }
 }
 
-f32 cos( f32 x ) {
+SMATH_INLINE f32 cos( f32 x ) {
     return internal::_cosf_( x );
 }
-f64 cos( f64 x ) {
+SMATH_INLINE f64 cos( f64 x ) {
     return internal::_cos_( x );
 }
-f32 acos( f32 x ) {
+SMATH_INLINE f32 acos( f32 x ) {
     return internal::_acosf_( x );
 }
-f64 acos( f64 x ) {
+SMATH_INLINE f64 acos( f64 x ) {
     return internal::_acos_( x );
 }
-f32 tan( f32 x ) {
+SMATH_INLINE f32 tan( f32 x ) {
     return internal::_tanf_( x );
 }
-f64 tan( f64 x ) {
+SMATH_INLINE f64 tan( f64 x ) {
     return internal::_tan_( x );
 }
-f32 atan( f32 x ) {
+SMATH_INLINE f32 atan( f32 x ) {
     return internal::_atanf_( x );
 }
-f64 atan( f64 x ) {
+SMATH_INLINE f64 atan( f64 x ) {
     return internal::_atan_( x );
 }
 
-f32 atan2( f32 y, f32 x ) {
+SMATH_INLINE f32 atan2( f32 y, f32 x ) {
     return internal::_atan2f_( y, x );
 }
-f64 atan2( f64 y, f64 x ) {
+SMATH_INLINE f64 atan2( f64 y, f64 x ) {
     return internal::_atan2_( y, x );
 }
 
-constexpr f32 to_rad( f32 theta ) {
+SMATH_CONSTEXPR f32 to_rad( f32 theta ) {
     return theta * ( F32::PI / 180.0f );
 }
-constexpr f64 to_rad( f64 theta ) {
+SMATH_CONSTEXPR f64 to_rad( f64 theta ) {
     return theta * ( F64::PI / 180.0 );
 }
-constexpr f32 to_deg( f32 theta ) {
+SMATH_CONSTEXPR f32 to_deg( f32 theta ) {
     return theta * ( 180.0f / F32::PI );
 }
-constexpr f64 to_deg( f64 theta ) {
+SMATH_CONSTEXPR f64 to_deg( f64 theta ) {
     return theta * ( 180.0 / F64::PI );
 }
 
-f32 log( f32 x ) {
+SMATH_INLINE f32 log( f32 x ) {
     return internal::_logf_( x );
 }
-f64 log( f64 x ) {
+SMATH_INLINE f64 log( f64 x ) {
     return internal::_log_( x );
 }
 
-f32 lerp( f32 a, f32 b, f32 t ) {
+SMATH_CONSTEXPR f32 lerp( f32 a, f32 b, f32 t ) {
     return ( 1.0f - t ) * a + b * t;
 }
-f64 lerp( f64 a, f64 b, f64 t ) {
+SMATH_CONSTEXPR f64 lerp( f64 a, f64 b, f64 t ) {
     return ( 1.0 - t ) * a + b * t;
 }
-f32 clamped_lerp( f32 a, f32 b, f32 t ) {
+SMATH_CONSTEXPR f32 clamped_lerp( f32 a, f32 b, f32 t ) {
     return lerp( a, b, clamp01(t) );
 }
-f64 clamped_lerp( f64 a, f64 b, f64 t ) {
+SMATH_CONSTEXPR f64 clamped_lerp( f64 a, f64 b, f64 t ) {
     return lerp( a, b, clamp01(t) );
 }
-f32 inverse_lerp( f32 a, f32 b, f32 v ) {
+SMATH_CONSTEXPR f32 inverse_lerp( f32 a, f32 b, f32 v ) {
     return ( v - a ) / ( b - a );
 }
-f64 inverse_lerp( f64 a, f64 b, f64 v ) {
+SMATH_CONSTEXPR f64 inverse_lerp( f64 a, f64 b, f64 v ) {
     return ( v - a ) / ( b - a );
 }
 
-f32 remap( f32 imin, f32 imax, f32 omin, f32 omax, f32 v ) {
+SMATH_CONSTEXPR f32 remap( f32 imin, f32 imax, f32 omin, f32 omax, f32 v ) {
     const f32 t = inverse_lerp( imin, imax, v );
     return lerp( omin, omax, t );
 }
-f64 remap( f64 imin, f64 imax, f64 omin, f64 omax, f64 v ) {
+SMATH_CONSTEXPR f64 remap( f64 imin, f64 imax, f64 omin, f64 omax, f64 v ) {
     const f64 t = inverse_lerp( imin, imax, v );
     return lerp( omin, omax, t );
 }
 
-f32 smooth_step( f32 a, f32 b, f32 t ) {
+SMATH_CONSTEXPR f32 smooth_step( f32 a, f32 b, f32 t ) {
     return ( b - a ) * ( 3.0f - t * 2.0f ) * t * t + a;
 }
-f64 smooth_step( f64 a, f64 b, f64 t ) {
+SMATH_CONSTEXPR f64 smooth_step( f64 a, f64 b, f64 t ) {
     return ( b - a ) * ( 3.0 - t * 2.0 ) * t * t + a;
 }
-f32 smooth_step_clamped( f32 a, f32 b, f32 t ) {
+SMATH_CONSTEXPR f32 smooth_step_clamped( f32 a, f32 b, f32 t ) {
     return smooth_step( a, b, clamp01(t) );
 }
-f64 smooth_step_clamped( f64 a, f64 b, f64 t ) {
+SMATH_CONSTEXPR f64 smooth_step_clamped( f64 a, f64 b, f64 t ) {
     return smooth_step( a, b, clamp01(t) );
 }
-f32 smoother_step( f32 a, f32 b, f32 t ) {
+SMATH_CONSTEXPR f32 smoother_step( f32 a, f32 b, f32 t ) {
     return ( b - a ) * ( ( t * ( t * 6.0f - 15.0f ) + 10.0f ) * t * t * t ) + a;
 }
-f64 smoother_step( f64 a, f64 b, f64 t ) {
+SMATH_CONSTEXPR f64 smoother_step( f64 a, f64 b, f64 t ) {
     return ( b - a ) * ( ( t * ( t * 6.0 - 15.0 ) + 10.0 ) * t * t * t ) + a;
 }
-f32 smoother_step_clamped( f32 a, f32 b, f32 t ) {
+SMATH_CONSTEXPR f32 smoother_step_clamped( f32 a, f32 b, f32 t ) {
     return smoother_step( a, b, clamp01(t) );
 }
-f64 smoother_step_clamped( f64 a, f64 b, f64 t ) {
+SMATH_CONSTEXPR f64 smoother_step_clamped( f64 a, f64 b, f64 t ) {
     return smoother_step( a, b, clamp01(t) );
 }
 
@@ -924,134 +687,134 @@ f64 smoother_step_clamped( f64 a, f64 b, f64 t ) {
 
 // NOTE(alicia): vec2
 
-vec2 vec2::create( f32 x, f32 y ) {
+SMATH_CONSTEXPR vec2 vec2::create( f32 x, f32 y ) {
     return { x, y };
 }
-vec2 vec2::create( f32 scalar ) {
+SMATH_CONSTEXPR vec2 vec2::create( f32 scalar ) {
     return { scalar, scalar };
 }
-vec2 vec2::create( const vec3& v ) {
+SMATH_INLINE vec2 vec2::create( const vec3& v ) {
     return { v.x, v.y };
 }
-vec2 vec2::create( const vec4& v ) {
+SMATH_INLINE vec2 vec2::create( const vec4& v ) {
     return { v.x, v.y };
 }
-vec2 vec2::create( const ivec2& v ) {
+SMATH_INLINE vec2 vec2::create( const ivec2& v ) {
     return { (f32)v.x, (f32)v.y };
 }
-vec2 vec2::create( const bvec2& v ) {
+SMATH_INLINE vec2 vec2::create( const bvec2& v ) {
     return { (f32)((bool)v.x), (f32)((bool)v.y) };
 }
-vec2 operator+( const vec2& lhs, const vec2& rhs ) {
+SMATH_CONSTEXPR vec2 operator+( const vec2& lhs, const vec2& rhs ) {
     return vec2(lhs) += rhs;
 }
-vec2 operator-( const vec2& lhs, const vec2& rhs ) {
+SMATH_CONSTEXPR vec2 operator-( const vec2& lhs, const vec2& rhs ) {
     return vec2(lhs) -= rhs;
 }
-vec2 operator*( const vec2& lhs, f32 rhs ) {
+SMATH_CONSTEXPR vec2 operator*( const vec2& lhs, f32 rhs ) {
     return vec2(lhs) *= rhs;
 }
-vec2 operator*( f32 lhs, const vec2& rhs ) {
+SMATH_CONSTEXPR vec2 operator*( f32 lhs, const vec2& rhs ) {
     return vec2(rhs) *= lhs;
 }
-vec2 operator/( const vec2& lhs, f32 rhs ) {
+SMATH_CONSTEXPR vec2 operator/( const vec2& lhs, f32 rhs ) {
     return vec2(lhs) /= rhs;
 }
-f32* vec2::ptr() { return &x; }
-const f32* vec2::ptr() const { return &x; }
-f32& vec2::operator[]( u32 index ) {
+SMATH_INLINE f32* vec2::ptr() { return &x; }
+SMATH_INLINE const f32* vec2::ptr() const { return &x; }
+SMATH_INLINE f32& vec2::operator[]( u32 index ) {
     return ptr()[index];
 }
-f32 vec2::operator[]( u32 index ) const {
+SMATH_INLINE f32 vec2::operator[]( u32 index ) const {
     return ptr()[index];
 }
-vec2& vec2::operator-() { return *this *= -1.0f; }
-bool32 vec2::operator==( const vec2& rhs ) const { return cmp( *this, rhs ); }
-bool32 vec2::operator!=( const vec2& rhs ) const { return !(*this == rhs); }
-vec2& vec2::operator+=( const vec2& rhs ) {
+SMATH_INLINE vec2& vec2::operator-() { return *this *= -1.0f; }
+SMATH_INLINE bool32 vec2::operator==( const vec2& rhs ) const { return cmp( *this, rhs ); }
+SMATH_INLINE bool32 vec2::operator!=( const vec2& rhs ) const { return !(*this == rhs); }
+SMATH_CONSTEXPR vec2& vec2::operator+=( const vec2& rhs ) {
     this->x += rhs.x;
     this->y += rhs.y;
     return *this;
 }
-vec2& vec2::operator-=( const vec2& rhs ) {
+SMATH_CONSTEXPR vec2& vec2::operator-=( const vec2& rhs ) {
     this->x -= rhs.x;
     this->y -= rhs.y;
     return *this;
 }
-vec2& vec2::operator*=( f32 rhs ) {
+SMATH_CONSTEXPR vec2& vec2::operator*=( f32 rhs ) {
     this->x *= rhs;
     this->y *= rhs;
     return *this;
 }
-vec2& vec2::operator/=( f32 rhs ) {
+SMATH_CONSTEXPR vec2& vec2::operator/=( f32 rhs ) {
     this->x /= rhs;
     this->y /= rhs;
     return *this;
 }
-void swap( vec2& v ) {
+SMATH_INLINE void swap( vec2& v ) {
     f32 tmp = v.x;
     v.x = v.y;
     v.y = tmp;
 }
-f32 horizontal_add( const vec2& v ) {
+SMATH_CONSTEXPR f32 horizontal_add( const vec2& v ) {
     return v.x + v.y;
 }
-f32 horizontal_mul( const vec2& v ) {
+SMATH_INLINE f32 horizontal_mul( const vec2& v ) {
     return v.x * v.y;
 }
-vec2 hadamard( const vec2& lhs, const vec2& rhs ) {
+SMATH_CONSTEXPR vec2 hadamard( const vec2& lhs, const vec2& rhs ) {
     return {
         lhs.x * rhs.x,
         lhs.y * rhs.y
     };
 }
-f32 sqr_mag( const vec2& v ) {
+SMATH_INLINE f32 sqr_mag( const vec2& v ) {
     vec2 result = hadamard( v, v );
     return horizontal_add( result );
 }
-f32 mag( const vec2& v ) {
+SMATH_INLINE f32 mag( const vec2& v ) {
     return sqrt( sqr_mag( v ) );
 }
-vec2 normalize( const vec2& v ) {
+SMATH_INLINE vec2 normalize( const vec2& v ) {
     f32 m = mag( v );
     return m < 0.0001f ? vec2::zero() : v / m;
 }
-f32 dot( const vec2& lhs, const vec2& rhs ) {
+SMATH_CONSTEXPR f32 dot( const vec2& lhs, const vec2& rhs ) {
     vec2 result = hadamard( lhs, rhs );
     return horizontal_add(result);
 }
-f32 angle( const vec2& a, const vec2& b ) {
+SMATH_INLINE f32 angle( const vec2& a, const vec2& b ) {
     return acos( dot( a, b ) );
 }
-f32 unsigned_angle( const vec2& a, const vec2& b ) {
+SMATH_INLINE f32 unsigned_angle( const vec2& a, const vec2& b ) {
     return internal::signed_angle_to_unsigned( angle( a, b ) );
 }
-vec2 lerp( const vec2& a, const vec2& b, f32 t ) {
+SMATH_CONSTEXPR vec2 lerp( const vec2& a, const vec2& b, f32 t ) {
     return ( 1.0f - t ) * a + b * t;
 }
-vec2 clamped_lerp( const vec2& a, const vec2& b, f32 t ) {
+SMATH_INLINE vec2 clamped_lerp( const vec2& a, const vec2& b, f32 t ) {
     return lerp( a, b, clamp01(t) );
 }
-vec2 smooth_step( const vec2& a, const vec2& b, f32 t ) {
+SMATH_INLINE vec2 smooth_step( const vec2& a, const vec2& b, f32 t ) {
     return ( b - a ) * ( 3.0f - t * 2.0f ) * t * t + a;
 }
-vec2 smooth_step_clamped( const vec2& a, const vec2& b, f32 t ) {
+SMATH_INLINE vec2 smooth_step_clamped( const vec2& a, const vec2& b, f32 t ) {
     return smooth_step( a, b, clamp01(t) );
 }
-vec2 smoother_step( const vec2& a, const vec2& b, f32 t ) {
+SMATH_INLINE vec2 smoother_step( const vec2& a, const vec2& b, f32 t ) {
     return ( b - a ) * ( ( t * ( t * 6.0f - 15.0f ) + 10.0f ) * t * t * t ) + a;
 }
-vec2 smoother_step_clamped( const vec2& a, const vec2& b, f32 t ) {
+SMATH_INLINE vec2 smoother_step_clamped( const vec2& a, const vec2& b, f32 t ) {
     return smoother_step( a, b, clamp01(t) );
 }
-vec2 rotate( const vec2& v, f32 theta ) {
+SMATH_INLINE vec2 rotate( const vec2& v, f32 theta ) {
     f32 theta_sin = sin( theta );
     f32 theta_cos = cos( theta );
     vec2 a = { theta_cos, theta_sin };
     vec2 b = { -theta_sin, theta_cos };
     return (v.x * a) + (v.y * b);
 }
-vec2 clamp( const vec2& v, f32 max ) {
+SMATH_INLINE vec2 clamp( const vec2& v, f32 max ) {
     f32 maximum = absolute(max);
     f32 magnitude = mag(v);
     if( magnitude > maximum ) {
@@ -1062,256 +825,256 @@ vec2 clamp( const vec2& v, f32 max ) {
         return v;
     }
 }
-ivec2 trunc32( const vec2& v ) {
+SMATH_INLINE ivec2 trunc32( const vec2& v ) {
     return ivec2::create( v );
 }
-ivec2 floor32( const vec2& v ) {
+SMATH_INLINE ivec2 floor32( const vec2& v ) {
     return { floor32(v.x), floor32(v.y) };
 }
-ivec2 ceil32( const vec2& v ) {
+SMATH_INLINE ivec2 ceil32( const vec2& v ) {
     return { ceil32(v.x), ceil32(v.y) };
 }
-ivec2 round32( const vec2& v ) {
+SMATH_INLINE ivec2 round32( const vec2& v ) {
     return { round32(v.x), round32(v.y) };
 }
-bool32 cmp( const vec2& a, const vec2& b ) {
+SMATH_INLINE bool32 cmp( const vec2& a, const vec2& b ) {
     return sqr_mag(a - b) < VEC_CMP_THRESHOLD;
 }
 
 // NOTE(alicia): ivec2
 
-ivec2 ivec2::create( i32 x, i32 y ) {
+SMATH_INLINE ivec2 ivec2::create( i32 x, i32 y ) {
     return { x, y };
 }
-ivec2 ivec2::create( i32 scalar ) {
+SMATH_INLINE ivec2 ivec2::create( i32 scalar ) {
     return { scalar, scalar };
 }
-ivec2 ivec2::create( const vec2& v ) {
+SMATH_INLINE ivec2 ivec2::create( const vec2& v ) {
     return { (i32)v.x, (i32)v.y };
 }
-ivec2 ivec2::create( const ivec3& v ) {
+SMATH_INLINE ivec2 ivec2::create( const ivec3& v ) {
     return { v.x, v.y };
 }
-ivec2 ivec2::create( const ivec4& v ) {
+SMATH_INLINE ivec2 ivec2::create( const ivec4& v ) {
     return { v.x, v.y };
 }
-ivec2 ivec2::create( const bvec2& v ) {
+SMATH_INLINE ivec2 ivec2::create( const bvec2& v ) {
     return { (i32)((bool)v.x), (i32)((bool)v.y) };
 }
-i32* ivec2::ptr() { return &x; }
-const i32* ivec2::ptr() const { return &x; }
-i32& ivec2::operator[]( u32 index ) { return ptr()[index]; }
-i32 ivec2::operator[]( u32 index ) const { return ptr()[index]; }
-ivec2& ivec2::operator-() { return *this *= -1.0f; }
-bool32 ivec2::operator==( const ivec2& rhs ) const { return cmp( *this, rhs ); }
-bool32 ivec2::operator!=( const ivec2& rhs ) const { return !(*this == rhs); }
-ivec2& ivec2::operator+=( const ivec2& rhs ) {
+SMATH_INLINE i32* ivec2::ptr() { return &x; }
+SMATH_INLINE const i32* ivec2::ptr() const { return &x; }
+SMATH_INLINE i32& ivec2::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE i32 ivec2::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE ivec2& ivec2::operator-() { return *this *= -1.0f; }
+SMATH_INLINE bool32 ivec2::operator==( const ivec2& rhs ) const { return cmp( *this, rhs ); }
+SMATH_INLINE bool32 ivec2::operator!=( const ivec2& rhs ) const { return !(*this == rhs); }
+SMATH_INLINE ivec2& ivec2::operator+=( const ivec2& rhs ) {
     this->x += rhs.x;
     this->y += rhs.y;
     return *this;
 }
-ivec2& ivec2::operator-=( const ivec2& rhs ) {
+SMATH_INLINE ivec2& ivec2::operator-=( const ivec2& rhs ) {
     this->x -= rhs.x;
     this->y -= rhs.y;
     return *this;
 }
-ivec2& ivec2::operator*=( i32 rhs ) {
+SMATH_INLINE ivec2& ivec2::operator*=( i32 rhs ) {
     this->x *= rhs;
     this->y *= rhs;
     return *this;
 }
-ivec2& ivec2::operator/=( i32 rhs ) {
+SMATH_INLINE ivec2& ivec2::operator/=( i32 rhs ) {
     this->x /= rhs;
     this->y /= rhs;
     return *this;
 }
-ivec2 operator+( const ivec2& lhs, const ivec2& rhs ) {
+SMATH_INLINE ivec2 operator+( const ivec2& lhs, const ivec2& rhs ) {
     return ivec2(lhs) += rhs;
 }
-ivec2 operator-( const ivec2& lhs, const ivec2& rhs ) {
+SMATH_INLINE ivec2 operator-( const ivec2& lhs, const ivec2& rhs ) {
     return ivec2(lhs) -= rhs;
 }
-ivec2 operator*( const ivec2& lhs, i32 rhs ) {
+SMATH_INLINE ivec2 operator*( const ivec2& lhs, i32 rhs ) {
     return ivec2(lhs) *= rhs;
 }
-ivec2 operator*( i32 lhs, const ivec2& rhs ) {
+SMATH_INLINE ivec2 operator*( i32 lhs, const ivec2& rhs ) {
     return ivec2(rhs) *= lhs;
 }
-ivec2 operator/( const ivec2& lhs, i32 rhs ) {
+SMATH_INLINE ivec2 operator/( const ivec2& lhs, i32 rhs ) {
     return ivec2(lhs) /= rhs;
 }
-void swap( ivec2& v ) {
+SMATH_INLINE void swap( ivec2& v ) {
     i32 tmp = v.x;
     v.x = v.y;
     v.y = tmp;
 }
-i32 horizontal_add( const ivec2& v ) {
+SMATH_INLINE i32 horizontal_add( const ivec2& v ) {
     return v.x + v.y;
 }
-i32 horizontal_mul( const ivec2& v ) {
+SMATH_INLINE i32 horizontal_mul( const ivec2& v ) {
     return v.x * v.y;
 }
-ivec2 hadamard( const ivec2& lhs, const ivec2& rhs ) {
+SMATH_INLINE ivec2 hadamard( const ivec2& lhs, const ivec2& rhs ) {
     return { lhs.x * rhs.x, lhs.y * rhs.y };
 }
-f32 dot( const ivec2& lhs, const ivec2& rhs ) {
+SMATH_INLINE f32 dot( const ivec2& lhs, const ivec2& rhs ) {
     return dot( vec2::create(lhs), vec2::create(rhs) );
 }
-f32 sqr_mag( const ivec2& v ) {
+SMATH_INLINE f32 sqr_mag( const ivec2& v ) {
     return sqr_mag( vec2::create(v) );
 }
-f32 mag( const ivec2& v ) {
+SMATH_INLINE f32 mag( const ivec2& v ) {
     return sqrt( sqr_mag( v ) );
 }
-f32 angle( const ivec2& a, const ivec2& b ) {
+SMATH_INLINE f32 angle( const ivec2& a, const ivec2& b ) {
     return angle( vec2::create(a), vec2::create(b) );
 }
-f32 unsigned_angle( const ivec2& a, const ivec2& b ) {
+SMATH_INLINE f32 unsigned_angle( const ivec2& a, const ivec2& b ) {
     return unsigned_angle( vec2::create(a), vec2::create(b) );
 }
-ivec2 min( const ivec2& a, const ivec2& b ) {
+SMATH_INLINE ivec2 min( const ivec2& a, const ivec2& b ) {
     return { min( a.x, b.x ), min( a.y, b.y ) };
 }
-ivec2 max( const ivec2& a, const ivec2& b ) {
+SMATH_INLINE ivec2 max( const ivec2& a, const ivec2& b ) {
     return { max( a.x, b.x ), max( a.y, b.y ) };
 }
-vec2 normalize_range( const ivec2& v ) {
+SMATH_INLINE vec2 normalize_range( const ivec2& v ) {
     return { normalize_range(v.x), normalize_range(v.y) };
 }
-vec2 normalize_range01( const ivec2& v ) {
+SMATH_INLINE vec2 normalize_range01( const ivec2& v ) {
     return { normalize_range((u32)v.x), normalize_range((u32)v.y) };
 }
-bool32 cmp( const ivec2& a, const ivec2& b ) {
+SMATH_INLINE bool32 cmp( const ivec2& a, const ivec2& b ) {
     return a.x == b.x && a.y == b.y;
 }
 
 // NOTE(alicia): bvec2
 
-bvec2 bvec2::create( bool32 x, bool32 y ) {
+SMATH_INLINE bvec2 bvec2::create( bool32 x, bool32 y ) {
     return { x, y };
 }
-bvec2 bvec2::create( bool32 boolean ) {
+SMATH_INLINE bvec2 bvec2::create( bool32 boolean ) {
     return { boolean, boolean };
 }
-bvec2 bvec2::create( const vec2& v ) {
+SMATH_INLINE bvec2 bvec2::create( const vec2& v ) {
     return { (bool)v.x, (bool)v.y };
 }
-bvec2 bvec2::create( const ivec2& v ) {
+SMATH_INLINE bvec2 bvec2::create( const ivec2& v ) {
     return { (bool)v.x, (bool)v.y };
 }
-bvec2 bvec2::create( const bvec3& v ) {
+SMATH_INLINE bvec2 bvec2::create( const bvec3& v ) {
     return { v.x, v.y };
 }
-bvec2 bvec2::create( const bvec4& v ) {
+SMATH_INLINE bvec2 bvec2::create( const bvec4& v ) {
     return { v.x, v.y };
 }
-bool32* bvec2::ptr() { return &x; }
-const bool32* bvec2::ptr() const { return &x; }
-bool32& bvec2::operator[]( u32 index ) { return ptr()[index]; }
-bool32 bvec2::operator[]( u32 index ) const { return ptr()[index]; }
-bvec2& bvec2::operator!() {
+SMATH_INLINE bool32* bvec2::ptr() { return &x; }
+SMATH_INLINE const bool32* bvec2::ptr() const { return &x; }
+SMATH_INLINE bool32& bvec2::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE bool32 bvec2::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE bvec2& bvec2::operator!() {
     *this = { !this->x, !this->y }; 
     return *this;
 }
-bool32 bvec2::operator==( const bvec2& rhs ) const {
+SMATH_INLINE bool32 bvec2::operator==( const bvec2& rhs ) const {
     return this->x == rhs.x && this->y == rhs.y;
 }
-bool32 bvec2::operator!=( const bvec2& rhs ) const {
+SMATH_INLINE bool32 bvec2::operator!=( const bvec2& rhs ) const {
     return !(*this == rhs);
 }
-bvec2 bvec2::operator>( const bvec2& rhs ) {
+SMATH_INLINE bvec2 bvec2::operator>( const bvec2& rhs ) {
     return { this->x > rhs.x, this->y > rhs.y };
 }
-bvec2 bvec2::operator>=( const bvec2& rhs ) {
+SMATH_INLINE bvec2 bvec2::operator>=( const bvec2& rhs ) {
     return { this->x >= rhs.x, this->y >= rhs.y };
 }
-bvec2 bvec2::operator<( const bvec2& rhs ) {
+SMATH_INLINE bvec2 bvec2::operator<( const bvec2& rhs ) {
     return { this->x < rhs.x, this->y < rhs.y };
 }
-bvec2 bvec2::operator<=( const bvec2& rhs ) {
+SMATH_INLINE bvec2 bvec2::operator<=( const bvec2& rhs ) {
     return { this->x <= rhs.x, this->y <= rhs.y };
 }
-bool32 horizontal_and( const bvec2& v ) {
+SMATH_INLINE bool32 horizontal_and( const bvec2& v ) {
     return v.x && v.y;
 }
-bool32 horizontal_or( const bvec2& v ) {
+SMATH_INLINE bool32 horizontal_or( const bvec2& v ) {
     return v.x || v.y;
 }
 
 // NOTE(alicia): vec3
 
-vec3 vec3::create( f32 x, f32 y, f32 z ) {
+SMATH_CONSTEXPR vec3 vec3::create( f32 x, f32 y, f32 z ) {
     return { x, y, z };
 }
-vec3 vec3::create( f32 scalar ) {
+SMATH_CONSTEXPR vec3 vec3::create( f32 scalar ) {
     return { scalar, scalar, scalar };
 }
-vec3 vec3::create( const vec2& v ) {
+SMATH_INLINE vec3 vec3::create( const vec2& v ) {
     return { v.x, v.y, 0.0f };
 }
-vec3 vec3::create( const ivec3& v ) {
+SMATH_INLINE vec3 vec3::create( const ivec3& v ) {
     return { (f32)v.x, (f32)v.y, (f32)v.z };
 }
-vec3 vec3::create( const bvec3& v ) {
+SMATH_INLINE vec3 vec3::create( const bvec3& v ) {
     return { (f32)((bool)v.x), (f32)((bool)v.y), (f32)((bool)v.z) };
 }
-vec3 vec3::create( const vec4& v ) {
+SMATH_INLINE vec3 vec3::create( const vec4& v ) {
     return { v.x, v.y, v.z };
 }
-f32* vec3::ptr() { return &x; }
-const f32* vec3::ptr() const { return &x; }
-f32& vec3::operator[]( u32 index ) { return ptr()[index]; }
-f32 vec3::operator[]( u32 index ) const { return ptr()[index]; }
-vec3& vec3::operator-() { return *this *= -1.0f; }
-bool32 vec3::operator==( const vec3& rhs ) const { return cmp( *this, rhs ); }
-bool32 vec3::operator!=( const vec3& rhs ) const { return !(*this == rhs); }
-vec3& vec3::operator+=( const vec3& rhs ) {
+SMATH_INLINE f32* vec3::ptr() { return &x; }
+SMATH_INLINE const f32* vec3::ptr() const { return &x; }
+SMATH_INLINE f32& vec3::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE f32 vec3::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE vec3& vec3::operator-() { return *this *= -1.0f; }
+SMATH_INLINE bool32 vec3::operator==( const vec3& rhs ) const { return cmp( *this, rhs ); }
+SMATH_INLINE bool32 vec3::operator!=( const vec3& rhs ) const { return !(*this == rhs); }
+SMATH_CONSTEXPR vec3& vec3::operator+=( const vec3& rhs ) {
     this->x += rhs.x;
     this->y += rhs.y;
     this->z += rhs.z;
     return *this;
 }
-vec3& vec3::operator-=( const vec3& rhs ) {
+SMATH_CONSTEXPR vec3& vec3::operator-=( const vec3& rhs ) {
     this->x -= rhs.x;
     this->y -= rhs.y;
     this->z -= rhs.z;
     return *this;
 }
-vec3& vec3::operator*=( f32 rhs ) {
+SMATH_CONSTEXPR vec3& vec3::operator*=( f32 rhs ) {
     this->x *= rhs;
     this->y *= rhs;
     this->z *= rhs;
     return *this;
 }
-vec3& vec3::operator/=( f32 rhs ) {
+SMATH_CONSTEXPR vec3& vec3::operator/=( f32 rhs ) {
     this->x /= rhs;
     this->y /= rhs;
     this->z /= rhs;
     return *this;
 }
-vec3 operator+( const vec3& lhs, const vec3& rhs ) {
+SMATH_CONSTEXPR vec3 operator+( const vec3& lhs, const vec3& rhs ) {
     return vec3(lhs) += rhs;
 }
-vec3 operator-( const vec3& lhs, const vec3& rhs ) {
+SMATH_CONSTEXPR vec3 operator-( const vec3& lhs, const vec3& rhs ) {
     return vec3(lhs) -= rhs;
 }
-vec3 operator*( const vec3& lhs, f32 rhs ) {
+SMATH_CONSTEXPR vec3 operator*( const vec3& lhs, f32 rhs ) {
     return vec3(lhs) *= rhs;
 }
-vec3 operator*( f32 lhs, const vec3& rhs ) {
+SMATH_CONSTEXPR vec3 operator*( f32 lhs, const vec3& rhs ) {
     return vec3(rhs) *= lhs;
 }
-vec3 operator/( const vec3& lhs, f32 rhs ) {
+SMATH_CONSTEXPR vec3 operator/( const vec3& lhs, f32 rhs ) {
     return vec3(lhs) /= rhs;
 }
-hsv vec3::create_hsv( f32 hue, f32 saturation, f32 value ) {
+SMATH_INLINE hsv vec3::create_hsv( f32 hue, f32 saturation, f32 value ) {
     return {
         internal::degrees_overflow( hue ),
         clamp01(saturation),
         clamp01(value)
     };
 }
-hsv rgb_to_hsv( const rgb& rgb ) {
+SMATH_INLINE hsv rgb_to_hsv( const rgb& rgb ) {
     f32 x_max, x_min;
     x_max = rgb.r > rgb.g ?
         ( rgb.r > rgb.b ? rgb.r : rgb.b ) :
@@ -1337,7 +1100,7 @@ hsv rgb_to_hsv( const rgb& rgb ) {
 
     return hsv::create_hsv( hue, saturation, x_max );
 }
-rgb hsv_to_rgb( const hsv& hsv ) {
+SMATH_INLINE rgb hsv_to_rgb( const hsv& hsv ) {
     
     f32 chroma    = hsv.value * hsv.saturation;
     f32 hue       = hsv.hue / 60.0f;
@@ -1369,104 +1132,104 @@ rgb hsv_to_rgb( const hsv& hsv ) {
         result.b + m
     };
 }
-void set_hue( hsv& hsv, f32 hue ) {
+SMATH_INLINE void set_hue( hsv& hsv, f32 hue ) {
     hsv.hue = internal::degrees_overflow( hue );
 }
-void set_saturation( hsv& hsv, f32 saturation ) {
+SMATH_INLINE void set_saturation( hsv& hsv, f32 saturation ) {
     hsv.saturation = clamp01( saturation );
 }
-void set_value( hsv& hsv, f32 value ) {
+SMATH_INLINE void set_value( hsv& hsv, f32 value ) {
     hsv.value = clamp01( value );
 }
-rgb linear_to_srgb( const rgb& linear ) {
+SMATH_INLINE rgb linear_to_srgb( const rgb& linear ) {
     return {
         pow( linear.r, 1.0f / 2.2f ),
         pow( linear.g, 1.0f / 2.2f ),
         pow( linear.b, 1.0f / 2.2f ),
     };
 }
-rgb srgb_to_linear( const rgb& srgb ) {
+SMATH_INLINE rgb srgb_to_linear( const rgb& srgb ) {
     return {
         pow( srgb.r, 2.2f ),
         pow( srgb.g, 2.2f ),
         pow( srgb.b, 2.2f ),
     };
 }
-void shift_left( vec3& v ) {
+SMATH_INLINE void shift_left( vec3& v ) {
     f32 tmp = v.x;
     v.x = v.y;
     v.y = v.z;
     v.z = tmp;
 }
-void shift_right( vec3& v ) {
+SMATH_INLINE void shift_right( vec3& v ) {
     f32 tmp = v.z;
     v.z = v.y;
     v.y = v.x;
     v.x = tmp;
 }
-f32 horizontal_add( const vec3& v ) {
+SMATH_CONSTEXPR f32 horizontal_add( const vec3& v ) {
     return v.x + v.y + v.z;
 }
-f32 horizontal_mul( const vec3& v ) {
+SMATH_INLINE f32 horizontal_mul( const vec3& v ) {
     return v.x * v.y * v.z;
 }
-vec3 hadamard( const vec3& lhs, const vec3& rhs ) {
+SMATH_CONSTEXPR vec3 hadamard( const vec3& lhs, const vec3& rhs ) {
     return {
         lhs.x * rhs.x,
         lhs.y * rhs.y,
         lhs.z * rhs.z
     };
 }
-vec3 normalize( const vec3& v ) {
+SMATH_INLINE vec3 normalize( const vec3& v ) {
     f32 m = mag( v );
     return m < 0.0001f ? vec3::zero() : v / m;
 }
-f32 dot( const vec3& lhs, const vec3& rhs ) {
+SMATH_CONSTEXPR f32 dot( const vec3& lhs, const vec3& rhs ) {
     vec3 result = hadamard( lhs, rhs );
     return horizontal_add(result);
 }
-vec3 cross( const vec3& lhs, const vec3& rhs ) {
+SMATH_CONSTEXPR vec3 cross( const vec3& lhs, const vec3& rhs ) {
     return {
         ( lhs.y * rhs.z ) - ( lhs.z * rhs.y ),
         ( lhs.z * rhs.x ) - ( lhs.x * rhs.z ),
         ( lhs.x * rhs.y ) - ( lhs.y * rhs.x )
     };
 }
-f32 sqr_mag( const vec3& v ) {
+SMATH_INLINE f32 sqr_mag( const vec3& v ) {
     vec3 result = hadamard( v, v );
     return horizontal_add( result );
 }
-f32 mag( const vec3& v ) {
+SMATH_INLINE f32 mag( const vec3& v ) {
     return sqrt( sqr_mag( v ) );
 }
-vec3 reflect( const vec3& direction, const vec3& normal ) {
+SMATH_INLINE vec3 reflect( const vec3& direction, const vec3& normal ) {
     return ( normal - direction ) * ( 2.0f * dot( direction, normal ) );
 }
-f32 angle( const vec3& a, const vec3& b ) {
+SMATH_INLINE f32 angle( const vec3& a, const vec3& b ) {
     return acos( dot( a, b ) );
 }
-f32 unsigned_angle( const vec3& a, const vec3& b ) {
+SMATH_INLINE f32 unsigned_angle( const vec3& a, const vec3& b ) {
     return internal::signed_angle_to_unsigned( angle( a, b ) );
 }
-vec3 lerp( const vec3& a, const vec3& b, f32 t ) {
+SMATH_CONSTEXPR vec3 lerp( const vec3& a, const vec3& b, f32 t ) {
     return ( 1.0f - t ) * a + b * t;
 }
-vec3 clamped_lerp( const vec3& a, const vec3& b, f32 t ) {
+SMATH_INLINE vec3 clamped_lerp( const vec3& a, const vec3& b, f32 t ) {
     return lerp( a, b, clamp01(t) );
 }
-vec3 smooth_step( const vec3& a, const vec3& b, f32 t ) {
+SMATH_INLINE vec3 smooth_step( const vec3& a, const vec3& b, f32 t ) {
     return ( b - a ) * ( 3.0f - t * 2.0f ) * t * t + a;
 }
-vec3 smooth_step_clamped( const vec3& a, const vec3& b, f32 t ) {
+SMATH_INLINE vec3 smooth_step_clamped( const vec3& a, const vec3& b, f32 t ) {
     return smooth_step( a, b, clamp01(t) );
 }
-vec3 smoother_step( const vec3& a, const vec3& b, f32 t ) {
+SMATH_INLINE vec3 smoother_step( const vec3& a, const vec3& b, f32 t ) {
     return ( b - a ) * ( ( t * ( t * 6.0f - 15.0f ) + 10.0f ) * t * t * t ) + a;
 }
-vec3 smoother_step_clamped( const vec3& a, const vec3& b, f32 t ) {
+SMATH_INLINE vec3 smoother_step_clamped( const vec3& a, const vec3& b, f32 t ) {
     return smoother_step( a, b, clamp01(t) );
 }
-vec3 clamp( const vec3& v, f32 max ) {
+SMATH_INLINE vec3 clamp( const vec3& v, f32 max ) {
     f32 maximum = absolute(max);
     f32 magnitude = mag(v);
     if( magnitude > maximum ) {
@@ -1477,282 +1240,282 @@ vec3 clamp( const vec3& v, f32 max ) {
         return v;
     }
 }
-ivec3 trunc32( const vec3& v ) {
+SMATH_INLINE ivec3 trunc32( const vec3& v ) {
     return { trunc32(v.x), trunc32(v.y), trunc32(v.z) };
 }
-ivec3 floor32( const vec3& v ) {
+SMATH_INLINE ivec3 floor32( const vec3& v ) {
     return { floor32(v.x), floor32(v.y), floor32(v.z) };
 }
-ivec3 ceil32( const vec3& v ) {
+SMATH_INLINE ivec3 ceil32( const vec3& v ) {
     return { ceil32(v.x), ceil32(v.y), ceil32(v.z) };
 }
-ivec3 round32( const vec3& v ) {
+SMATH_INLINE ivec3 round32( const vec3& v ) {
     return { round32(v.x), round32(v.y), round32(v.z) };
 }
-bool32 cmp( const vec3& a, const vec3& b ) {
+SMATH_INLINE bool32 cmp( const vec3& a, const vec3& b ) {
     return sqr_mag(a - b) < VEC_CMP_THRESHOLD;
 }
-euler_angles to_rad( const euler_angles& deg ) {
+SMATH_INLINE euler_angles to_rad( const euler_angles& deg ) {
     const euler_angles _to_rad = euler_angles::create(F32::PI / 180.0f);
     return hadamard( _to_rad, deg );
 }
-euler_angles to_deg( const euler_angles& rad ) {
+SMATH_INLINE euler_angles to_deg( const euler_angles& rad ) {
     const euler_angles _to_deg = euler_angles::create(180.0f / F32::PI);
     return hadamard( _to_deg, rad );
 }
 
 // NOTE(alicia): ivec3
 
-ivec3 ivec3::create( i32 x, i32 y, i32 z ) {
+SMATH_INLINE ivec3 ivec3::create( i32 x, i32 y, i32 z ) {
     return { x, y, z };
 }
-ivec3 ivec3::create( i32 scalar ) {
+SMATH_INLINE ivec3 ivec3::create( i32 scalar ) {
     return { scalar, scalar, scalar };
 }
-ivec3 ivec3::create( const vec3& v ) {
+SMATH_INLINE ivec3 ivec3::create( const vec3& v ) {
     return { (i32)v.x, (i32)v.y, (i32)v.z };
 }
-ivec3 ivec3::create( const ivec2& v ) {
+SMATH_INLINE ivec3 ivec3::create( const ivec2& v ) {
     return { v.x, v.y, 0 };
 }
-ivec3 ivec3::create( const ivec4& v ) {
+SMATH_INLINE ivec3 ivec3::create( const ivec4& v ) {
     return { v.x, v.y, v.z };
 }
-ivec3 ivec3::create( const bvec3& v ) {
+SMATH_INLINE ivec3 ivec3::create( const bvec3& v ) {
     return { (i32)((bool)v.x), (i32)((bool)v.y), (i32)((bool)v.z), };
 }
-i32* ivec3::ptr() { return &x; }
-const i32* ivec3::ptr() const { return &x; }
-i32& ivec3::operator[]( u32 index ) { return ptr()[index]; }
-i32 ivec3::operator[]( u32 index ) const { return ptr()[index]; }
-ivec3& ivec3::operator-() { return *this *= -1.0f; }
-bool32 ivec3::operator==( const ivec3& rhs ) const { return cmp( *this, rhs ); }
-bool32 ivec3::operator!=( const ivec3& rhs ) const { return !(*this == rhs); }
-ivec3& ivec3::operator+=( const ivec3& rhs ) {
+SMATH_INLINE i32* ivec3::ptr() { return &x; }
+SMATH_INLINE const i32* ivec3::ptr() const { return &x; }
+SMATH_INLINE i32& ivec3::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE i32 ivec3::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE ivec3& ivec3::operator-() { return *this *= -1.0f; }
+SMATH_INLINE bool32 ivec3::operator==( const ivec3& rhs ) const { return cmp( *this, rhs ); }
+SMATH_INLINE bool32 ivec3::operator!=( const ivec3& rhs ) const { return !(*this == rhs); }
+SMATH_INLINE ivec3& ivec3::operator+=( const ivec3& rhs ) {
     this->x += rhs.x;
     this->y += rhs.y;
     this->z += rhs.z;
     return *this;
 }
-ivec3& ivec3::operator-=( const ivec3& rhs ) {
+SMATH_INLINE ivec3& ivec3::operator-=( const ivec3& rhs ) {
     this->x -= rhs.x;
     this->y -= rhs.y;
     this->z -= rhs.z;
     return *this;
 }
-ivec3& ivec3::operator*=( i32 rhs ) {
+SMATH_INLINE ivec3& ivec3::operator*=( i32 rhs ) {
     this->x *= rhs;
     this->y *= rhs;
     this->z *= rhs;
     return *this;
 }
-ivec3& ivec3::operator/=( i32 rhs ) {
+SMATH_INLINE ivec3& ivec3::operator/=( i32 rhs ) {
     this->x /= rhs;
     this->y /= rhs;
     this->z /= rhs;
     return *this;
 }
-ivec3 operator+( const ivec3& lhs, const ivec3& rhs ) {
+SMATH_INLINE ivec3 operator+( const ivec3& lhs, const ivec3& rhs ) {
     return ivec3(lhs) += rhs;
 }
-ivec3 operator-( const ivec3& lhs, const ivec3& rhs ) {
+SMATH_INLINE ivec3 operator-( const ivec3& lhs, const ivec3& rhs ) {
     return ivec3(lhs) -= rhs;
 }
-ivec3 operator*( const ivec3& lhs, i32 rhs ) {
+SMATH_INLINE ivec3 operator*( const ivec3& lhs, i32 rhs ) {
     return ivec3(lhs) *= rhs;
 }
-ivec3 operator*( i32 lhs, const ivec3& rhs ) {
+SMATH_INLINE ivec3 operator*( i32 lhs, const ivec3& rhs ) {
     return ivec3(rhs) *= lhs;
 }
-ivec3 operator/( const ivec3& lhs, i32 rhs ) {
+SMATH_INLINE ivec3 operator/( const ivec3& lhs, i32 rhs ) {
     return ivec3(lhs) /= rhs;
 }
-void shift_left( ivec3& v ) {
+SMATH_INLINE void shift_left( ivec3& v ) {
     i32 tmp = v.x;
     v.x = v.y;
     v.y = v.z;
     v.z = tmp;
 }
-void shift_right( ivec3& v ) {
+SMATH_INLINE void shift_right( ivec3& v ) {
     i32 tmp = v.z;
     v.z = v.y;
     v.y = v.x;
     v.x = tmp;
 }
-i32 horizontal_add( const ivec3& v ) {
+SMATH_INLINE i32 horizontal_add( const ivec3& v ) {
     return v.x + v.y + v.z;
 }
-i32 horizontal_mul( const ivec3& v ) {
+SMATH_INLINE i32 horizontal_mul( const ivec3& v ) {
     return v.x * v.y * v.z;
 }
-ivec3 hadamard( const ivec3& lhs, const ivec3& rhs ) {
+SMATH_INLINE ivec3 hadamard( const ivec3& lhs, const ivec3& rhs ) {
     return { lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z };
 }
-f32 dot( const ivec3& lhs, const ivec3& rhs ) {
+SMATH_INLINE f32 dot( const ivec3& lhs, const ivec3& rhs ) {
     return dot( vec3::create(lhs), vec3::create(rhs) );
 }
-ivec3 cross( const ivec3& lhs, const ivec3& rhs ) {
+SMATH_INLINE ivec3 cross( const ivec3& lhs, const ivec3& rhs ) {
     return ivec3::create( cross( vec3::create(lhs), vec3::create(rhs) ) );
 }
-f32 sqr_mag( const ivec3& v ) {
+SMATH_INLINE f32 sqr_mag( const ivec3& v ) {
     return sqr_mag( vec3::create(v) );
 }
-f32 mag( const ivec3& v ) {
+SMATH_INLINE f32 mag( const ivec3& v ) {
     return sqrt( sqr_mag( v ) );
 }
-f32 angle( const ivec3& a, const ivec3& b ) {
+SMATH_INLINE f32 angle( const ivec3& a, const ivec3& b ) {
     return angle( vec3::create(a), vec3::create(b) );
 }
-f32 unsigned_angle( const ivec3& a, const ivec3& b ) {
+SMATH_INLINE f32 unsigned_angle( const ivec3& a, const ivec3& b ) {
     return unsigned_angle( vec3::create(a), vec3::create(b) );
 }
-ivec3 min( const ivec3& a, const ivec3& b ) {
+SMATH_INLINE ivec3 min( const ivec3& a, const ivec3& b ) {
     return { min( a.x, b.x ), min( a.y, b.y ), min( a.z, b.z ) };
 }
-ivec3 max( const ivec3& a, const ivec3& b ) {
+SMATH_INLINE ivec3 max( const ivec3& a, const ivec3& b ) {
     return { max( a.x, b.x ), max( a.y, b.y ), max( a.z, b.z ) };
 }
-vec3 normalize_range( const ivec3& v ) {
+SMATH_INLINE vec3 normalize_range( const ivec3& v ) {
     return { normalize_range(v.x), normalize_range(v.y), normalize_range(v.z) };
 }
-vec3 normalize_range01( const ivec3& v ) {
+SMATH_INLINE vec3 normalize_range01( const ivec3& v ) {
     return { normalize_range((u32)v.x), normalize_range((u32)v.y), normalize_range((u32)v.z) };
 }
-bool32 cmp( const ivec3& a, const ivec3& b ) {
+SMATH_INLINE bool32 cmp( const ivec3& a, const ivec3& b ) {
     return a.x == b.x && a.y == b.y && a.z == b.z;
 }
 
 // NOTE(alicia): bvec3
 
-bvec3 bvec3::create( bool32 x, bool32 y, bool32 z  ) {
+SMATH_INLINE bvec3 bvec3::create( bool32 x, bool32 y, bool32 z  ) {
     return { x, y, z };
 }
-bvec3 bvec3::create( bool32 boolean ) {
+SMATH_INLINE bvec3 bvec3::create( bool32 boolean ) {
     return { boolean, boolean, boolean };
 }
-bvec3 bvec3::create( const vec3& v ) {
+SMATH_INLINE bvec3 bvec3::create( const vec3& v ) {
     return { (bool)v.x, (bool)v.y, (bool)v.z };
 }
-bvec3 bvec3::create( const ivec3& v ) {
+SMATH_INLINE bvec3 bvec3::create( const ivec3& v ) {
     return { (bool)v.x, (bool)v.y, (bool)v.z };
 }
-bvec3 bvec3::create( const bvec2& v ) {
+SMATH_INLINE bvec3 bvec3::create( const bvec2& v ) {
     return { v.x, v.y, false };
 }
-bvec3 bvec3::create( const bvec4& v ) {
+SMATH_INLINE bvec3 bvec3::create( const bvec4& v ) {
     return { v.x, v.y, v.z };
 }
-bool32* bvec3::ptr() { return &x; }
-const bool32* bvec3::ptr() const { return &x; }
-bvec3& bvec3::operator!() {
+SMATH_INLINE bool32* bvec3::ptr() { return &x; }
+SMATH_INLINE const bool32* bvec3::ptr() const { return &x; }
+SMATH_INLINE bvec3& bvec3::operator!() {
     *this = { !this->x, !this->y, !this->z }; 
     return *this;
 }
-bool32& bvec3::operator[]( u32 index ) {
+SMATH_INLINE bool32& bvec3::operator[]( u32 index ) {
     return ptr()[index];
 }
-bool32 bvec3::operator[]( u32 index ) const {
+SMATH_INLINE bool32 bvec3::operator[]( u32 index ) const {
     return ptr()[index];
 }
-bool32 bvec3::operator==( const bvec3& rhs ) const {
+SMATH_INLINE bool32 bvec3::operator==( const bvec3& rhs ) const {
     return this->x == rhs.x && this->y == rhs.y && this->z == rhs.z;
 }
-bool32 bvec3::operator!=( const bvec3& rhs ) const {
+SMATH_INLINE bool32 bvec3::operator!=( const bvec3& rhs ) const {
     return !(*this == rhs);
 }
-bvec3 bvec3::operator>( const bvec3& rhs ) {
+SMATH_INLINE bvec3 bvec3::operator>( const bvec3& rhs ) {
     return { this->x > rhs.x, this->y > rhs.y, this->z > rhs.z };
 }
-bvec3 bvec3::operator>=( const bvec3& rhs ) {
+SMATH_INLINE bvec3 bvec3::operator>=( const bvec3& rhs ) {
     return { this->x >= rhs.x, this->y >= rhs.y, this->z >= rhs.z };
 }
-bvec3 bvec3::operator<( const bvec3& rhs ) {
+SMATH_INLINE bvec3 bvec3::operator<( const bvec3& rhs ) {
     return { this->x < rhs.x, this->y < rhs.y, this->z < rhs.z };
 }
-bvec3 bvec3::operator<=( const bvec3& rhs ) {
+SMATH_INLINE bvec3 bvec3::operator<=( const bvec3& rhs ) {
     return { this->x <= rhs.x, this->y <= rhs.y, this->z <= rhs.z };
 }
-bool32 horizontal_and( const bvec3& v ) {
+SMATH_INLINE bool32 horizontal_and( const bvec3& v ) {
     return v.x && v.y && v.z;
 }
-bool32 horizontal_or( const bvec3& v ) {
+SMATH_INLINE bool32 horizontal_or( const bvec3& v ) {
     return v.x || v.y || v.z;
 }
 
 // NOTE(alicia): vec4
 
-vec4 vec4::create( f32 x, f32 y, f32 z, f32 w ) {
+SMATH_CONSTEXPR vec4 vec4::create( f32 x, f32 y, f32 z, f32 w ) {
     return { x, y, z, w };
 }
-vec4 vec4::create( f32 scalar ) {
+SMATH_CONSTEXPR vec4 vec4::create( f32 scalar ) {
     return { scalar, scalar, scalar, scalar };
 }
-vec4 vec4::create( const vec2& v ) {
+SMATH_INLINE vec4 vec4::create( const vec2& v ) {
     return { v.x, v.y, 0.0f, 0.0f };
 }
-vec4 vec4::create( const vec3& v ) {
+SMATH_INLINE vec4 vec4::create( const vec3& v ) {
     return { v.x, v.y, v.z, 0.0f };
 }
-vec4 vec4::create( const ivec4& v ) {
+SMATH_INLINE vec4 vec4::create( const ivec4& v ) {
     return { (f32)v.x, (f32)v.y, (f32)v.z, (f32)v.w };
 }
-vec4 vec4::create( const bvec4& v ) {
+SMATH_INLINE vec4 vec4::create( const bvec4& v ) {
     return { (f32)((bool)v.x), (f32)((bool)v.y), (f32)((bool)v.z), (f32)((bool)v.w) };
 }
-f32* vec4::ptr() { return &x; }
-const f32* vec4::ptr() const { return &x; }
-f32& vec4::operator[]( u32 index ) { return ptr()[index]; }
-f32 vec4::operator[]( u32 index ) const { return ptr()[index]; }
-vec4& vec4::operator-() { return *this *= -1.0f; }
-bool32 vec4::operator==( const vec4& rhs ) const { return cmp( *this, rhs ); }
-bool32 vec4::operator!=( const vec4& rhs ) const { return !(*this == rhs); }
-vec4& vec4::operator+=( const vec4& rhs ) {
+SMATH_INLINE f32* vec4::ptr() { return &x; }
+SMATH_INLINE const f32* vec4::ptr() const { return &x; }
+SMATH_INLINE f32& vec4::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE f32 vec4::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE vec4& vec4::operator-() { return *this *= -1.0f; }
+SMATH_INLINE bool32 vec4::operator==( const vec4& rhs ) const { return cmp( *this, rhs ); }
+SMATH_INLINE bool32 vec4::operator!=( const vec4& rhs ) const { return !(*this == rhs); }
+SMATH_CONSTEXPR vec4& vec4::operator+=( const vec4& rhs ) {
     this->x += rhs.x;
     this->y += rhs.y;
     this->z += rhs.z;
     this->w += rhs.w;
     return *this;
 }
-vec4& vec4::operator-=( const vec4& rhs ) {
+SMATH_CONSTEXPR vec4& vec4::operator-=( const vec4& rhs ) {
     this->x -= rhs.x;
     this->y -= rhs.y;
     this->z -= rhs.z;
     this->w -= rhs.w;
     return *this;
 }
-vec4& vec4::operator*=( f32 rhs ) {
+SMATH_CONSTEXPR vec4& vec4::operator*=( f32 rhs ) {
     this->x *= rhs;
     this->y *= rhs;
     this->z *= rhs;
     this->w *= rhs;
     return *this;
 }
-vec4& vec4::operator/=( f32 rhs ) {
+SMATH_CONSTEXPR vec4& vec4::operator/=( f32 rhs ) {
     this->x /= rhs;
     this->y /= rhs;
     this->z /= rhs;
     this->w /= rhs;
     return *this;
 }
-vec4 operator+( const vec4& lhs, const vec4& rhs ) {
+SMATH_CONSTEXPR vec4 operator+( const vec4& lhs, const vec4& rhs ) {
     return vec4(lhs) += rhs;
 }
-vec4 operator-( const vec4& lhs, const vec4& rhs ) {
+SMATH_CONSTEXPR vec4 operator-( const vec4& lhs, const vec4& rhs ) {
     return vec4(lhs) -= rhs;
 }
-vec4 operator*( const vec4& lhs, f32 rhs ) {
+SMATH_CONSTEXPR vec4 operator*( const vec4& lhs, f32 rhs ) {
     return vec4(lhs) *= rhs;
 }
-vec4 operator*( f32 lhs, const vec4& rhs ) {
+SMATH_CONSTEXPR vec4 operator*( f32 lhs, const vec4& rhs ) {
     return vec4(rhs) *= lhs;
 }
-vec4 operator/( const vec4& lhs, f32 rhs ) {
+SMATH_CONSTEXPR vec4 operator/( const vec4& lhs, f32 rhs ) {
     return vec4(lhs) /= rhs;
 }
-bool32 cmp( const vec4& a, const vec4& b ) {
+SMATH_INLINE bool32 cmp( const vec4& a, const vec4& b ) {
     return sqr_mag(a - b) < VEC_CMP_THRESHOLD;
 }
-rgba linear_to_srgb( const rgba& linear ) {
+SMATH_INLINE rgba linear_to_srgb( const rgba& linear ) {
     return {
         pow( linear.r, 1.0f / 2.2f ),
         pow( linear.g, 1.0f / 2.2f ),
@@ -1760,7 +1523,7 @@ rgba linear_to_srgb( const rgba& linear ) {
         linear.a
     };
 }
-rgba srgb_to_linear( const rgba& srgb ) {
+SMATH_INLINE rgba srgb_to_linear( const rgba& srgb ) {
     return {
         pow( srgb.r, 2.2f ),
         pow( srgb.g, 2.2f ),
@@ -1768,27 +1531,27 @@ rgba srgb_to_linear( const rgba& srgb ) {
         srgb.a
     };
 }
-void shift_left( vec4& v ) {
+SMATH_INLINE void shift_left( vec4& v ) {
     f32 tmp = v.x;
     v.x = v.y;
     v.y = v.z;
     v.z = v.w;
     v.w = tmp;
 }
-void shift_right( vec4& v ) {
+SMATH_INLINE void shift_right( vec4& v ) {
     f32 tmp = v.w;
     v.w = v.z;
     v.z = v.y;
     v.y = v.x;
     v.x = tmp;
 }
-f32 horizontal_add( const vec4& v ) {
+SMATH_CONSTEXPR f32 horizontal_add( const vec4& v ) {
     return v.x + v.y + v.z + v.w;
 }
-f32 horizontal_mul( const vec4& v ) {
+SMATH_INLINE f32 horizontal_mul( const vec4& v ) {
     return v.x * v.y * v.z * v.w;
 }
-vec4 hadamard( const vec4& lhs, const vec4& rhs ) {
+SMATH_CONSTEXPR vec4 hadamard( const vec4& lhs, const vec4& rhs ) {
     return {
         lhs.x * rhs.x,
         lhs.y * rhs.y,
@@ -1796,40 +1559,42 @@ vec4 hadamard( const vec4& lhs, const vec4& rhs ) {
         lhs.w * rhs.w
     };
 }
-f32 sqr_mag( const vec4& v ) {
+SMATH_INLINE f32 sqr_mag( const vec4& v ) {
     vec4 result = hadamard( v, v );
     return horizontal_add( result );
 }
-f32 mag( const vec4& v ) {
+SMATH_INLINE f32 mag( const vec4& v ) {
     return sqrt( sqr_mag( v ) );
 }
-vec4 normalize( const vec4& v ) {
+SMATH_INLINE vec4 normalize( const vec4& v ) {
     f32 m = mag( v );
     return m < 0.0001f ? vec4::zero() : v / m;
 }
-f32 dot( const vec4& lhs, const vec4& rhs ) {
-    vec4 result = hadamard( lhs, rhs );
-    return horizontal_add(result);
+SMATH_INLINE f32 dot( const vec4& lhs, const vec4& rhs ) {
+    using namespace simd;
+    return lane4f_dot4(
+        lane4f_load_unaligned( lhs.ptr() ),
+        lane4f_load_unaligned( rhs.ptr() ) );
 }
-vec4 lerp( const vec4& a, const vec4& b, f32 t ) {
+SMATH_CONSTEXPR vec4 lerp( const vec4& a, const vec4& b, f32 t ) {
     return ( 1.0f - t ) * a + b * t;
 }
-vec4 clamped_lerp( const vec4& a, const vec4& b, f32 t ) {
+SMATH_INLINE vec4 clamped_lerp( const vec4& a, const vec4& b, f32 t ) {
     return lerp( a, b, clamp01(t) );
 }
-vec4 smooth_step( const vec4& a, const vec4& b, f32 t ) {
+SMATH_INLINE vec4 smooth_step( const vec4& a, const vec4& b, f32 t ) {
     return ( b - a ) * ( 3.0f - t * 2.0f ) * t * t + a;
 }
-vec4 smooth_step_clamped( const vec4& a, const vec4& b, f32 t ) {
+SMATH_INLINE vec4 smooth_step_clamped( const vec4& a, const vec4& b, f32 t ) {
     return smooth_step( a, b, clamp01(t) );
 }
-vec4 smoother_step( const vec4& a, const vec4& b, f32 t ) {
+SMATH_INLINE vec4 smoother_step( const vec4& a, const vec4& b, f32 t ) {
     return ( b - a ) * ( ( t * ( t * 6.0f - 15.0f ) + 10.0f ) * t * t * t ) + a;
 }
-vec4 smoother_step_clamped( const vec4& a, const vec4& b, f32 t ) {
+SMATH_INLINE vec4 smoother_step_clamped( const vec4& a, const vec4& b, f32 t ) {
     return smoother_step( a, b, clamp01(t) );
 }
-vec4 clamp( const vec4& v, f32 max ) {
+SMATH_INLINE vec4 clamp( const vec4& v, f32 max ) {
     f32 maximum = absolute(max);
     f32 magnitude = mag(v);
     if( magnitude > maximum ) {
@@ -1840,19 +1605,19 @@ vec4 clamp( const vec4& v, f32 max ) {
         return v;
     }
 }
-ivec4 trunc32( const vec4& v ) {
+SMATH_INLINE ivec4 trunc32( const vec4& v ) {
     return { trunc32(v.x), trunc32(v.y), trunc32(v.z), trunc32(v.w) };
 }
-ivec4 floor32( const vec4& v ) {
+SMATH_INLINE ivec4 floor32( const vec4& v ) {
     return { floor32(v.x), floor32(v.y), floor32(v.z), floor32(v.w) };
 }
-ivec4 ceil32( const vec4& v ) {
+SMATH_INLINE ivec4 ceil32( const vec4& v ) {
     return { ceil32(v.x), ceil32(v.y), ceil32(v.z), ceil32(v.w) };
 }
-ivec4 round32( const vec4& v ) {
+SMATH_INLINE ivec4 round32( const vec4& v ) {
     return { round32(v.x), round32(v.y), round32(v.z), round32(v.w) };
 }
-rgba rgb_to_rgba( const rgb& v ) {
+SMATH_INLINE rgba rgb_to_rgba( const rgb& v ) {
     rgba result = rgba::create(v);
     result.a = 1.0f;
     return result;
@@ -1860,98 +1625,98 @@ rgba rgb_to_rgba( const rgb& v ) {
 
 // NOTE(alicia): ivec4
 
-ivec4 ivec4::create( i32 x, i32 y, i32 z, i32 w ) {
+SMATH_INLINE ivec4 ivec4::create( i32 x, i32 y, i32 z, i32 w ) {
     return { x, y, z, w };
 }
-ivec4 ivec4::create( i32 scalar ) {
+SMATH_INLINE ivec4 ivec4::create( i32 scalar ) {
     return { scalar, scalar, scalar, scalar };
 }
-ivec4 ivec4::create( const vec4& v ) {
+SMATH_INLINE ivec4 ivec4::create( const vec4& v ) {
     return { (i32)v.x, (i32)v.y, (i32)v.z, (i32)v.w };
 }
-ivec4 ivec4::create( const ivec3& v ) {
+SMATH_INLINE ivec4 ivec4::create( const ivec3& v ) {
     return { v.x, v.y, v.z, 0 };
 }
-ivec4 ivec4::create( const ivec2& v ) {
+SMATH_INLINE ivec4 ivec4::create( const ivec2& v ) {
     return { v.x, v.y, 0, 0 };
 }
-ivec4 ivec4::create( const bvec4& v ) {
+SMATH_INLINE ivec4 ivec4::create( const bvec4& v ) {
     return { (i32)((bool)v.x), (i32)((bool)v.y), (i32)((bool)v.z), (i32)((bool)v.w) };
 }
-i32* ivec4::ptr() { return &x; }
-const i32* ivec4::ptr() const { return &x; }
-i32& ivec4::operator[]( u32 index ) { return ptr()[index]; }
-i32 ivec4::operator[]( u32 index ) const { return ptr()[index]; }
-ivec4& ivec4::operator-() { return *this *= -1; }
-bool32 ivec4::operator==( const ivec4& rhs ) const { return cmp( *this, rhs ); }
-bool32 ivec4::operator!=( const ivec4& rhs ) const { return !(*this == rhs); }
-ivec4& ivec4::operator+=( const ivec4& rhs ) {
+SMATH_INLINE i32* ivec4::ptr() { return &x; }
+SMATH_INLINE const i32* ivec4::ptr() const { return &x; }
+SMATH_INLINE i32& ivec4::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE i32 ivec4::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE ivec4& ivec4::operator-() { return *this *= -1; }
+SMATH_INLINE bool32 ivec4::operator==( const ivec4& rhs ) const { return cmp( *this, rhs ); }
+SMATH_INLINE bool32 ivec4::operator!=( const ivec4& rhs ) const { return !(*this == rhs); }
+SMATH_INLINE ivec4& ivec4::operator+=( const ivec4& rhs ) {
     this->x += rhs.x;
     this->y += rhs.y;
     this->z += rhs.z;
     this->w += rhs.w;
     return *this;
 }
-ivec4& ivec4::operator-=( const ivec4& rhs ) {
+SMATH_INLINE ivec4& ivec4::operator-=( const ivec4& rhs ) {
     this->x -= rhs.x;
     this->y -= rhs.y;
     this->z -= rhs.z;
     this->w -= rhs.w;
     return *this;
 }
-ivec4& ivec4::operator*=( i32 rhs ) {
+SMATH_INLINE ivec4& ivec4::operator*=( i32 rhs ) {
     this->x *= rhs;
     this->y *= rhs;
     this->z *= rhs;
     this->w *= rhs;
     return *this;
 }
-ivec4& ivec4::operator/=( i32 rhs ) {
+SMATH_INLINE ivec4& ivec4::operator/=( i32 rhs ) {
     this->x /= rhs;
     this->y /= rhs;
     this->z /= rhs;
     this->w /= rhs;
     return *this;
 }
-ivec4 operator+( const ivec4& lhs, const ivec4& rhs ) {
+SMATH_INLINE ivec4 operator+( const ivec4& lhs, const ivec4& rhs ) {
     return ivec4(lhs) += rhs;
 }
-ivec4 operator-( const ivec4& lhs, const ivec4& rhs ) {
+SMATH_INLINE ivec4 operator-( const ivec4& lhs, const ivec4& rhs ) {
     return ivec4(lhs) -= rhs;
 }
-ivec4 operator*( const ivec4& lhs, i32 rhs ) {
+SMATH_INLINE ivec4 operator*( const ivec4& lhs, i32 rhs ) {
     return ivec4(lhs) *= rhs;
 }
-ivec4 operator*( i32 lhs, const ivec4& rhs ) {
+SMATH_INLINE ivec4 operator*( i32 lhs, const ivec4& rhs ) {
     return ivec4(rhs) *= lhs;
 }
-ivec4 operator/( const ivec4& lhs, i32 rhs ) {
+SMATH_INLINE ivec4 operator/( const ivec4& lhs, i32 rhs ) {
     return ivec4(lhs) /= rhs;
 }
-bool32 cmp( const ivec4& a, const ivec4& b ) {
+SMATH_INLINE bool32 cmp( const ivec4& a, const ivec4& b ) {
     return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
 }
-void shift_left( ivec4& v ) {
+SMATH_INLINE void shift_left( ivec4& v ) {
     i32 tmp = v.x;
     v.x = v.y;
     v.y = v.z;
     v.z = v.w;
     v.w = tmp;
 }
-void shift_right( ivec4& v ) {
+SMATH_INLINE void shift_right( ivec4& v ) {
     i32 tmp = v.w;
     v.w = v.z;
     v.z = v.y;
     v.y = v.x;
     v.x = tmp;
 }
-i32 horizontal_add( const ivec4& v ) {
+SMATH_INLINE i32 horizontal_add( const ivec4& v ) {
     return v.x + v.y + v.z + v.w;
 }
-i32 horizontal_mul( const ivec4& v ) {
+SMATH_INLINE i32 horizontal_mul( const ivec4& v ) {
     return v.x * v.y * v.z * v.w;
 }
-ivec4 hadamard( const ivec4& lhs, const ivec4& rhs ) {
+SMATH_INLINE ivec4 hadamard( const ivec4& lhs, const ivec4& rhs ) {
     return {
         lhs.x * rhs.x,
         lhs.y * rhs.y,
@@ -1959,16 +1724,16 @@ ivec4 hadamard( const ivec4& lhs, const ivec4& rhs ) {
         lhs.w * rhs.w
     };
 }
-f32 dot( const ivec4& lhs, const ivec4& rhs ) {
+SMATH_INLINE f32 dot( const ivec4& lhs, const ivec4& rhs ) {
     return dot( vec4::create(lhs), vec4::create(rhs) );
 }
-f32 sqr_mag( const ivec4& v ) {
+SMATH_INLINE f32 sqr_mag( const ivec4& v ) {
     return sqr_mag( vec4::create(v) );
 }
-f32 mag( const ivec4& v ) {
+SMATH_INLINE f32 mag( const ivec4& v ) {
     return sqrt( sqr_mag( v ) );
 }
-ivec4 min( const ivec4& a, const ivec4& b ) {
+SMATH_INLINE ivec4 min( const ivec4& a, const ivec4& b ) {
     return {
         min( a.x, b.x ),
         min( a.y, b.y ),
@@ -1976,7 +1741,7 @@ ivec4 min( const ivec4& a, const ivec4& b ) {
         min( a.w, b.w )
     };
 }
-ivec4 max( const ivec4& a, const ivec4& b ) {
+SMATH_INLINE ivec4 max( const ivec4& a, const ivec4& b ) {
     return {
         max( a.x, b.x ),
         max( a.y, b.y ),
@@ -1984,7 +1749,7 @@ ivec4 max( const ivec4& a, const ivec4& b ) {
         max( a.w, b.w )
     };
 }
-vec4 normalize_range( const ivec4& v ) {
+SMATH_INLINE vec4 normalize_range( const ivec4& v ) {
     return {
         normalize_range(v.x),
         normalize_range(v.y),
@@ -1992,7 +1757,7 @@ vec4 normalize_range( const ivec4& v ) {
         normalize_range(v.w)
     };
 }
-vec4 normalize_range01( const ivec4& v ) {
+SMATH_INLINE vec4 normalize_range01( const ivec4& v ) {
     return {
         normalize_range((u32)v.x),
         normalize_range((u32)v.y),
@@ -2003,43 +1768,43 @@ vec4 normalize_range01( const ivec4& v ) {
 
 // NOTE(alicia): bvec4
 
-bvec4 bvec4::create( bool32 x, bool32 y, bool32 z, bool32 w ) {
+SMATH_INLINE bvec4 bvec4::create( bool32 x, bool32 y, bool32 z, bool32 w ) {
     return { x, y, z, w };
 }
-bvec4 bvec4::create( bool32 boolean ) {
+SMATH_INLINE bvec4 bvec4::create( bool32 boolean ) {
     return { boolean, boolean, boolean, boolean };
 }
-bvec4 bvec4::create( const vec4& v ) {
+SMATH_INLINE bvec4 bvec4::create( const vec4& v ) {
     return { (bool)v.x, (bool)v.y, (bool)v.z, (bool)v.w };
 }
-bvec4 bvec4::create( const ivec4& v ) {
+SMATH_INLINE bvec4 bvec4::create( const ivec4& v ) {
     return { (bool)v.x, (bool)v.y, (bool)v.z, (bool)v.w };
 }
-bvec4 bvec4::create( const bvec2& v ) {
+SMATH_INLINE bvec4 bvec4::create( const bvec2& v ) {
     return { v.x, v.y, false, false };
 }
-bvec4 bvec4::create( const bvec3& v ) {
+SMATH_INLINE bvec4 bvec4::create( const bvec3& v ) {
     return { v.x, v.y, v.z, false };
 }
-bool32* bvec4::ptr() { return &x; }
-const bool32* bvec4::ptr() const { return &x; }
-bvec4& bvec4::operator!() {
+SMATH_INLINE bool32* bvec4::ptr() { return &x; }
+SMATH_INLINE const bool32* bvec4::ptr() const { return &x; }
+SMATH_INLINE bvec4& bvec4::operator!() {
     *this = { !this->x, !this->y, !this->z, !this->w }; 
     return *this;
 }
-bool32& bvec4::operator[]( u32 index ) {
+SMATH_INLINE bool32& bvec4::operator[]( u32 index ) {
     return ptr()[index];
 }
-bool32 bvec4::operator[]( u32 index ) const {
+SMATH_INLINE bool32 bvec4::operator[]( u32 index ) const {
     return ptr()[index];
 }
-bool32 bvec4::operator==( const bvec4& rhs ) const {
+SMATH_INLINE bool32 bvec4::operator==( const bvec4& rhs ) const {
     return this->x == rhs.x && this->y == rhs.y && this->z == rhs.z && this->w == rhs.w;
 }
-bool32 bvec4::operator!=( const bvec4& rhs ) const {
+SMATH_INLINE bool32 bvec4::operator!=( const bvec4& rhs ) const {
     return !(*this == rhs);
 }
-bvec4 bvec4::operator>( const bvec4& rhs ) {
+SMATH_INLINE bvec4 bvec4::operator>( const bvec4& rhs ) {
     return {
         this->x > rhs.x,
         this->y > rhs.y,
@@ -2047,7 +1812,7 @@ bvec4 bvec4::operator>( const bvec4& rhs ) {
         this->w > rhs.w
     };
 }
-bvec4 bvec4::operator>=( const bvec4& rhs ) {
+SMATH_INLINE bvec4 bvec4::operator>=( const bvec4& rhs ) {
     return {
         this->x >= rhs.x,
         this->y >= rhs.y,
@@ -2055,7 +1820,7 @@ bvec4 bvec4::operator>=( const bvec4& rhs ) {
         this->w >= rhs.w
     };
 }
-bvec4 bvec4::operator<( const bvec4& rhs ) {
+SMATH_INLINE bvec4 bvec4::operator<( const bvec4& rhs ) {
     return {
         this->x < rhs.x,
         this->y < rhs.y,
@@ -2063,7 +1828,7 @@ bvec4 bvec4::operator<( const bvec4& rhs ) {
         this->w < rhs.w
     };
 }
-bvec4 bvec4::operator<=( const bvec4& rhs ) {
+SMATH_INLINE bvec4 bvec4::operator<=( const bvec4& rhs ) {
     return {
         this->x <= rhs.x,
         this->y <= rhs.y,
@@ -2071,19 +1836,19 @@ bvec4 bvec4::operator<=( const bvec4& rhs ) {
         this->w <= rhs.w
     };
 }
-bool32 horizontal_and( const bvec4& v ) {
+SMATH_INLINE bool32 horizontal_and( const bvec4& v ) {
     return v.x && v.y && v.z && v.w;
 }
-bool32 horizontal_or( const bvec4& v ) {
+SMATH_INLINE bool32 horizontal_or( const bvec4& v ) {
     return v.x || v.y || v.z || v.w;
 }
 
 // NOTE(alicia): quat
 
-quat quat::create( f32 w, f32 x, f32 y, f32 z ) {
+SMATH_INLINE quat quat::create( f32 w, f32 x, f32 y, f32 z ) {
     return { w, x, y, z };
 }
-quat quat::create( f32 theta, const vec3& axis ) {
+SMATH_INLINE quat quat::create( f32 theta, const vec3& axis ) {
     f32 half_theta = theta / 2.0f;
     f32 s = sin( half_theta );
 
@@ -2094,10 +1859,10 @@ quat quat::create( f32 theta, const vec3& axis ) {
         axis.z * s
     };
 }
-quat quat::create( const angle_axis& aa ) {
+SMATH_INLINE quat quat::create( const angle_axis& aa ) {
     return create( aa.theta, aa.axis );
 }
-quat quat::create( f32 pitch, f32 yaw, f32 roll ) {
+SMATH_INLINE quat quat::create( f32 pitch, f32 yaw, f32 roll ) {
     f32 half_x = pitch / 2.0f;
     f32 half_y = yaw   / 2.0f;
     f32 half_z = roll  / 2.0f;
@@ -2120,98 +1885,92 @@ quat quat::create( f32 pitch, f32 yaw, f32 roll ) {
         ( x_cos * y_cos * z_sin ) + ( x_sin * y_sin * z_cos )
     };
 }
-quat quat::create( const euler_angles& euler ) {
+SMATH_INLINE quat quat::create( const euler_angles& euler ) {
     return create( euler.pitch, euler.yaw, euler.roll );
 }
-f32* quat::ptr() { return &w; }
-const f32* quat::ptr() const { return &w; }
-f32& quat::operator[]( u32 index ) { return ptr()[index]; }
-f32 quat::operator[]( u32 index ) const { return ptr()[index]; }
-quat& quat::operator-() { return *this *= -1.0f; }
-bool32 quat::operator==( const quat& rhs ) const { return cmp( *this, rhs ); }
-bool32 quat::operator!=( const quat& rhs ) const { return !(*this == rhs); }
-quat& quat::operator+=( const quat& rhs ) {
+SMATH_INLINE f32* quat::ptr() { return &w; }
+SMATH_INLINE const f32* quat::ptr() const { return &w; }
+SMATH_INLINE f32& quat::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE f32 quat::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE quat& quat::operator-() { return *this *= -1.0f; }
+SMATH_INLINE bool32 quat::operator==( const quat& rhs ) const { return cmp( *this, rhs ); }
+SMATH_INLINE bool32 quat::operator!=( const quat& rhs ) const { return !(*this == rhs); }
+SMATH_INLINE quat& quat::operator+=( const quat& rhs ) {
     this->w += rhs.w;
     this->x += rhs.x;
     this->y += rhs.y;
     this->z += rhs.z;
     return *this;
 }
-quat& quat::operator-=( const quat& rhs ) {
+SMATH_INLINE quat& quat::operator-=( const quat& rhs ) {
     this->w -= rhs.w;
     this->x -= rhs.x;
     this->y -= rhs.y;
     this->z -= rhs.z;
     return *this;
 }
-quat& quat::operator*=( f32 rhs ) {
+SMATH_INLINE quat& quat::operator*=( f32 rhs ) {
     this->w *= rhs;
     this->x *= rhs;
     this->y *= rhs;
     this->z *= rhs;
     return *this;
 }
-quat& quat::operator/=( f32 rhs ) {
+SMATH_INLINE quat& quat::operator/=( f32 rhs ) {
     this->w /= rhs;
     this->x /= rhs;
     this->y /= rhs;
     this->z /= rhs;
     return *this;
 }
-quat operator+( const quat& lhs, const quat& rhs ) {
+SMATH_INLINE quat operator+( const quat& lhs, const quat& rhs ) {
     return quat(lhs) += rhs;
 }
-quat operator-( const quat& lhs, const quat& rhs ) {
+SMATH_INLINE quat operator-( const quat& lhs, const quat& rhs ) {
     return quat(lhs) -= rhs;
 }
-quat operator*( const quat& lhs, const quat& rhs ) {
-   using namespace simd;
+SMATH_INLINE quat operator*( const quat& lhs, const quat& rhs ) {
+    using namespace simd;
 
-    const lane4f _negate_first = lane4f( -1.0f, 1.0f, 1.0f, 1.0f );
+    const lane4f_t _negate_first = lane4f_set( -1.0f, 1.0f, 1.0f, 1.0f );
 
-    lane4f _a = lane4f( lhs.x, lhs.x, lhs.y, lhs.z );
-    lane4f _b = lane4f( rhs.x, rhs.w, rhs.w, rhs.w );
+    lane4f_t _a = lane4f_set( lhs.x, lhs.x, lhs.y, lhs.z );
+    lane4f_t _b = lane4f_set( rhs.x, rhs.w, rhs.w, rhs.w );
     _a = _a * _b;
 
-    _b = lane4f( lhs.y, lhs.y, lhs.z, lhs.x );
-    lane4f _c = lane4f( rhs.y, rhs.z, rhs.x, rhs.y );
-    _b = _b * _c;
-
-    _c = lane4f( lhs.z, lhs.z, lhs.x, lhs.y );
-    lane4f _d = lane4f( rhs.z, rhs.y, rhs.z, rhs.x );
-    _c = _c * _d;
+    _b = lane4f_set( lhs.y, lhs.y, lhs.z, lhs.x );
+    lane4f_t _c = lane4f_set( rhs.y, rhs.z, rhs.x, rhs.y );
 
-    _c = _c * _negate_first;
+    lane4f_t _d = lane4f_set( lhs.z, lhs.z, lhs.x, lhs.y );
+    lane4f_t _e = lane4f_set( rhs.z, rhs.y, rhs.z, rhs.x );
 
-    _d = _b - _c;
-    _a = _a + _d;
+    // b*c - (d*e * negate_first)
+    _d = _d * _negate_first;
+    _b = lane4f_fnmadd( _d, _e, _b * _c );
+    _a = ( _a + _b ) * _negate_first;
 
-    _a = _a * _negate_first;
-
-    lane4f _w = lane4f( lhs.w );
-    _b = lane4f( rhs.w, rhs.x, rhs.y, rhs.z );
-    _w = _w * _b;
+    lane4f_t _w = lane4f_set_scalar( lhs.w );
+    _b = lane4f_set( rhs.w, rhs.x, rhs.y, rhs.z );
 
     quat result;
-    store( result.ptr(), _w + _a );
+    lane4f_store_unaligned( lane4f_fmadd( _w, _b, _a ), result.ptr() );
     return result;
-
 }
-vec3 operator*( const quat& lhs, const vec3& rhs ) {
+SMATH_INLINE vec3 operator*( const quat& lhs, const vec3& rhs ) {
     vec3 qxyz = { lhs.x, lhs.y, lhs.z };
     vec3 t    = 2.0f * cross( qxyz, rhs );
     return rhs + t * lhs.w + cross( qxyz, t );
 }
-quat operator*( const quat& lhs, f32 rhs ) {
+SMATH_INLINE quat operator*( const quat& lhs, f32 rhs ) {
     return quat(lhs) *= rhs;
 }
-quat operator*( f32 lhs, const quat& rhs ) {
+SMATH_INLINE quat operator*( f32 lhs, const quat& rhs ) {
     return quat(rhs) *= lhs;
 }
-quat operator/( const quat& lhs, f32 rhs ) {
+SMATH_INLINE quat operator/( const quat& lhs, f32 rhs ) {
     return quat(lhs) /= rhs;
 }
-f32 sqr_mag( const quat& q ) {
+SMATH_INLINE f32 sqr_mag( const quat& q ) {
     vec4 result = {
         q.w * q.w,
         q.x * q.x,
@@ -2220,69 +1979,67 @@ f32 sqr_mag( const quat& q ) {
     };
     return horizontal_add( result );
 }
-f32 mag( const quat& q ) {
+SMATH_INLINE f32 mag( const quat& q ) {
     return sqrt( sqr_mag( q ) );
 }
-quat normalize( const quat& q ) {
+SMATH_INLINE quat normalize( const quat& q ) {
     f32 m = mag( q );
     return m < 0.0001f ? quat::identity() : q / m;
 }
-quat conjugate( const quat& q ) {
+SMATH_INLINE quat conjugate( const quat& q ) {
     quat r = q;
     r   = -r;
     r.w = -r.w;
     return r;
 }
-quat inverse( const quat& q ) {
+SMATH_INLINE quat inverse( const quat& q ) {
     return conjugate( q ) / sqr_mag( q );
 }
-f32 angle( const quat& a, const quat& b ) {
+SMATH_INLINE f32 angle( const quat& a, const quat& b ) {
     quat qd = inverse( a ) * b;
     return 2.0f * atan2( mag( vec3::create( qd.x, qd.y, qd.z ) ), qd.w );
 }
-f32 unsigned_angle( const quat& a, const quat& b ) {
+SMATH_INLINE f32 unsigned_angle( const quat& a, const quat& b ) {
     return internal::signed_angle_to_unsigned( angle( a, b ) );
 }
-f32 dot( const quat& lhs, const quat& rhs ) {
-    vec4 result = {
-        lhs.w * rhs.w,
-        lhs.x * rhs.x,
-        lhs.y * rhs.y,
-        lhs.z * rhs.z
-    };
-    return horizontal_add(result);
+SMATH_INLINE f32 dot( const quat& lhs, const quat& rhs ) {
+    using namespace simd;
+    return lane4f_dot4(
+        lane4f_load_unaligned( lhs.ptr() ),
+        lane4f_load_unaligned( rhs.ptr() ) );
 }
-quat lerp( const quat& a, const quat& b, f32 t ) {
+SMATH_INLINE quat lerp( const quat& a, const quat& b, f32 t ) {
     return normalize( ( 1.0f - t ) * a + b * t );
 }
-quat clamped_lerp( const quat& a, const quat& b, f32 t ) {
+SMATH_INLINE quat clamped_lerp( const quat& a, const quat& b, f32 t ) {
     return lerp( a, b, clamp01(t) );
 }
-quat slerp( const quat& a, const quat& b, f32 t ) {
+SMATH_INLINE quat slerp( const quat& a, const quat& b, f32 t ) {
     quat _b = b;
-    f32 theta = dot(a, b);
-    f32 cos_theta = cos( theta );
+    f32 cos_theta = dot(a, b);
     if( cos_theta < 0.0f ) {
         _b = -_b;
         cos_theta = -cos_theta;
     }
     if( cos_theta > 1.0f - F32::EPSILON ) {
-        return lerp( a, b, t );
+        return lerp( a, _b, t );
     } else {
-        return normalize(( sin( ( 1.0f - t ) * theta ) * a + sin( t * theta ) * _b ) / sin( theta ));
+        f32 theta   = acos( cos_theta );
+        f32 inv_sin = 1.0f / sqrt( ( 1.0f - cos_theta ) * ( 1.0f + cos_theta ) );
+        return ( sin( ( 1.0f - t ) * theta ) * inv_sin ) * a + ( sin( t * theta ) * inv_sin ) * _b;
     }
 }
-bool32 cmp( const quat& a, const quat& b ) {
+SMATH_INLINE bool32 cmp( const quat& a, const quat& b ) {
     return sqr_mag(a - b) < VEC_CMP_THRESHOLD;
 }
-euler_angles quat_to_euler( const quat& q ) {
+SMATH_INLINE euler_angles quat_to_euler( const quat& q ) {
     return {
         atan2( 2.0f * (( q.w * q.x ) + ( q.y * q.z )), 1.0f - 2.0f * ( ( q.x * q.x ) + ( q.y * q.y ) ) ),
         asin_real( 2.0f * (( q.w * q.y ) - ( q.z * q.x )) ),
         atan2( 2.0f * (( q.w * q.z ) + ( q.x * q.y )), 1.0f - 2.0f * ( ( q.y * q.y ) + ( q.z * q.z ) ) ),
     };
 }
-angle_axis quat_to_angle_axis( const quat& q ) {
+SMATH_INLINE angle_axis quat_to_angle_axis( const quat& q ) {
     f32 inv_w2_sqrt = sqrt(1.0f - (q.w * q.w));
     return {
         {
@@ -2296,67 +2053,67 @@ angle_axis quat_to_angle_axis( const quat& q ) {
 
 // NOTE(alicia): mat2
 
-mat2 mat2::create( f32 m00, f32 m01, f32 m10, f32 m11 ) {
+SMATH_INLINE mat2 mat2::create( f32 m00, f32 m01, f32 m10, f32 m11 ) {
     return {
         m00, m01,
         m10, m11
     };
 }
-mat2 mat2::create( const mat3& m ) {
+SMATH_INLINE mat2 mat2::create( const mat3& m ) {
     return {
         m[0], m[1],
         m[3], m[4]
     };
 }
-mat2 mat2::create( const mat4& m ) {
+SMATH_INLINE mat2 mat2::create( const mat4& m ) {
     return {
         m[0], m[1],
         m[4], m[5]
     };
 }
-f32* mat2::ptr() { return &_m00; }
-const f32* mat2::ptr() const { return &_m00; }
-f32& mat2::operator[]( u32 index ) {
+SMATH_INLINE f32* mat2::ptr() { return &_m00; }
+SMATH_INLINE const f32* mat2::ptr() const { return &_m00; }
+SMATH_INLINE f32& mat2::operator[]( u32 index ) {
     return ptr()[index];
 }
-f32 mat2::operator[]( u32 index ) const {
+SMATH_INLINE f32 mat2::operator[]( u32 index ) const {
     return ptr()[index];
 }
-vec2& mat2::column( u32 index ) {
+SMATH_INLINE vec2& mat2::column( u32 index ) {
     f32* flt = (f32*)this;
     return *(vec2*)&flt[index * 2];
 }
-const vec2& mat2::column( u32 index ) const {
+SMATH_INLINE const vec2& mat2::column( u32 index ) const {
     const f32* flt = (const f32*)this;
     return *(vec2*)&flt[index * 2];
 }
-vec2 mat2::row( u32 index ) const {
+SMATH_INLINE vec2 mat2::row( u32 index ) const {
     return {
         (*this)[index],
         (*this)[index + 2]
     };
 }
-mat2& mat2::operator+=( const mat2& rhs ) {
+SMATH_INLINE mat2& mat2::operator+=( const mat2& rhs ) {
     this->_col0 += rhs._col0;
     this->_col1 += rhs._col1;
     return *this;
 }
-mat2& mat2::operator-=( const mat2& rhs ) {
+SMATH_INLINE mat2& mat2::operator-=( const mat2& rhs ) {
     this->_col0 -= rhs._col0;
     this->_col1 -= rhs._col1;
     return *this;
 }
-mat2& mat2::operator*=( f32 rhs ) {
+SMATH_INLINE mat2& mat2::operator*=( f32 rhs ) {
     this->_col0 *= rhs;
     this->_col1 *= rhs;
     return *this;
 }
-mat2& mat2::operator/=( f32 rhs ) {
+SMATH_INLINE mat2& mat2::operator/=( f32 rhs ) {
     this->_col0 /= rhs;
     this->_col1 /= rhs;
     return *this;
 }
-mat2& mat2::operator*=( const mat2& rhs ) {
+SMATH_INLINE mat2& mat2::operator*=( const mat2& rhs ) {
     *this = {
         ((*this)[0] * rhs[0]) + ((*this)[2] * rhs[1]),
         ((*this)[1] * rhs[0]) + ((*this)[3] * rhs[1]),
@@ -2366,43 +2123,43 @@ mat2& mat2::operator*=( const mat2& rhs ) {
     };
     return *this;
 }
-f32& mat2::nm( u32 row, u32 column ) {
+SMATH_INLINE f32& mat2::nm( u32 row, u32 column ) {
     return (*this)[row + (column * 2)];
 }
-f32 mat2::nm( u32 row, u32 column ) const {
+SMATH_INLINE f32 mat2::nm( u32 row, u32 column ) const {
     return (*this)[row + (column * 2)];
 }
-mat2 operator+( const mat2& lhs, const mat2& rhs ) {
+SMATH_INLINE mat2 operator+( const mat2& lhs, const mat2& rhs ) {
     return mat2(lhs) += rhs;
 }
-mat2 operator-( const mat2& lhs, const mat2& rhs ) {
+SMATH_INLINE mat2 operator-( const mat2& lhs, const mat2& rhs ) {
     return mat2(lhs) -= rhs;
 }
-mat2 operator*( const mat2& lhs, f32 rhs ) {
+SMATH_INLINE mat2 operator*( const mat2& lhs, f32 rhs ) {
     return mat2(lhs) *= rhs;
 }
-mat2 operator*( f32 lhs, const mat2& rhs ) {
+SMATH_INLINE mat2 operator*( f32 lhs, const mat2& rhs ) {
     return mat2(rhs) *= lhs;
 }
-mat2 operator/( const mat2& lhs, f32 rhs ) {
+SMATH_INLINE mat2 operator/( const mat2& lhs, f32 rhs ) {
     return mat2(lhs) /= rhs;
 }
-mat2 operator*( const mat2& lhs, const mat2& rhs ) {
+SMATH_INLINE mat2 operator*( const mat2& lhs, const mat2& rhs ) {
     return mat2(lhs) *= rhs;
 }
-mat2 transpose( const mat2& m ) {
+SMATH_INLINE mat2 transpose( const mat2& m ) {
     return {
         m[0], m[2],
         m[1], m[3]
     };
 }
-f32 determinant( const mat2& m ) {
+SMATH_INLINE f32 determinant( const mat2& m ) {
     return ( m[0] * m[3] ) - ( m[2] * m[1] );
 }
 
 // NOTE(alicia): mat3
 
-mat3 mat3::create(
+SMATH_INLINE mat3 mat3::create(
     f32 m00, f32 m01, f32 m02,
     f32 m10, f32 m11, f32 m12,
     f32 m20, f32 m21, f32 m22
@@ -2413,70 +2170,70 @@ mat3 mat3::create(
         m20, m21, m22
     };
 }
-mat3 mat3::create( const mat2& m ) {
+SMATH_INLINE mat3 mat3::create( const mat2& m ) {
     return {
         m[0], m[1], 0.0f,
         m[2], m[3], 0.0f,
         0.0f, 0.0f, 0.0f
     };
 }
-mat3 mat3::create( const mat4& m ) {
+SMATH_INLINE mat3 mat3::create( const mat4& m ) {
     return {
         m[0], m[1], m[2],
         m[4], m[5], m[6],
         m[8], m[9], m[10]
     };
 }
-f32* mat3::ptr() { return &_m00; }
-const f32* mat3::ptr() const { return &_m00; }
-f32& mat3::operator[]( u32 index ) { return ptr()[index]; }
-f32 mat3::operator[]( u32 index ) const { return ptr()[index]; }
-f32& mat3::nm( u32 row, u32 column ) {
+SMATH_INLINE f32* mat3::ptr() { return &_m00; }
+SMATH_INLINE const f32* mat3::ptr() const { return &_m00; }
+SMATH_INLINE f32& mat3::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE f32 mat3::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE f32& mat3::nm( u32 row, u32 column ) {
     return (*this)[row + (column * 3)];
 }
-f32 mat3::nm( u32 row, u32 column ) const {
+SMATH_INLINE f32 mat3::nm( u32 row, u32 column ) const {
     return (*this)[row + (column * 3)];
 }
-vec3& mat3::column( u32 index ) {
+SMATH_INLINE vec3& mat3::column( u32 index ) {
     f32* flt = (f32*)this;
     return *(vec3*)&flt[index * 3];
 }
-const vec3& mat3::column( u32 index ) const {
+SMATH_INLINE const vec3& mat3::column( u32 index ) const {
     const f32* flt = (const f32*)this;
     return *(vec3*)&flt[index * 3];
 }
-vec3 mat3::row( u32 index ) const {
+SMATH_INLINE vec3 mat3::row( u32 index ) const {
     return {
         (*this)[index],
         (*this)[index + 3],
         (*this)[index + 6]
     };
 }
-mat3& mat3::operator+=( const mat3& rhs ) {
+SMATH_INLINE mat3& mat3::operator+=( const mat3& rhs ) {
     this->_col0 += rhs._col0;
     this->_col1 += rhs._col1;
     this->_col2 += rhs._col2;
     return *this;
 }
-mat3& mat3::operator-=( const mat3& rhs ) {
+SMATH_INLINE mat3& mat3::operator-=( const mat3& rhs ) {
     this->_col0 -= rhs._col0;
     this->_col1 -= rhs._col1;
     this->_col2 -= rhs._col2;
     return *this;
 }
-mat3& mat3::operator*=( f32 rhs ) {
+SMATH_INLINE mat3& mat3::operator*=( f32 rhs ) {
     this->_col0 *= rhs;
     this->_col1 *= rhs;
     this->_col2 *= rhs;
     return *this;
 }
-mat3& mat3::operator/=( f32 rhs ) {
+SMATH_INLINE mat3& mat3::operator/=( f32 rhs ) {
     this->_col0 /= rhs;
     this->_col1 /= rhs;
     this->_col2 /= rhs;
     return *this;
 }
-mat3& mat3::operator*=( const mat3& rhs ) {
+SMATH_INLINE mat3& mat3::operator*=( const mat3& rhs ) {
     *this = {
         // column - 0
         ( (*this)[0] * rhs[0] ) + ( (*this)[3] * rhs[1] ) + ( (*this)[6] * rhs[2] ),
@@ -2493,32 +2250,32 @@ mat3& mat3::operator*=( const mat3& rhs ) {
     };
     return *this;
 }
-mat3 operator+( const mat3& lhs, const mat3& rhs ) {
+SMATH_INLINE mat3 operator+( const mat3& lhs, const mat3& rhs ) {
     return mat3(lhs) += rhs;
 }
-mat3 operator-( const mat3& lhs, const mat3& rhs ) {
+SMATH_INLINE mat3 operator-( const mat3& lhs, const mat3& rhs ) {
     return mat3(lhs) -= rhs;
 }
-mat3 operator*( const mat3& lhs, f32 rhs ) {
+SMATH_INLINE mat3 operator*( const mat3& lhs, f32 rhs ) {
     return mat3(lhs) *= rhs;
 }
-mat3 operator*( f32 lhs, const mat3& rhs ) {
+SMATH_INLINE mat3 operator*( f32 lhs, const mat3& rhs ) {
     return mat3(rhs) *= lhs;
 }
-mat3 operator/( const mat3& lhs, f32 rhs ) {
+SMATH_INLINE mat3 operator/( const mat3& lhs, f32 rhs ) {
     return mat3(lhs) /= rhs;
 }
-mat3 operator*( const mat3& lhs, const mat3& rhs ) {
+SMATH_INLINE mat3 operator*( const mat3& lhs, const mat3& rhs ) {
     return mat3(lhs) *= rhs;
 }
-mat3 transpose( const mat3& m ) {
+SMATH_INLINE mat3 transpose( const mat3& m ) {
     return {
         m[0], m[3], m[6],
         m[1], m[4], m[7],
         m[2], m[5], m[8]
     };
 }
-f32 determinant( const mat3& m ) {
+SMATH_INLINE f32 determinant( const mat3& m ) {
     return
      ( m[0] * ( ( m[4] * m[8] ) - ( m[7] * m[5] ) ) ) +
     -( m[3] * ( ( m[1] * m[8] ) - ( m[7] * m[2] ) ) ) +
@@ -2527,7 +2284,7 @@ f32 determinant( const mat3& m ) {
 
 // NOTE(alicia): mat4
 
-mat4 mat4::create(
+SMATH_INLINE mat4 mat4::create(
     f32 m00, f32 m01, f32 m02, f32 m03,
     f32 m10, f32 m11, f32 m12, f32 m13,
     f32 m20, f32 m21, f32 m22, f32 m23,
@@ -2540,7 +2297,7 @@ mat4 mat4::create(
         m30, m31, m32, m33
     };
 }
-mat4 mat4::create( const mat2& m ) {
+SMATH_INLINE mat4 mat4::create( const mat2& m ) {
     return {
         m[0], m[1], 0.0f, 0.0f,
         m[2], m[3], 0.0f, 0.0f,
@@ -2548,7 +2305,7 @@ mat4 mat4::create( const mat2& m ) {
         0.0f, 0.0f, 0.0f, 0.0f
     };
 }
-mat4 mat4::create( const mat3& m ) {
+SMATH_INLINE mat4 mat4::create( const mat3& m ) {
     return {
         m[0], m[1], m[2], 0.0f,
         m[3], m[4], m[5], 0.0f,
@@ -2556,7 +2313,24 @@ mat4 mat4::create( const mat3& m ) {
         0.0f, 0.0f, 0.0f, 0.0f
     };
 }
-mat4 mat4::look_at( const vec3& position, const vec3& target, const vec3& up ) {
+SMATH_INLINE mat4 mat4::create( const mat3x4& m ) {
+    using namespace simd;
+    lane4f_t rows[4] = {
+        lane4f_load_unaligned( m._row0.ptr() ),
+        lane4f_load_unaligned( m._row1.ptr() ),
+        lane4f_load_unaligned( m._row2.ptr() ),
+        lane4f_set( 0.0f, 0.0f, 0.0f, 1.0f )
+    };
+    lane4f_transpose4x4( rows );
+
+    mat4 result;
+    lane4f_store_unaligned( rows[0], result._col0.ptr() );
+    lane4f_store_unaligned( rows[1], result._col1.ptr() );
+    lane4f_store_unaligned( rows[2], result._col2.ptr() );
+    lane4f_store_unaligned( rows[3], result._col3.ptr() );
+    return result;
+}
+SMATH_INLINE mat4 mat4::look_at( const vec3& position, const vec3& target, const vec3& up ) {
     vec3 z = normalize( target - position );
     vec3 x = cross( z, up );
     vec3 y = cross( x, z );
@@ -2573,7 +2347,7 @@ mat4 mat4::look_at( const vec3& position, const vec3& target, const vec3& up ) {
         1.0f
     };
 }
-mat4 mat4::ortho(
+SMATH_INLINE mat4 mat4::ortho(
     f32 left, f32 right,
     f32 bottom, f32 top,
     f32 _near, f32 _far
@@ -2587,34 +2361,34 @@ mat4 mat4::ortho(
     result[14] = -( _far + _near ) / ( _far - _near );
     return result;
 }
-mat4 mat4::ortho(
+SMATH_INLINE mat4 mat4::ortho(
     f32 left, f32 right,
     f32 bottom, f32 top
 ) {
     return ortho( left, right, bottom, top, -1.0f, 1.0f );
 }
-mat4 mat4::view2d( const vec2& position ) {
+SMATH_INLINE mat4 mat4::view2d( const vec2& position ) {
     return mat4::look_at(
         vec3::create(position) + vec3::forward(),
         vec3::create(position),
         vec3::up()
     );
 }
-mat4 mat4::projection2d( f32 aspect_ratio, f32 scale ) {
+SMATH_INLINE mat4 mat4::projection2d( f32 aspect_ratio, f32 scale ) {
     f32 scaled_aspect_ratio = aspect_ratio * scale;
     return mat4::ortho(
         -scaled_aspect_ratio, scaled_aspect_ratio,
         -scale, scale
     );
 }
-mat4 mat4::projection2d( f32 aspect_ratio, const vec2& scale ) {
+SMATH_INLINE mat4 mat4::projection2d( f32 aspect_ratio, const vec2& scale ) {
     f32 scaled_aspect_ratio = aspect_ratio * scale.x;
     return mat4::ortho(
         -scaled_aspect_ratio, scaled_aspect_ratio,
         -scale.y, scale.y
     );
 }
-mat4 mat4::perspective( f32 fov, f32 aspect, f32 _near, f32 _far ) {
+SMATH_INLINE mat4 mat4::perspective( f32 fov, f32 aspect, f32 _near, f32 _far ) {
     mat4 result = {};
 
     f32 half_fov_tan   = tan( fov / 2.0f );
@@ -2627,23 +2401,23 @@ mat4 mat4::perspective( f32 fov, f32 aspect, f32 _near, f32 _far ) {
 
     return result;
 }
-mat4 mat4::translate( const vec3& translation ) {
+SMATH_INLINE mat4 mat4::translate( const vec3& translation ) {
     mat4 result = identity();
     result[12] = translation.x;
     result[13] = translation.y;
     result[14] = translation.z;
     return result;
 }
-mat4 mat4::translate( f32 x, f32 y, f32 z ) {
+SMATH_INLINE mat4 mat4::translate( f32 x, f32 y, f32 z ) {
     return translate( { x, y, z } );
 }
-mat4 mat4::translate2d( const vec2& translation ) {
+SMATH_INLINE mat4 mat4::translate2d( const vec2& translation ) {
     return mat4::translate( vec3::create( translation ) );
 }
-mat4 mat4::translate2d( f32 x, f32 y ) {
+SMATH_INLINE mat4 mat4::translate2d( f32 x, f32 y ) {
     return mat4::translate( x, y, 0.0f );
 }
-mat4 mat4::rotate_pitch( f32 pitch ) {
+SMATH_INLINE mat4 mat4::rotate_pitch( f32 pitch ) {
     mat4 result = identity();
 
     f32 _cos = cos(pitch);
@@ -2656,7 +2430,7 @@ mat4 mat4::rotate_pitch( f32 pitch ) {
 
     return result;
 }
-mat4 mat4::rotate_yaw( f32 yaw ) {
+SMATH_INLINE mat4 mat4::rotate_yaw( f32 yaw ) {
     mat4 result = identity();
 
     f32 _cos = cos(yaw);
@@ -2669,7 +2443,7 @@ mat4 mat4::rotate_yaw( f32 yaw ) {
 
     return result;
 }
-mat4 mat4::rotate_roll( f32 roll ) {
+SMATH_INLINE mat4 mat4::rotate_roll( f32 roll ) {
     mat4 result = identity();
 
     f32 _cos = cos(roll);
@@ -2682,12 +2456,12 @@ mat4 mat4::rotate_roll( f32 roll ) {
 
     return result;
 }
-mat4 mat4::rotate( const euler_angles& rotation ) {
+SMATH_INLINE mat4 mat4::rotate( const euler_angles& rotation ) {
     return rotate_pitch( rotation.pitch ) *
         rotate_yaw( rotation.yaw ) *
         rotate_roll( rotation.roll );
 }
-mat4 mat4::rotate( const quat& rotation ) {
+SMATH_INLINE mat4 mat4::rotate( const quat& rotation ) {
     mat4 result = identity();
 
     f32 _2x2 = 2.0f * (rotation.x * rotation.x);
@@ -2715,10 +2489,10 @@ mat4 mat4::rotate( const quat& rotation ) {
 
     return result;
 }
-mat4 mat4::rotate2d( f32 theta ) {
+SMATH_INLINE mat4 mat4::rotate2d( f32 theta ) {
     return mat4::rotate_roll( theta );
 }
-mat4 mat4::scale( const vec3& scale ) {
+SMATH_INLINE mat4 mat4::scale( const vec3& scale ) {
     mat4 result = identity();
 
     result[0]  = scale.x;
@@ -2727,16 +2501,16 @@ mat4 mat4::scale( const vec3& scale ) {
 
     return result;
 }
-mat4 mat4::scale( f32 x, f32 y, f32 z ) {
+SMATH_INLINE mat4 mat4::scale( f32 x, f32 y, f32 z ) {
     return mat4::scale( vec3::create( x, y, z ) );
 }
-mat4 mat4::scale2d( const vec2& scale ) {
+SMATH_INLINE mat4 mat4::scale2d( const vec2& scale ) {
     return mat4::scale( scale.x, scale.y, 1.0f );
 }
-mat4 mat4::scale2d( f32 x, f32 y ) {
+SMATH_INLINE mat4 mat4::scale2d( f32 x, f32 y ) {
     return mat4::scale( x, y, 1.0f );
 }
-mat4 mat4::transform(
+SMATH_INLINE mat4 mat4::transform(
     const vec3& translation,
     const quat& rotation,
     const vec3& scale
@@ -2745,7 +2519,7 @@ mat4 mat4::transform(
         mat4::rotate( rotation ) *
         mat4::scale( scale );
 }
-mat4 mat4::transform(
+SMATH_INLINE mat4 mat4::transform(
     const vec3& translation,
     const euler_angles& rotation,
     const vec3& scale
@@ -2754,7 +2528,7 @@ mat4 mat4::transform(
         mat4::rotate( rotation ) *
         mat4::scale( scale );
 }
-mat4 mat4::transform2d(
+SMATH_INLINE mat4 mat4::transform2d(
     const vec2& translation,
     f32 rotation,
     const vec2& scale
@@ -2763,19 +2537,19 @@ mat4 mat4::transform2d(
         mat4::rotate2d( rotation ) *
         mat4::scale2d( scale );
 }
-f32* mat4::ptr() { return &_m00; }
-const f32* mat4::ptr() const { return &_m00; }
-f32& mat4::operator[]( u32 index ) { return ptr()[index]; }
-f32 mat4::operator[]( u32 index ) const { return ptr()[index]; }
-vec4& mat4::column( u32 index ) {
+SMATH_INLINE f32* mat4::ptr() { return &_m00; }
+SMATH_INLINE const f32* mat4::ptr() const { return &_m00; }
+SMATH_INLINE f32& mat4::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE f32 mat4::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE vec4& mat4::column( u32 index ) {
     f32* flt = (f32*)this;
     return *(vec4*)&flt[index * 4];
 }
-const vec4& mat4::column( u32 index ) const {
+SMATH_INLINE const vec4& mat4::column( u32 index ) const {
     const f32* flt = (const f32*)this;
     return *(vec4*)&flt[index * 4];
 }
-vec4 mat4::row( u32 index ) const {
+SMATH_INLINE vec4 mat4::row( u32 index ) const {
     return {
         (*this)[index],
         (*this)[index + 4],
@@ -2783,246 +2557,154 @@ vec4 mat4::row( u32 index ) const {
         (*this)[index + 12]
     };
 }
-f32& mat4::nm( u32 row, u32 column ) {
+SMATH_INLINE f32& mat4::nm( u32 row, u32 column ) {
     return (*this)[row + (column * 4)];
 }
-f32 mat4::nm( u32 row, u32 column ) const {
+SMATH_INLINE f32 mat4::nm( u32 row, u32 column ) const {
     return (*this)[row + (column * 4)];
 }
-mat4& mat4::operator+=( const mat4& rhs ) {
+SMATH_INLINE mat4& mat4::operator+=( const mat4& rhs ) {
     using namespace simd;
-    lane4f _lhs0, _lhs1, _lhs2, _lhs3;
-    lane4f _rhs0, _rhs1, _rhs2, _rhs3;
-
-    _lhs0 = lane4f( this->_col0.ptr() );
-    _lhs1 = lane4f( this->_col1.ptr() );
-    _lhs2 = lane4f( this->_col2.ptr() );
-    _lhs3 = lane4f( this->_col3.ptr() );
-
-    _rhs0 = lane4f( rhs._col0.ptr() );
-    _rhs1 = lane4f( rhs._col1.ptr() );
-    _rhs2 = lane4f( rhs._col2.ptr() );
-    _rhs3 = lane4f( rhs._col3.ptr() );
-
-    mat4 result;
-    store( result._col0.ptr(), _lhs0 + _rhs0 );
-    store( result._col1.ptr(), _lhs1 + _rhs1 );
-    store( result._col2.ptr(), _lhs2 + _rhs2 );
-    store( result._col3.ptr(), _lhs3 + _rhs3 );
-    *this = result;
+    lane4f_t _lhs0, _lhs1, _lhs2, _lhs3;
+    lane4f_t _rhs0, _rhs1, _rhs2, _rhs3;
+
+    _lhs0 = lane4f_load_unaligned( this->_col0.ptr() );
+    _lhs1 = lane4f_load_unaligned( this->_col1.ptr() );
+    _lhs2 = lane4f_load_unaligned( this->_col2.ptr() );
+    _lhs3 = lane4f_load_unaligned( this->_col3.ptr() );
+
+    _rhs0 = lane4f_load_unaligned( rhs._col0.ptr() );
+    _rhs1 = lane4f_load_unaligned( rhs._col1.ptr() );
+    _rhs2 = lane4f_load_unaligned( rhs._col2.ptr() );
+    _rhs3 = lane4f_load_unaligned( rhs._col3.ptr() );
+
+    lane4f_store_unaligned( lane4f_add( _lhs0, _rhs0 ), this->_col0.ptr() );
+    lane4f_store_unaligned( lane4f_add( _lhs1, _rhs1 ), this->_col1.ptr() );
+    lane4f_store_unaligned( lane4f_add( _lhs2, _rhs2 ), this->_col2.ptr() );
+    lane4f_store_unaligned( lane4f_add( _lhs3, _rhs3 ), this->_col3.ptr() );
     return *this;
 }
-mat4& mat4::operator-=( const mat4& rhs ) {
+SMATH_INLINE mat4& mat4::operator-=( const mat4& rhs ) {
     using namespace simd;
-    lane4f _lhs0, _lhs1, _lhs2, _lhs3;
-    lane4f _rhs0, _rhs1, _rhs2, _rhs3;
-
-    _lhs0 = lane4f( this->_col0.ptr() );
-    _lhs1 = lane4f( this->_col1.ptr() );
-    _lhs2 = lane4f( this->_col2.ptr() );
-    _lhs3 = lane4f( this->_col3.ptr() );
-
-    _rhs0 = lane4f( rhs._col0.ptr() );
-    _rhs1 = lane4f( rhs._col1.ptr() );
-    _rhs2 = lane4f( rhs._col2.ptr() );
-    _rhs3 = lane4f( rhs._col3.ptr() );
-
-    mat4 result;
-    store( result._col0.ptr(), _lhs0 - _rhs0 );
-    store( result._col1.ptr(), _lhs1 - _rhs1 );
-    store( result._col2.ptr(), _lhs2 - _rhs2 );
-    store( result._col3.ptr(), _lhs3 - _rhs3 );
-    *this = result;
+    lane4f_t _lhs0, _lhs1, _lhs2, _lhs3;
+    lane4f_t _rhs0, _rhs1, _rhs2, _rhs3;
+
+    _lhs0 = lane4f_load_unaligned( this->_col0.ptr() );
+    _lhs1 = lane4f_load_unaligned( this->_col1.ptr() );
+    _lhs2 = lane4f_load_unaligned( this->_col2.ptr() );
+    _lhs3 = lane4f_load_unaligned( this->_col3.ptr() );
+
+    _rhs0 = lane4f_load_unaligned( rhs._col0.ptr() );
+    _rhs1 = lane4f_load_unaligned( rhs._col1.ptr() );
+    _rhs2 = lane4f_load_unaligned( rhs._col2.ptr() );
+    _rhs3 = lane4f_load_unaligned( rhs._col3.ptr() );
+
+    lane4f_store_unaligned( lane4f_sub( _lhs0, _rhs0 ), this->_col0.ptr() );
+    lane4f_store_unaligned( lane4f_sub( _lhs1, _rhs1 ), this->_col1.ptr() );
+    lane4f_store_unaligned( lane4f_sub( _lhs2, _rhs2 ), this->_col2.ptr() );
+    lane4f_store_unaligned( lane4f_sub( _lhs3, _rhs3 ), this->_col3.ptr() );
     return *this;
 }
-mat4& mat4::operator*=( f32 rhs ) {
+SMATH_INLINE mat4& mat4::operator*=( f32 rhs ) {
     using namespace simd;
-    lane4f _lhs0, _lhs1, _lhs2, _lhs3;
-    lane4f _rhs;
+    lane4f_t _lhs0, _lhs1, _lhs2, _lhs3;
+    lane4f_t _rhs;
 
-    _lhs0 = lane4f( this->_col0.ptr() );
-    _lhs1 = lane4f( this->_col1.ptr() );
-    _lhs2 = lane4f( this->_col2.ptr() );
-    _lhs3 = lane4f( this->_col3.ptr() );
+    _lhs0 = lane4f_load_unaligned( this->_col0.ptr() );
+    _lhs1 = lane4f_load_unaligned( this->_col1.ptr() );
+    _lhs2 = lane4f_load_unaligned( this->_col2.ptr() );
+    _lhs3 = lane4f_load_unaligned( this->_col3.ptr() );
 
-    _rhs = lane4f( rhs );
+    _rhs = lane4f_set_scalar( rhs );
 
-    mat4 result;
-    store( result._col0.ptr(), _lhs0 * _rhs );
-    store( result._col1.ptr(), _lhs1 * _rhs );
-    store( result._col2.ptr(), _lhs2 * _rhs );
-    store( result._col3.ptr(), _lhs3 * _rhs );
-    *this = result;
+    lane4f_store_unaligned( lane4f_mul( _lhs0, _rhs ), this->_col0.ptr() );
+    lane4f_store_unaligned( lane4f_mul( _lhs1, _rhs ), this->_col1.ptr() );
+    lane4f_store_unaligned( lane4f_mul( _lhs2, _rhs ), this->_col2.ptr() );
+    lane4f_store_unaligned( lane4f_mul( _lhs3, _rhs ), this->_col3.ptr() );
     return *this;
 }
-mat4& mat4::operator/=( f32 rhs ) {
+SMATH_INLINE mat4& mat4::operator/=( f32 rhs ) {
     using namespace simd;
-    lane4f _lhs0, _lhs1, _lhs2, _lhs3;
-    lane4f _rhs;
+    lane4f_t _lhs0, _lhs1, _lhs2, _lhs3;
+    lane4f_t _rhs;
 
-    _lhs0 = lane4f( this->_col0.ptr() );
-    _lhs1 = lane4f( this->_col1.ptr() );
-    _lhs2 = lane4f( this->_col2.ptr() );
-    _lhs3 = lane4f( this->_col3.ptr() );
+    _lhs0 = lane4f_load_unaligned( this->_col0.ptr() );
+    _lhs1 = lane4f_load_unaligned( this->_col1.ptr() );
+    _lhs2 = lane4f_load_unaligned( this->_col2.ptr() );
+    _lhs3 = lane4f_load_unaligned( this->_col3.ptr() );
 
-    _rhs = lane4f( rhs );
+    _rhs = lane4f_set_scalar( rhs );
 
-    mat4 result;
-    store( result._col0.ptr(), _lhs0 / _rhs );
-    store( result._col1.ptr(), _lhs1 / _rhs );
-    store( result._col2.ptr(), _lhs2 / _rhs );
-    store( result._col3.ptr(), _lhs3 / _rhs );
-    *this = result;
+    lane4f_store_unaligned( lane4f_div( _lhs0, _rhs ), this->_col0.ptr() );
+    lane4f_store_unaligned( lane4f_div( _lhs1, _rhs ), this->_col1.ptr() );
+    lane4f_store_unaligned( lane4f_div( _lhs2, _rhs ), this->_col2.ptr() );
+    lane4f_store_unaligned( lane4f_div( _lhs3, _rhs ), this->_col3.ptr() );
     return *this;
 }
-mat4& mat4::operator*=( const mat4& rhs ) {
+SMATH_INLINE mat4& mat4::operator*=( const mat4& rhs ) {
     using namespace simd;
-    const u32 COLUMN_LENGTH = 4;
-
-    // TODO(alicia): see if this can't be made even faster
-
-    mat4 result = {};
-
-    lane4f _a, _b, _c;
-
-    u32 col = 0;
-    u32 row = 0;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 1;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 2;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 3;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    col = 1;
-    row = 0;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 1;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 2;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 3;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    col = 2;
-    row = 0;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 1;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 2;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 3;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    col = 3;
-    row = 0;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 1;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 2;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-    row = 3;
-    _a = lane4f( &(*this)[ row * COLUMN_LENGTH ] );
-    _b = _a * lane4f( rhs[ (col * COLUMN_LENGTH) + row ] );
-    _c = lane4f( &result[  col * COLUMN_LENGTH ] );
-    store( &result[ col * COLUMN_LENGTH ], _b + _c );
-
-
-    *this = result;
+    lane4f_t _lhs0, _lhs1, _lhs2, _lhs3;
+
+    _lhs0 = lane4f_load_unaligned( this->_col0.ptr() );
+    _lhs1 = lane4f_load_unaligned( this->_col1.ptr() );
+    _lhs2 = lane4f_load_unaligned( this->_col2.ptr() );
+    _lhs3 = lane4f_load_unaligned( this->_col3.ptr() );
+
+    // NOTE(alicia): each result column is a linear combination
+    // of lhs columns weighted by the matching rhs column
+    for( u32 col = 0; col < 4; ++col ) {
+        const f32* _rhs = rhs.ptr() + ( col * 4 );
+        lane4f_t _result = lane4f_mul( _lhs0, lane4f_set_scalar( _rhs[0] ) );
+        _result = lane4f_fmadd( _lhs1, lane4f_set_scalar( _rhs[1] ), _result );
+        _result = lane4f_fmadd( _lhs2, lane4f_set_scalar( _rhs[2] ), _result );
+        _result = lane4f_fmadd( _lhs3, lane4f_set_scalar( _rhs[3] ), _result );
+        // NOTE(alicia): lhs columns are already in registers so
+        // this is safe even when rhs aliases *this
+        lane4f_store_unaligned( _result, this->ptr() + ( col * 4 ) );
+    }
     return *this;
 }
-mat4 operator+( const mat4& lhs, const mat4& rhs ) {
+SMATH_INLINE mat4 operator+( const mat4& lhs, const mat4& rhs ) {
     return mat4(lhs) += rhs;
 }
-mat4 operator-( const mat4& lhs, const mat4& rhs ) {
+SMATH_INLINE mat4 operator-( const mat4& lhs, const mat4& rhs ) {
     return mat4(lhs) -= rhs;
 }
-mat4 operator*( const mat4& lhs, f32 rhs ) {
+SMATH_INLINE mat4 operator*( const mat4& lhs, f32 rhs ) {
     return mat4(lhs) *= rhs;
 }
-mat4 operator/( const mat4& lhs, f32 rhs ) {
+SMATH_INLINE mat4 operator/( const mat4& lhs, f32 rhs ) {
     return mat4(lhs) /= rhs;
 }
-mat4 operator*( const mat4& lhs, const mat4& rhs ) {
+SMATH_INLINE mat4 operator*( const mat4& lhs, const mat4& rhs ) {
     return mat4(lhs) *= rhs;
 }
-mat4 operator*( f32 lhs, const mat4& rhs ) {
+SMATH_INLINE mat4 operator*( f32 lhs, const mat4& rhs ) {
     return rhs * lhs;
 }
-vec3 operator*( const mat4& lhs, const vec3& rhs ) {
+SMATH_INLINE vec3 operator*( const mat4& lhs, const vec3& rhs ) {
     return {
         ( lhs[0] * rhs[0] ) + ( lhs[4] * rhs[1] ) + ( lhs[8]  * rhs[2] ) + lhs[12],
         ( lhs[1] * rhs[0] ) + ( lhs[5] * rhs[1] ) + ( lhs[9]  * rhs[2] ) + lhs[13],
         ( lhs[2] * rhs[0] ) + ( lhs[6] * rhs[1] ) + ( lhs[10] * rhs[2] ) + lhs[14],
     };
 }
-vec4 operator*( const mat4& lhs, const vec4& rhs  ) {
-    return {
-        ( lhs[0] * rhs[0] ) + ( lhs[4] * rhs[1] ) + ( lhs[8]  * rhs[2] ) + ( lhs[12] * rhs[3] ),
-        ( lhs[1] * rhs[0] ) + ( lhs[5] * rhs[1] ) + ( lhs[9]  * rhs[2] ) + ( lhs[13] * rhs[3] ),
-        ( lhs[2] * rhs[0] ) + ( lhs[6] * rhs[1] ) + ( lhs[10] * rhs[2] ) + ( lhs[14] * rhs[3] ),
-        ( lhs[3] * rhs[0] ) + ( lhs[7] * rhs[1] ) + ( lhs[11] * rhs[2] ) + ( lhs[15] * rhs[3] ),
-    };
+SMATH_INLINE vec4 operator*( const mat4& lhs, const vec4& rhs  ) {
+    using namespace simd;
+    lane4f_t _result = lane4f_mul(
+        lane4f_load_unaligned( lhs._col0.ptr() ), lane4f_set_scalar( rhs.x ) );
+    _result = lane4f_fmadd(
+        lane4f_load_unaligned( lhs._col1.ptr() ), lane4f_set_scalar( rhs.y ), _result );
+    _result = lane4f_fmadd(
+        lane4f_load_unaligned( lhs._col2.ptr() ), lane4f_set_scalar( rhs.z ), _result );
+    _result = lane4f_fmadd(
+        lane4f_load_unaligned( lhs._col3.ptr() ), lane4f_set_scalar( rhs.w ), _result );
+
+    vec4 result;
+    lane4f_store_unaligned( _result, result.ptr() );
+    return result;
 }
-mat4 transpose( const mat4& m ) {
+SMATH_INLINE mat4 transpose( const mat4& m ) {
     return {
         m[0], m[4], m[8],  m[12],
         m[1], m[5], m[9],  m[13],
@@ -3030,7 +2712,7 @@ mat4 transpose( const mat4& m ) {
         m[3], m[7], m[11], m[15]
     };
 }
-mat3 submatrix( const mat4& m, u32 row, u32 column ) {
+SMATH_INLINE mat3 submatrix( const mat4& m, u32 row, u32 column ) {
     mat3 result;
     u32 i = 0;
     for( u32 _col = 0; _col < 4; ++_col ) {
@@ -3045,43 +2727,193 @@ mat3 submatrix( const mat4& m, u32 row, u32 column ) {
     }
     return result;
 }
-f32 minor( const mat4& m, u32 row, u32 column ) {
+SMATH_INLINE f32 minor( const mat4& m, u32 row, u32 column ) {
     return determinant( submatrix( m, row, column ) );
 }
-f32 cofactor( const mat4& m, u32 row, u32 column ) {
+SMATH_INLINE f32 cofactor( const mat4& m, u32 row, u32 column ) {
     f32 _minor = minor( m, row, column );
     return _minor * powi( -1.0f, ( row + 1 ) + ( column + 1 ) );
 }
-mat4 cofactor_matrix( const mat4& m ) {
-    return {
-        cofactor( m, 0, 0 ), cofactor( m, 0, 1 ), cofactor( m, 0, 2 ), cofactor( m, 0, 3 ),
-        cofactor( m, 1, 0 ), cofactor( m, 1, 1 ), cofactor( m, 1, 2 ), cofactor( m, 1, 3 ),
-        cofactor( m, 2, 0 ), cofactor( m, 2, 1 ), cofactor( m, 2, 2 ), cofactor( m, 2, 3 ),
-        cofactor( m, 3, 0 ), cofactor( m, 3, 1 ), cofactor( m, 3, 2 ), cofactor( m, 3, 3 )
-    };
+namespace internal {
+
+// NOTE(alicia): 2x2 sub-factors of rows p and q taken from columns 1-3,
+// { c2[p]*c3[q] - c3[p]*c2[q], same, c1[p]*c3[q] - c3[p]*c1[q], c1[p]*c2[q] - c2[p]*c1[q] }
+template<u32 p, u32 q>
+inline simd::lane4f_t mat4_subfactors(
+    simd::lane4f_t c1, simd::lane4f_t c2, simd::lane4f_t c3
+) {
+    using namespace simd;
+    lane4f_t _c3c2q = lane4f_shuffle2<q, q, q, q>( c3, c2 );
+    lane4f_t _c3c2p = lane4f_shuffle2<p, p, p, p>( c3, c2 );
+
+    lane4f_t _a = lane4f_shuffle2<p, p, p, p>( c2, c1 );
+    lane4f_t _b = lane4f_shuffle<0, 0, 0, 2>( _c3c2q );
+    lane4f_t _c = lane4f_shuffle<0, 0, 0, 2>( _c3c2p );
+    lane4f_t _d = lane4f_shuffle2<q, q, q, q>( c2, c1 );
+
+    return lane4f_fmsub( _a, _b, lane4f_mul( _c, _d ) );
 }
-mat4 adjoint( const mat4& m ) {
-    return transpose( cofactor_matrix( m ) );
+// NOTE(alicia): { c1[r], c0[r], c0[r], c0[r] }
+template<u32 r>
+inline simd::lane4f_t mat4_adjugate_row( simd::lane4f_t c0, simd::lane4f_t c1 ) {
+    using namespace simd;
+    return lane4f_shuffle<0, 2, 2, 2>( lane4f_shuffle2<r, r, r, r>( c1, c0 ) );
 }
-f32 determinant( const mat4& m ) {
-    return ( m[0]  * determinant( submatrix( m, 0, 0 ) ) ) -
-           ( m[4]  * determinant( submatrix( m, 0, 1 ) ) ) +
-           ( m[8]  * determinant( submatrix( m, 0, 2 ) ) ) -
-           ( m[12] * determinant( submatrix( m, 0, 3 ) ) );
+// NOTE(alicia): closed form adjugate from 2x2 sub-factors,
+// writes adjugate columns and returns determinant
+inline f32 mat4_adjugate( const mat4& m, simd::lane4f_t out_columns[4] ) {
+    using namespace simd;
+    lane4f_t _c0 = lane4f_load_unaligned( m._col0.ptr() );
+    lane4f_t _c1 = lane4f_load_unaligned( m._col1.ptr() );
+    lane4f_t _c2 = lane4f_load_unaligned( m._col2.ptr() );
+    lane4f_t _c3 = lane4f_load_unaligned( m._col3.ptr() );
+
+    lane4f_t _fac0 = mat4_subfactors<2, 3>( _c1, _c2, _c3 );
+    lane4f_t _fac1 = mat4_subfactors<1, 3>( _c1, _c2, _c3 );
+    lane4f_t _fac2 = mat4_subfactors<1, 2>( _c1, _c2, _c3 );
+    lane4f_t _fac3 = mat4_subfactors<0, 3>( _c1, _c2, _c3 );
+    lane4f_t _fac4 = mat4_subfactors<0, 2>( _c1, _c2, _c3 );
+    lane4f_t _fac5 = mat4_subfactors<0, 1>( _c1, _c2, _c3 );
+
+    lane4f_t _vec0 = mat4_adjugate_row<0>( _c0, _c1 );
+    lane4f_t _vec1 = mat4_adjugate_row<1>( _c0, _c1 );
+    lane4f_t _vec2 = mat4_adjugate_row<2>( _c0, _c1 );
+    lane4f_t _vec3 = mat4_adjugate_row<3>( _c0, _c1 );
+
+    lane4f_t _inv0 = lane4f_fmadd( _vec3, _fac2,
+        lane4f_fnmadd( _vec2, _fac1, lane4f_mul( _vec1, _fac0 ) ) );
+    lane4f_t _inv1 = lane4f_fmadd( _vec3, _fac4,
+        lane4f_fnmadd( _vec2, _fac3, lane4f_mul( _vec0, _fac0 ) ) );
+    lane4f_t _inv2 = lane4f_fmadd( _vec3, _fac5,
+        lane4f_fnmadd( _vec1, _fac3, lane4f_mul( _vec0, _fac1 ) ) );
+    lane4f_t _inv3 = lane4f_fmadd( _vec2, _fac5,
+        lane4f_fnmadd( _vec1, _fac4, lane4f_mul( _vec0, _fac2 ) ) );
+
+    const lane4f_t _sign_a = lane4f_set(  1.0f, -1.0f,  1.0f, -1.0f );
+    const lane4f_t _sign_b = lane4f_set( -1.0f,  1.0f, -1.0f,  1.0f );
+    out_columns[0] = lane4f_mul( _inv0, _sign_a );
+    out_columns[1] = lane4f_mul( _inv1, _sign_b );
+    out_columns[2] = lane4f_mul( _inv2, _sign_a );
+    out_columns[3] = lane4f_mul( _inv3, _sign_b );
+
+    // first row of adjugate dotted with first column of m
+    lane4f_t _row0 = lane4f_shuffle2<0, 2, 0, 2>(
+        lane4f_shuffle2<0, 0, 0, 0>( out_columns[0], out_columns[1] ),
+        lane4f_shuffle2<0, 0, 0, 0>( out_columns[2], out_columns[3] ) );
+    return lane4f_dot4( _c0, _row0 );
+}
+inline mat4 mat4_scaled_columns( const simd::lane4f_t columns[4], f32 scale ) {
+    using namespace simd;
+    lane4f_t _scale = lane4f_set_scalar( scale );
+    mat4 result;
+    lane4f_store_unaligned( lane4f_mul( columns[0], _scale ), result._col0.ptr() );
+    lane4f_store_unaligned( lane4f_mul( columns[1], _scale ), result._col1.ptr() );
+    lane4f_store_unaligned( lane4f_mul( columns[2], _scale ), result._col2.ptr() );
+    lane4f_store_unaligned( lane4f_mul( columns[3], _scale ), result._col3.ptr() );
+    return result;
 }
-bool32 inverse( const mat4& m, mat4& result ) {
-    f32 det = determinant( m );
+
+} // namespace smath::internal
+
+SMATH_INLINE mat4 cofactor_matrix( const mat4& m ) {
+    return transpose( adjoint( m ) );
+}
+SMATH_INLINE mat4 adjoint( const mat4& m ) {
+    simd::lane4f_t columns[4];
+    internal::mat4_adjugate( m, columns );
+    return internal::mat4_scaled_columns( columns, 1.0f );
+}
+SMATH_INLINE f32 determinant( const mat4& m ) {
+    // NOTE(alicia): expand along first column using 2x2 sub-factors of columns 2 and 3
+    f32 sub0 = ( m._m22 * m._m33 ) - ( m._m32 * m._m23 );
+    f32 sub1 = ( m._m21 * m._m33 ) - ( m._m31 * m._m23 );
+    f32 sub2 = ( m._m21 * m._m32 ) - ( m._m31 * m._m22 );
+    f32 sub3 = ( m._m20 * m._m33 ) - ( m._m30 * m._m23 );
+    f32 sub4 = ( m._m20 * m._m32 ) - ( m._m30 * m._m22 );
+    f32 sub5 = ( m._m20 * m._m31 ) - ( m._m30 * m._m21 );
+
+    f32 cof0 =   ( m._m11 * sub0 ) - ( m._m12 * sub1 ) + ( m._m13 * sub2 );
+    f32 cof1 = -(( m._m10 * sub0 ) - ( m._m12 * sub3 ) + ( m._m13 * sub4 ));
+    f32 cof2 =   ( m._m10 * sub1 ) - ( m._m11 * sub3 ) + ( m._m13 * sub5 );
+    f32 cof3 = -(( m._m10 * sub2 ) - ( m._m11 * sub4 ) + ( m._m12 * sub5 ));
+
+    return ( m._m00 * cof0 ) + ( m._m01 * cof1 ) + ( m._m02 * cof2 ) + ( m._m03 * cof3 );
+}
+SMATH_INLINE bool32 inverse( const mat4& m, mat4& result ) {
+    simd::lane4f_t columns[4];
+    f32 det = internal::mat4_adjugate( m, columns );
     if( det == 0.0f ) {
         return false;
     } else {
-        result = adjoint( m ) / det;
+        result = internal::mat4_scaled_columns( columns, 1.0f / det );
         return true;
     }
 }
-mat4 inverse_unchecked( const mat4& m ) {
-    return adjoint( m ) / determinant( m );
+SMATH_INLINE mat4 inverse_unchecked( const mat4& m ) {
+    simd::lane4f_t columns[4];
+    f32 det = internal::mat4_adjugate( m, columns );
+    return internal::mat4_scaled_columns( columns, 1.0f / det );
+}
+SMATH_INLINE mat4 inverse_affine( const mat4& m ) {
+    using namespace simd;
+    lane4f_t _c0 = lane4f_load_unaligned( m._col0.ptr() );
+    lane4f_t _c1 = lane4f_load_unaligned( m._col1.ptr() );
+    lane4f_t _c2 = lane4f_load_unaligned( m._col2.ptr() );
+
+    // NOTE(alicia): rows of the 3x3 inverse are cross products of its columns,
+    // w components stay zero since they are zero in every column
+    lane4f_t rows[4] = {
+        lane4f_fmsub(
+            lane4f_shuffle<1, 2, 0, 3>( _c1 ), lane4f_shuffle<2, 0, 1, 3>( _c2 ),
+            lane4f_mul( lane4f_shuffle<2, 0, 1, 3>( _c1 ), lane4f_shuffle<1, 2, 0, 3>( _c2 ) ) ),
+        lane4f_fmsub(
+            lane4f_shuffle<1, 2, 0, 3>( _c2 ), lane4f_shuffle<2, 0, 1, 3>( _c0 ),
+            lane4f_mul( lane4f_shuffle<2, 0, 1, 3>( _c2 ), lane4f_shuffle<1, 2, 0, 3>( _c0 ) ) ),
+        lane4f_fmsub(
+            lane4f_shuffle<1, 2, 0, 3>( _c0 ), lane4f_shuffle<2, 0, 1, 3>( _c1 ),
+            lane4f_mul( lane4f_shuffle<2, 0, 1, 3>( _c0 ), lane4f_shuffle<1, 2, 0, 3>( _c1 ) ) ),
+        lane4f_set( 0.0f, 0.0f, 0.0f, 1.0f )
+    };
+    lane4f_t _inv_det = lane4f_set_scalar( 1.0f / lane4f_dot4( _c0, rows[0] ) );
+    rows[0] = lane4f_mul( rows[0], _inv_det );
+    rows[1] = lane4f_mul( rows[1], _inv_det );
+    rows[2] = lane4f_mul( rows[2], _inv_det );
+    lane4f_transpose4x4( rows );
+
+    lane4f_t _translation = lane4f_mul( rows[0], lane4f_set_scalar( m._m30 ) );
+    _translation = lane4f_fmadd( rows[1], lane4f_set_scalar( m._m31 ), _translation );
+    _translation = lane4f_fmadd( rows[2], lane4f_set_scalar( m._m32 ), _translation );
+
+    mat4 result;
+    lane4f_store_unaligned( rows[0], result._col0.ptr() );
+    lane4f_store_unaligned( rows[1], result._col1.ptr() );
+    lane4f_store_unaligned( rows[2], result._col2.ptr() );
+    lane4f_store_unaligned( lane4f_sub( rows[3], _translation ), result._col3.ptr() );
+    return result;
+}
+SMATH_INLINE mat4 inverse_rigid( const mat4& m ) {
+    using namespace simd;
+    // NOTE(alicia): inverse of a rotation is its transpose
+    lane4f_t rows[4] = {
+        lane4f_load_unaligned( m._col0.ptr() ),
+        lane4f_load_unaligned( m._col1.ptr() ),
+        lane4f_load_unaligned( m._col2.ptr() ),
+        lane4f_set( 0.0f, 0.0f, 0.0f, 1.0f )
+    };
+    lane4f_transpose4x4( rows );
+
+    lane4f_t _translation = lane4f_mul( rows[0], lane4f_set_scalar( m._m30 ) );
+    _translation = lane4f_fmadd( rows[1], lane4f_set_scalar( m._m31 ), _translation );
+    _translation = lane4f_fmadd( rows[2], lane4f_set_scalar( m._m32 ), _translation );
+
+    mat4 result;
+    lane4f_store_unaligned( rows[0], result._col0.ptr() );
+    lane4f_store_unaligned( rows[1], result._col1.ptr() );
+    lane4f_store_unaligned( rows[2], result._col2.ptr() );
+    lane4f_store_unaligned( lane4f_sub( rows[3], _translation ), result._col3.ptr() );
+    return result;
 }
-bool32 normal_matrix( const mat4& transform, mat3& result ) {
+SMATH_INLINE bool32 normal_matrix( const mat4& transform, mat3& result ) {
     mat4 _inverse;
     if( inverse( transform, _inverse ) ) {
         result = mat3::create(transpose( _inverse ));
@@ -3090,156 +2922,3544 @@ bool32 normal_matrix( const mat4& transform, mat3& result ) {
         return false;
     }
 }
-mat3 normal_matrix_unchecked( const mat4& transform ) {
+SMATH_INLINE mat3 normal_matrix_unchecked( const mat4& transform ) {
     return mat3::create(transpose( inverse_unchecked( transform ) ));
 }
 
-lcg new_lcg( i32 seed ) {
-    lcg result  = {};
-    result.seed = seed;
-    result.a    = 166463;
-    result.b    = 235;
-    result.m    = 21446837;
-    result.current = result.seed;
-    return result;
-}
-lcg64 new_lcg64( i64 seed ) {
-    lcg64 result  = {};
-    result.seed = seed;
-    result.a    = 1664654683;
-    result.b    = 2384695;
-    result.m    = 2144683865487;
-    result.current = result.seed;
-    return result;
-}
-void rand( lcg& state, i32& next ) {
-    state.current = ( state.a * state.current + state.b ) % state.m;
-    next = state.current;
-}
-void rand( lcg& state, f32& next ) {
-    i32 result;
-    rand( state, result );
-    next = (f32)result / (f32)state.m;
+namespace internal {
+
+// NOTE(alicia): two result columns per eight-wide lane,
+// lhs is fully loaded and each rhs column pair is read before it's stored
+// so out can alias either input
+inline void mat4_mul_lanes( const mat4& lhs, const mat4& rhs, mat4& out ) {
+    using namespace simd;
+    lane4f_t _c0 = lane4f_load_unaligned( lhs._col0.ptr() );
+    lane4f_t _c1 = lane4f_load_unaligned( lhs._col1.ptr() );
+    lane4f_t _c2 = lane4f_load_unaligned( lhs._col2.ptr() );
+    lane4f_t _c3 = lane4f_load_unaligned( lhs._col3.ptr() );
+
+    lane8f_t _lhs0 = lane8f_combine( _c0, _c0 );
+    lane8f_t _lhs1 = lane8f_combine( _c1, _c1 );
+    lane8f_t _lhs2 = lane8f_combine( _c2, _c2 );
+    lane8f_t _lhs3 = lane8f_combine( _c3, _c3 );
+
+    for( u32 col = 0; col < 4; col += 2 ) {
+        const f32* a = rhs.ptr() + ( col * 4 );
+        const f32* b = a + 4;
+        lane8f_t _result = lane8f_mul(
+            _lhs0, lane8f_set( a[0], a[0], a[0], a[0], b[0], b[0], b[0], b[0] ) );
+        _result = lane8f_fmadd(
+            _lhs1, lane8f_set( a[1], a[1], a[1], a[1], b[1], b[1], b[1], b[1] ), _result );
+        _result = lane8f_fmadd(
+            _lhs2, lane8f_set( a[2], a[2], a[2], a[2], b[2], b[2], b[2], b[2] ), _result );
+        _result = lane8f_fmadd(
+            _lhs3, lane8f_set( a[3], a[3], a[3], a[3], b[3], b[3], b[3], b[3] ), _result );
+        lane8f_store_unaligned( _result, out.ptr() + ( col * 4 ) );
+    }
 }
-void rand( lcg& state, vec2& result ) {
-    rand( state, result.x );
-    rand( state, result.y );
+
+} // namespace smath::internal
+
+SMATH_INLINE void mat4_mul_n( const mat4* lhs, const mat4* rhs, mat4* out, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        internal::mat4_mul_lanes( lhs[i], rhs[i], out[i] );
+    }
 }
-void rand( lcg& state, ivec2& result ) {
-    rand(state, result.x);
-    rand(state, result.y);
+SMATH_INLINE void mat4_mul_hierarchy( const i32* parents, const mat4* locals, mat4* worlds, usize count ) {
+    mat4_mul_hierarchy_range( parents, locals, worlds, 0, count );
 }
-void rand( lcg& state, vec3& result ) {
-    rand( state, result.x );
-    rand( state, result.y );
-    rand( state, result.z );
+SMATH_INLINE void mat4_mul_hierarchy_range(
+    const i32* parents, const mat4* locals, mat4* worlds, usize first, usize count
+) {
+    for( usize i = first; i < first + count; ++i ) {
+        i32 parent = parents[i];
+        if( parent < 0 ) {
+            worlds[i] = locals[i];
+        } else {
+            internal::mat4_mul_lanes( worlds[parent], locals[i], worlds[i] );
+        }
+    }
 }
-void rand( lcg& state, ivec3& result ) {
-    rand(state, result.x);
-    rand(state, result.y);
-    rand(state, result.z);
+SMATH_INLINE usize mat4_hierarchy_split(
+    const i32* parents, usize count, usize max_ranges, usize* out_range_starts
+) {
+    if( !count || !max_ranges ) {
+        return 0;
+    }
+    // NOTE(alicia): cut at roots once a range reaches its share of nodes,
+    // a single large subtree ends up in a single range
+    usize target = ( count + max_ranges - 1 ) / max_ranges;
+    usize ranges = 0;
+    out_range_starts[ranges++] = 0;
+    for( usize i = 1; i < count && ranges < max_ranges; ++i ) {
+        if( parents[i] < 0 && i - out_range_starts[ranges - 1] >= target ) {
+            out_range_starts[ranges++] = i;
+        }
+    }
+    out_range_starts[ranges] = count;
+    return ranges;
 }
-void rand( lcg& state, vec4& result ) {
-    rand( state, result.x );
-    rand( state, result.y );
-    rand( state, result.z );
-    rand( state, result.w );
+
+// NOTE(alicia): batch transforms load the matrix columns once,
+// each vector is then four broadcasts and multiply-adds.
+// every input is fully read before its output is stored so in and out can alias
+
+SMATH_INLINE void transform_points( const mat4& m, const vec3* in, vec3* out, usize count ) {
+    using namespace simd;
+    const lane4f_t _col0 = lane4f_load_unaligned( m._col0.ptr() );
+    const lane4f_t _col1 = lane4f_load_unaligned( m._col1.ptr() );
+    const lane4f_t _col2 = lane4f_load_unaligned( m._col2.ptr() );
+    const lane4f_t _col3 = lane4f_load_unaligned( m._col3.ptr() );
+
+    for( usize i = 0; i < count; ++i ) {
+        lane4f_t _result = lane4f_fmadd( _col0, lane4f_set_scalar( in[i].x ), _col3 );
+        _result = lane4f_fmadd( _col1, lane4f_set_scalar( in[i].y ), _result );
+        _result = lane4f_fmadd( _col2, lane4f_set_scalar( in[i].z ), _result );
+        lane4f_store_partial( _result, out[i].ptr(), 3 );
+    }
 }
-void rand( lcg& state, ivec4& result ) {
-    rand(state, result.x);
-    rand(state, result.y);
-    rand(state, result.z);
-    rand(state, result.w);
+SMATH_INLINE void transform_points_perspective( const mat4& m, const vec3* in, vec3* out, usize count ) {
+    using namespace simd;
+    const lane4f_t _col0 = lane4f_load_unaligned( m._col0.ptr() );
+    const lane4f_t _col1 = lane4f_load_unaligned( m._col1.ptr() );
+    const lane4f_t _col2 = lane4f_load_unaligned( m._col2.ptr() );
+    const lane4f_t _col3 = lane4f_load_unaligned( m._col3.ptr() );
+
+    for( usize i = 0; i < count; ++i ) {
+        lane4f_t _result = lane4f_fmadd( _col0, lane4f_set_scalar( in[i].x ), _col3 );
+        _result = lane4f_fmadd( _col1, lane4f_set_scalar( in[i].y ), _result );
+        _result = lane4f_fmadd( _col2, lane4f_set_scalar( in[i].z ), _result );
+        _result = lane4f_div( _result, lane4f_shuffle<3, 3, 3, 3>( _result ) );
+        lane4f_store_partial( _result, out[i].ptr(), 3 );
+    }
 }
-void rand( lcg64& state, i64& next ) {
-    state.current = ( state.a * state.current + state.b ) % state.m;
-    next = state.current;
+SMATH_INLINE void transform_directions( const mat4& m, const vec3* in, vec3* out, usize count ) {
+    using namespace simd;
+    const lane4f_t _col0 = lane4f_load_unaligned( m._col0.ptr() );
+    const lane4f_t _col1 = lane4f_load_unaligned( m._col1.ptr() );
+    const lane4f_t _col2 = lane4f_load_unaligned( m._col2.ptr() );
+
+    for( usize i = 0; i < count; ++i ) {
+        lane4f_t _result = lane4f_mul( _col0, lane4f_set_scalar( in[i].x ) );
+        _result = lane4f_fmadd( _col1, lane4f_set_scalar( in[i].y ), _result );
+        _result = lane4f_fmadd( _col2, lane4f_set_scalar( in[i].z ), _result );
+        lane4f_store_partial( _result, out[i].ptr(), 3 );
+    }
 }
-void rand( lcg64& state, f64& next ) {
-    i64 result;
-    rand( state, result );
-    next = (f64)result / (f64)state.m;
+SMATH_INLINE void transform_vec4( const mat4& m, const vec4* in, vec4* out, usize count ) {
+    using namespace simd;
+    const lane4f_t _col0 = lane4f_load_unaligned( m._col0.ptr() );
+    const lane4f_t _col1 = lane4f_load_unaligned( m._col1.ptr() );
+    const lane4f_t _col2 = lane4f_load_unaligned( m._col2.ptr() );
+    const lane4f_t _col3 = lane4f_load_unaligned( m._col3.ptr() );
+
+    for( usize i = 0; i < count; ++i ) {
+        lane4f_t _result = lane4f_mul( _col0, lane4f_set_scalar( in[i].x ) );
+        _result = lane4f_fmadd( _col1, lane4f_set_scalar( in[i].y ), _result );
+        _result = lane4f_fmadd( _col2, lane4f_set_scalar( in[i].z ), _result );
+        _result = lane4f_fmadd( _col3, lane4f_set_scalar( in[i].w ), _result );
+        lane4f_store_unaligned( _result, out[i].ptr() );
+    }
 }
 
-xor_shift new_xor_shift( u32 seed ) {
-    xor_shift result = {};
-    result.seed = max( seed, (u32)1 );
-    result.current = result.seed;
-    return result;
+// NOTE(alicia): mat3x4
+
+SMATH_INLINE mat3x4 mat3x4::create(
+    f32 m00, f32 m01, f32 m02, f32 m03,
+    f32 m10, f32 m11, f32 m12, f32 m13,
+    f32 m20, f32 m21, f32 m22, f32 m23
+) {
+    return {
+        m00, m01, m02, m03,
+        m10, m11, m12, m13,
+        m20, m21, m22, m23
+    };
 }
-xor_shift64 new_xor_shift64( u64 seed ) {
-    xor_shift64 result = {};
-    result.seed = max( seed, (u64)1 );
-    result.current = result.seed;
+SMATH_INLINE mat3x4 mat3x4::create( const mat4& m ) {
+    using namespace simd;
+    lane4f_t columns[4] = {
+        lane4f_load_unaligned( m._col0.ptr() ),
+        lane4f_load_unaligned( m._col1.ptr() ),
+        lane4f_load_unaligned( m._col2.ptr() ),
+        lane4f_load_unaligned( m._col3.ptr() )
+    };
+    lane4f_transpose4x4( columns );
+
+    mat3x4 result;
+    lane4f_store_unaligned( columns[0], result._row0.ptr() );
+    lane4f_store_unaligned( columns[1], result._row1.ptr() );
+    lane4f_store_unaligned( columns[2], result._row2.ptr() );
     return result;
 }
-void rand( xor_shift& state, u32& next ) {
-    u32 result = state.current;
-    result ^= result << 13;
-    result ^= result >> 17;
-    result ^= result << 5;
+SMATH_INLINE mat3x4 mat3x4::transform(
+    const vec3& translation,
+    const quat& rotation,
+    const vec3& scale
+) {
+    // NOTE(alicia): rotation matrix with each column multiplied by its scale,
+    // same as translate * rotate * scale without the intermediate matrices
+    f32 _2x2 = 2.0f * (rotation.x * rotation.x);
+    f32 _2y2 = 2.0f * (rotation.y * rotation.y);
+    f32 _2z2 = 2.0f * (rotation.z * rotation.z);
 
-    state.current = result;
-    next = result;
-}
-void rand( xor_shift& state, i32& next ) {
-    u32 result;
-    rand( state, result );
-    next = *(i32*)&result;
-}
-void rand( xor_shift& state, f32& next ) {
+    f32 _2xy = 2.0f * (rotation.x * rotation.y);
+    f32 _2xz = 2.0f * (rotation.x * rotation.z);
+    f32 _2yz = 2.0f * (rotation.y * rotation.z);
+    f32 _2wx = 2.0f * (rotation.w * rotation.x);
+    f32 _2wy = 2.0f * (rotation.w * rotation.y);
+    f32 _2wz = 2.0f * (rotation.w * rotation.z);
+
+    return {
+        ( 1.0f - _2y2 - _2z2 ) * scale.x,
+        ( _2xy - _2wz ) * scale.y,
+        ( _2xz + _2wy ) * scale.z,
+        translation.x,
+
+        ( _2xy + _2wz ) * scale.x,
+        ( 1.0f - _2x2 - _2z2 ) * scale.y,
+        ( _2yz - _2wx ) * scale.z,
+        translation.y,
+
+        ( _2xz - _2wy ) * scale.x,
+        ( _2yz + _2wx ) * scale.y,
+        ( 1.0f - _2x2 - _2y2 ) * scale.z,
+        translation.z
+    };
+}
+SMATH_INLINE f32* mat3x4::ptr() { return &_m00; }
+SMATH_INLINE const f32* mat3x4::ptr() const { return &_m00; }
+SMATH_INLINE f32& mat3x4::operator[]( u32 index ) { return ptr()[index]; }
+SMATH_INLINE f32 mat3x4::operator[]( u32 index ) const { return ptr()[index]; }
+SMATH_INLINE mat3x4& mat3x4::operator*=( const mat3x4& rhs ) {
+    using namespace simd;
+    // NOTE(alicia): each result row is a linear combination of rhs rows
+    // weighted by the matching lhs row, implicit rhs row 3 only adds lhs translation
+    const lane4f_t _rhs0 = lane4f_load_unaligned( rhs._row0.ptr() );
+    const lane4f_t _rhs1 = lane4f_load_unaligned( rhs._row1.ptr() );
+    const lane4f_t _rhs2 = lane4f_load_unaligned( rhs._row2.ptr() );
+    const lane4f_t _rhs3 = lane4f_set( 0.0f, 0.0f, 0.0f, 1.0f );
+
+    for( u32 row = 0; row < 3; ++row ) {
+        f32* _lhs = this->ptr() + ( row * 4 );
+        lane4f_t _result = lane4f_mul( _rhs3, lane4f_set_scalar( _lhs[3] ) );
+        _result = lane4f_fmadd( _rhs0, lane4f_set_scalar( _lhs[0] ), _result );
+        _result = lane4f_fmadd( _rhs1, lane4f_set_scalar( _lhs[1] ), _result );
+        _result = lane4f_fmadd( _rhs2, lane4f_set_scalar( _lhs[2] ), _result );
+        lane4f_store_unaligned( _result, _lhs );
+    }
+    return *this;
+}
+SMATH_INLINE mat3x4 operator*( const mat3x4& lhs, const mat3x4& rhs ) {
+    return mat3x4(lhs) *= rhs;
+}
+SMATH_INLINE vec3 operator*( const mat3x4& lhs, const vec3& rhs ) {
+    using namespace simd;
+    lane4f_t _point = lane4f_set( rhs.x, rhs.y, rhs.z, 1.0f );
+    return {
+        lane4f_dot4( lane4f_load_unaligned( lhs._row0.ptr() ), _point ),
+        lane4f_dot4( lane4f_load_unaligned( lhs._row1.ptr() ), _point ),
+        lane4f_dot4( lane4f_load_unaligned( lhs._row2.ptr() ), _point )
+    };
+}
+SMATH_INLINE vec3 transform_direction( const mat3x4& m, const vec3& direction ) {
+    using namespace simd;
+    lane4f_t _direction = lane4f_set( direction.x, direction.y, direction.z, 0.0f );
+    return {
+        lane4f_dot4( lane4f_load_unaligned( m._row0.ptr() ), _direction ),
+        lane4f_dot4( lane4f_load_unaligned( m._row1.ptr() ), _direction ),
+        lane4f_dot4( lane4f_load_unaligned( m._row2.ptr() ), _direction )
+    };
+}
+SMATH_INLINE vec3 translation( const mat3x4& m ) {
+    return { m._m03, m._m13, m._m23 };
+}
+
+namespace internal {
+
+// NOTE(alicia): columns of the 3x3 inverse are cross products of its rows,
+// returns determinant and writes adjugate rows with -adjugate * translation in w
+inline f32 mat3x4_adjugate( const mat3x4& m, simd::lane4f_t out_rows[4] ) {
+    using namespace simd;
+    const lane4f_t _xyz_mask = lane4f_set( 1.0f, 1.0f, 1.0f, 0.0f );
+    lane4f_t _r0 = lane4f_mul( lane4f_load_unaligned( m._row0.ptr() ), _xyz_mask );
+    lane4f_t _r1 = lane4f_mul( lane4f_load_unaligned( m._row1.ptr() ), _xyz_mask );
+    lane4f_t _r2 = lane4f_mul( lane4f_load_unaligned( m._row2.ptr() ), _xyz_mask );
+
+    lane4f_t _c0 = lane4f_fmsub(
+        lane4f_shuffle<1, 2, 0, 3>( _r1 ), lane4f_shuffle<2, 0, 1, 3>( _r2 ),
+        lane4f_mul( lane4f_shuffle<2, 0, 1, 3>( _r1 ), lane4f_shuffle<1, 2, 0, 3>( _r2 ) ) );
+    lane4f_t _c1 = lane4f_fmsub(
+        lane4f_shuffle<1, 2, 0, 3>( _r2 ), lane4f_shuffle<2, 0, 1, 3>( _r0 ),
+        lane4f_mul( lane4f_shuffle<2, 0, 1, 3>( _r2 ), lane4f_shuffle<1, 2, 0, 3>( _r0 ) ) );
+    lane4f_t _c2 = lane4f_fmsub(
+        lane4f_shuffle<1, 2, 0, 3>( _r0 ), lane4f_shuffle<2, 0, 1, 3>( _r1 ),
+        lane4f_mul( lane4f_shuffle<2, 0, 1, 3>( _r0 ), lane4f_shuffle<1, 2, 0, 3>( _r1 ) ) );
+
+    lane4f_t _translation = lane4f_mul( _c0, lane4f_set_scalar( m._m03 ) );
+    _translation = lane4f_fmadd( _c1, lane4f_set_scalar( m._m13 ), _translation );
+    _translation = lane4f_fmadd( _c2, lane4f_set_scalar( m._m23 ), _translation );
+
+    out_rows[0] = _c0;
+    out_rows[1] = _c1;
+    out_rows[2] = _c2;
+    out_rows[3] = lane4f_sub( lane4f_set_zero(), _translation );
+    lane4f_transpose4x4( out_rows );
+
+    return lane4f_dot4( _r0, _c0 );
+}
+inline mat3x4 mat3x4_scaled_rows( const simd::lane4f_t rows[4], f32 scale ) {
+    using namespace simd;
+    lane4f_t _scale = lane4f_set_scalar( scale );
+    mat3x4 result;
+    lane4f_store_unaligned( lane4f_mul( rows[0], _scale ), result._row0.ptr() );
+    lane4f_store_unaligned( lane4f_mul( rows[1], _scale ), result._row1.ptr() );
+    lane4f_store_unaligned( lane4f_mul( rows[2], _scale ), result._row2.ptr() );
+    return result;
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE bool32 inverse( const mat3x4& m, mat3x4& result ) {
+    simd::lane4f_t rows[4];
+    f32 det = internal::mat3x4_adjugate( m, rows );
+    if( det == 0.0f ) {
+        return false;
+    } else {
+        result = internal::mat3x4_scaled_rows( rows, 1.0f / det );
+        return true;
+    }
+}
+SMATH_INLINE mat3x4 inverse_unchecked( const mat3x4& m ) {
+    simd::lane4f_t rows[4];
+    f32 det = internal::mat3x4_adjugate( m, rows );
+    return internal::mat3x4_scaled_rows( rows, 1.0f / det );
+}
+SMATH_INLINE void transform_points( const mat3x4& m, const vec3* in, vec3* out, usize count ) {
+    using namespace simd;
+    lane4f_t columns[4] = {
+        lane4f_load_unaligned( m._row0.ptr() ),
+        lane4f_load_unaligned( m._row1.ptr() ),
+        lane4f_load_unaligned( m._row2.ptr() ),
+        lane4f_set_zero()
+    };
+    lane4f_transpose4x4( columns );
+
+    for( usize i = 0; i < count; ++i ) {
+        lane4f_t _result = lane4f_fmadd( columns[0], lane4f_set_scalar( in[i].x ), columns[3] );
+        _result = lane4f_fmadd( columns[1], lane4f_set_scalar( in[i].y ), _result );
+        _result = lane4f_fmadd( columns[2], lane4f_set_scalar( in[i].z ), _result );
+        lane4f_store_partial( _result, out[i].ptr(), 3 );
+    }
+}
+
+// NOTE(alicia): transform
+
+SMATH_INLINE transform transform::create(
+    const vec3& translation,
+    const quat& rotation,
+    const vec3& scale
+) {
+    return { rotation, translation, scale };
+}
+SMATH_INLINE transform compose( const transform& parent, const transform& child ) {
+    return {
+        parent.rotation * child.rotation,
+        parent.translation + parent.rotation * hadamard( parent.scale, child.translation ),
+        hadamard( parent.scale, child.scale )
+    };
+}
+SMATH_INLINE transform operator*( const transform& lhs, const transform& rhs ) {
+    return compose( lhs, rhs );
+}
+SMATH_INLINE vec3 operator*( const transform& lhs, const vec3& rhs ) {
+    return lhs.translation + lhs.rotation * hadamard( lhs.scale, rhs );
+}
+SMATH_INLINE transform inverse( const transform& t ) {
+    quat rotation = conjugate( t.rotation );
+    vec3 scale    = {
+        1.0f / t.scale.x,
+        1.0f / t.scale.y,
+        1.0f / t.scale.z
+    };
+    return {
+        rotation,
+        hadamard( scale, rotation * ( t.translation * -1.0f ) ),
+        scale
+    };
+}
+SMATH_INLINE transform nlerp( const transform& a, const transform& b, f32 t ) {
+    quat rotation = b.rotation;
+    if( dot( a.rotation, rotation ) < 0.0f ) {
+        rotation = -rotation;
+    }
+    return {
+        lerp( a.rotation, rotation, t ),
+        lerp( a.translation, b.translation, t ),
+        lerp( a.scale, b.scale, t )
+    };
+}
+SMATH_INLINE transform blend( const transform* transforms, const f32* weights, usize count ) {
+    if( !count ) {
+        return transform::identity();
+    }
+    using namespace simd;
+    const lane4f_t _pivot = lane4f_load_unaligned( transforms[0].rotation.ptr() );
+
+    lane4f_t _rotation    = lane4f_set_zero();
+    lane4f_t _translation = lane4f_set_zero();
+    lane4f_t _scale       = lane4f_set_zero();
+    for( usize i = 0; i < count; ++i ) {
+        const transform& t = transforms[i];
+        lane4f_t _q = lane4f_load_unaligned( t.rotation.ptr() );
+        f32 w = lane4f_dot4( _pivot, _q ) < 0.0f ? -weights[i] : weights[i];
+
+        _rotation = lane4f_fmadd( _q, lane4f_set_scalar( w ), _rotation );
+        _translation = lane4f_fmadd(
+            lane4f_set( t.translation.x, t.translation.y, t.translation.z, 0.0f ),
+            lane4f_set_scalar( weights[i] ), _translation );
+        _scale = lane4f_fmadd(
+            lane4f_set( t.scale.x, t.scale.y, t.scale.z, 0.0f ),
+            lane4f_set_scalar( weights[i] ), _scale );
+    }
+
+    transform result;
+    vec4 translation, scale;
+    lane4f_store_unaligned( _rotation, result.rotation.ptr() );
+    lane4f_store_unaligned( _translation, translation.ptr() );
+    lane4f_store_unaligned( _scale, scale.ptr() );
+
+    result.rotation    = normalize( result.rotation );
+    result.translation = vec3::create( translation );
+    result.scale       = vec3::create( scale );
+    return result;
+}
+SMATH_INLINE mat3x4 transform_to_mat3x4( const transform& t ) {
+    return mat3x4::transform( t.translation, t.rotation, t.scale );
+}
+SMATH_INLINE mat4 transform_to_mat4( const transform& t ) {
+    return mat4::create( transform_to_mat3x4( t ) );
+}
+SMATH_INLINE void apply_to_points( const transform& t, const vec3* in, vec3* out, usize count ) {
+    transform_points( transform_to_mat3x4( t ), in, out, count );
+}
+
+// NOTE(alicia): dual_quat
+
+SMATH_INLINE dual_quat dual_quat::create( const quat& rotation, const vec3& translation ) {
+    quat t = { 0.0f, translation.x, translation.y, translation.z };
+    return { rotation, ( t * rotation ) * 0.5f };
+}
+SMATH_INLINE dual_quat dual_quat::create( const transform& t ) {
+    return dual_quat::create( t.rotation, t.translation );
+}
+SMATH_INLINE dual_quat operator*( const dual_quat& lhs, const dual_quat& rhs ) {
+    return {
+        lhs.real * rhs.real,
+        ( lhs.real * rhs.dual ) + ( lhs.dual * rhs.real )
+    };
+}
+SMATH_INLINE dual_quat compose( const dual_quat& parent, const dual_quat& child ) {
+    return parent * child;
+}
+SMATH_INLINE vec3 operator*( const dual_quat& lhs, const vec3& rhs ) {
+    return lhs.real * rhs + translation( lhs );
+}
+SMATH_INLINE dual_quat normalize( const dual_quat& dq ) {
+    f32 m = mag( dq.real );
+    if( m < 0.0001f ) {
+        return dual_quat::identity();
+    }
+    // NOTE(alicia): remove the part of dual that isn't orthogonal to real,
+    // otherwise blended results pick up scale/shear
+    quat real = dq.real / m;
+    quat dual = dq.dual / m;
+    dual -= real * dot( real, dual );
+    return { real, dual };
+}
+SMATH_INLINE dual_quat inverse( const dual_quat& dq ) {
+    return { conjugate( dq.real ), conjugate( dq.dual ) };
+}
+SMATH_INLINE vec3 translation( const dual_quat& dq ) {
+    quat t = ( dq.dual * conjugate( dq.real ) ) * 2.0f;
+    return { t.x, t.y, t.z };
+}
+SMATH_INLINE dual_quat nlerp( const dual_quat& a, const dual_quat& b, f32 t ) {
+    f32 wb = dot( a.real, b.real ) < 0.0f ? -t : t;
+    f32 wa = 1.0f - t;
+    return normalize( dual_quat{
+        ( a.real * wa ) + ( b.real * wb ),
+        ( a.dual * wa ) + ( b.dual * wb )
+    } );
+}
+SMATH_INLINE dual_quat blend( const dual_quat* dqs, const f32* weights, usize count ) {
+    if( !count ) {
+        return dual_quat::identity();
+    }
+    using namespace simd;
+    const lane4f_t _pivot = lane4f_load_unaligned( dqs[0].real.ptr() );
+
+    lane4f_t _real = lane4f_set_zero();
+    lane4f_t _dual = lane4f_set_zero();
+    for( usize i = 0; i < count; ++i ) {
+        lane4f_t _r = lane4f_load_unaligned( dqs[i].real.ptr() );
+        lane4f_t _d = lane4f_load_unaligned( dqs[i].dual.ptr() );
+        lane4f_t _w = lane4f_set_scalar(
+            lane4f_dot4( _pivot, _r ) < 0.0f ? -weights[i] : weights[i] );
+
+        _real = lane4f_fmadd( _r, _w, _real );
+        _dual = lane4f_fmadd( _d, _w, _dual );
+    }
+
+    dual_quat result;
+    lane4f_store_unaligned( _real, result.real.ptr() );
+    lane4f_store_unaligned( _dual, result.dual.ptr() );
+    return normalize( result );
+}
+SMATH_INLINE mat3x4 dual_quat_to_mat3x4( const dual_quat& dq ) {
+    return mat3x4::transform( translation( dq ), dq.real, vec3::one() );
+}
+SMATH_INLINE void apply_to_points( const dual_quat& dq, const vec3* in, vec3* out, usize count ) {
+    transform_points( dual_quat_to_mat3x4( dq ), in, out, count );
+}
+
+// NOTE(alicia): soa
+
+#define SOA_LANE_WIDTH 8
+#define SOA_ALIGNMENT  32
+
+namespace internal {
+
+inline usize soa_padded( usize count ) {
+    return ( count + ( SOA_LANE_WIDTH - 1 ) ) & ~( (usize)SOA_LANE_WIDTH - 1 );
+}
+inline f32* soa_alloc( usize padded, usize components ) {
+    f32* buffer = (f32*)smcol_alloc_aligned(
+        padded * components * sizeof(f32), SOA_ALIGNMENT );
+    if( !buffer ) {
+        return nullptr;
+    }
+    simd::lane8f_t zero = simd::lane8f_set_zero();
+    for( usize i = 0; i < padded * components; i += SOA_LANE_WIDTH ) {
+        simd::lane8f_store_aligned( zero, buffer + i );
+    }
+    return buffer;
+}
+
+// NOTE(alicia): store a lane into a plain array that isn't padded
+inline void soa_store_lane( simd::lane8f_t lane, f32* out_result, usize remaining ) {
+    if( remaining >= SOA_LANE_WIDTH ) {
+        simd::lane8f_store_unaligned( lane, out_result );
+    } else {
+        simd::lane8f_store_partial( lane, out_result, remaining );
+    }
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE bool32 soa_create( usize count, vec3_soa* out_result ) {
+    usize padded = internal::soa_padded( count );
+    f32* buffer  = nullptr;
+    if( padded ) {
+        buffer = internal::soa_alloc( padded, 3 );
+        if( !buffer ) {
+            return false;
+        }
+    }
+    out_result->x        = buffer;
+    out_result->y        = buffer ? buffer + padded : nullptr;
+    out_result->z        = buffer ? buffer + ( padded * 2 ) : nullptr;
+    out_result->count    = count;
+    out_result->capacity = padded;
+    return true;
+}
+SMATH_INLINE bool32 soa_create( usize count, vec4_soa* out_result ) {
+    usize padded = internal::soa_padded( count );
+    f32* buffer  = nullptr;
+    if( padded ) {
+        buffer = internal::soa_alloc( padded, 4 );
+        if( !buffer ) {
+            return false;
+        }
+    }
+    out_result->x        = buffer;
+    out_result->y        = buffer ? buffer + padded : nullptr;
+    out_result->z        = buffer ? buffer + ( padded * 2 ) : nullptr;
+    out_result->w        = buffer ? buffer + ( padded * 3 ) : nullptr;
+    out_result->count    = count;
+    out_result->capacity = padded;
+    return true;
+}
+SMATH_INLINE bool32 soa_create( usize count, quat_soa* out_result ) {
+    usize padded = internal::soa_padded( count );
+    f32* buffer  = nullptr;
+    if( padded ) {
+        buffer = internal::soa_alloc( padded, 4 );
+        if( !buffer ) {
+            return false;
+        }
+    }
+    out_result->w        = buffer;
+    out_result->x        = buffer ? buffer + padded : nullptr;
+    out_result->y        = buffer ? buffer + ( padded * 2 ) : nullptr;
+    out_result->z        = buffer ? buffer + ( padded * 3 ) : nullptr;
+    out_result->count    = count;
+    out_result->capacity = padded;
+    return true;
+}
+SMATH_INLINE void soa_free( vec3_soa* soa ) {
+    smcol_free_aligned( soa->x );
+    *soa = {};
+}
+SMATH_INLINE void soa_free( vec4_soa* soa ) {
+    smcol_free_aligned( soa->x );
+    *soa = {};
+}
+SMATH_INLINE void soa_free( quat_soa* soa ) {
+    smcol_free_aligned( soa->w );
+    *soa = {};
+}
+SMATH_INLINE vec3 soa_get( const vec3_soa& soa, usize index ) {
+    return { soa.x[index], soa.y[index], soa.z[index] };
+}
+SMATH_INLINE vec4 soa_get( const vec4_soa& soa, usize index ) {
+    return { soa.x[index], soa.y[index], soa.z[index], soa.w[index] };
+}
+SMATH_INLINE quat soa_get( const quat_soa& soa, usize index ) {
+    return { soa.w[index], soa.x[index], soa.y[index], soa.z[index] };
+}
+SMATH_INLINE void soa_set( vec3_soa& soa, usize index, const vec3& v ) {
+    soa.x[index] = v.x;
+    soa.y[index] = v.y;
+    soa.z[index] = v.z;
+}
+SMATH_INLINE void soa_set( vec4_soa& soa, usize index, const vec4& v ) {
+    soa.x[index] = v.x;
+    soa.y[index] = v.y;
+    soa.z[index] = v.z;
+    soa.w[index] = v.w;
+}
+SMATH_INLINE void soa_set( quat_soa& soa, usize index, const quat& q ) {
+    soa.w[index] = q.w;
+    soa.x[index] = q.x;
+    soa.y[index] = q.y;
+    soa.z[index] = q.z;
+}
+SMATH_INLINE void aos_to_soa( const vec3* aos, usize count, vec3_soa& out_result ) {
+    using namespace simd;
+    const lane8i_t _indices = lane8i_set( 0, 1, 2, 3, 4, 5, 6, 7 );
+
+    usize i = 0;
+    for( ; i + SOA_LANE_WIDTH <= count; i += SOA_LANE_WIDTH ) {
+        const f32* base = aos[i].ptr();
+        lane8f_store_aligned( lane8f_gather( base + 0, _indices, 3 ), out_result.x + i );
+        lane8f_store_aligned( lane8f_gather( base + 1, _indices, 3 ), out_result.y + i );
+        lane8f_store_aligned( lane8f_gather( base + 2, _indices, 3 ), out_result.z + i );
+    }
+    for( ; i < count; ++i ) {
+        soa_set( out_result, i, aos[i] );
+    }
+    out_result.count = count;
+}
+SMATH_INLINE void aos_to_soa( const vec4* aos, usize count, vec4_soa& out_result ) {
+    using namespace simd;
+
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        lane4f_t rows[4] = {
+            lane4f_load_unaligned( aos[i + 0].ptr() ),
+            lane4f_load_unaligned( aos[i + 1].ptr() ),
+            lane4f_load_unaligned( aos[i + 2].ptr() ),
+            lane4f_load_unaligned( aos[i + 3].ptr() ),
+        };
+        lane4f_transpose4x4( rows );
+        lane4f_store_aligned( rows[0], out_result.x + i );
+        lane4f_store_aligned( rows[1], out_result.y + i );
+        lane4f_store_aligned( rows[2], out_result.z + i );
+        lane4f_store_aligned( rows[3], out_result.w + i );
+    }
+    for( ; i < count; ++i ) {
+        soa_set( out_result, i, aos[i] );
+    }
+    out_result.count = count;
+}
+SMATH_INLINE void aos_to_soa( const quat* aos, usize count, quat_soa& out_result ) {
+    using namespace simd;
+
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        lane4f_t rows[4] = {
+            lane4f_load_unaligned( aos[i + 0].ptr() ),
+            lane4f_load_unaligned( aos[i + 1].ptr() ),
+            lane4f_load_unaligned( aos[i + 2].ptr() ),
+            lane4f_load_unaligned( aos[i + 3].ptr() ),
+        };
+        lane4f_transpose4x4( rows );
+        lane4f_store_aligned( rows[0], out_result.w + i );
+        lane4f_store_aligned( rows[1], out_result.x + i );
+        lane4f_store_aligned( rows[2], out_result.y + i );
+        lane4f_store_aligned( rows[3], out_result.z + i );
+    }
+    for( ; i < count; ++i ) {
+        soa_set( out_result, i, aos[i] );
+    }
+    out_result.count = count;
+}
+SMATH_INLINE void soa_to_aos( const vec3_soa& soa, vec3* out_aos ) {
+    using namespace simd;
+    const lane8i_t _indices = lane8i_set( 0, 1, 2, 3, 4, 5, 6, 7 );
+
+    usize i = 0;
+    for( ; i + SOA_LANE_WIDTH <= soa.count; i += SOA_LANE_WIDTH ) {
+        f32* base = out_aos[i].ptr();
+        lane8f_scatter( base + 0, _indices, 3, lane8f_load_aligned( soa.x + i ) );
+        lane8f_scatter( base + 1, _indices, 3, lane8f_load_aligned( soa.y + i ) );
+        lane8f_scatter( base + 2, _indices, 3, lane8f_load_aligned( soa.z + i ) );
+    }
+    for( ; i < soa.count; ++i ) {
+        out_aos[i] = soa_get( soa, i );
+    }
+}
+SMATH_INLINE void soa_to_aos( const vec4_soa& soa, vec4* out_aos ) {
+    using namespace simd;
+
+    usize i = 0;
+    for( ; i + 4 <= soa.count; i += 4 ) {
+        lane4f_t rows[4] = {
+            lane4f_load_aligned( soa.x + i ),
+            lane4f_load_aligned( soa.y + i ),
+            lane4f_load_aligned( soa.z + i ),
+            lane4f_load_aligned( soa.w + i ),
+        };
+        lane4f_transpose4x4( rows );
+        lane4f_store_unaligned( rows[0], out_aos[i + 0].ptr() );
+        lane4f_store_unaligned( rows[1], out_aos[i + 1].ptr() );
+        lane4f_store_unaligned( rows[2], out_aos[i + 2].ptr() );
+        lane4f_store_unaligned( rows[3], out_aos[i + 3].ptr() );
+    }
+    for( ; i < soa.count; ++i ) {
+        out_aos[i] = soa_get( soa, i );
+    }
+}
+SMATH_INLINE void soa_to_aos( const quat_soa& soa, quat* out_aos ) {
+    using namespace simd;
+
+    usize i = 0;
+    for( ; i + 4 <= soa.count; i += 4 ) {
+        lane4f_t rows[4] = {
+            lane4f_load_aligned( soa.w + i ),
+            lane4f_load_aligned( soa.x + i ),
+            lane4f_load_aligned( soa.y + i ),
+            lane4f_load_aligned( soa.z + i ),
+        };
+        lane4f_transpose4x4( rows );
+        lane4f_store_unaligned( rows[0], out_aos[i + 0].ptr() );
+        lane4f_store_unaligned( rows[1], out_aos[i + 1].ptr() );
+        lane4f_store_unaligned( rows[2], out_aos[i + 2].ptr() );
+        lane4f_store_unaligned( rows[3], out_aos[i + 3].ptr() );
+    }
+    for( ; i < soa.count; ++i ) {
+        out_aos[i] = soa_get( soa, i );
+    }
+}
+
+// NOTE(alicia): batch functions run on full eight-wide lanes,
+// soa arrays are padded so only plain f32 outputs need a partial store
+
+SMATH_INLINE void normalize_n( const vec3_soa& v, vec3_soa& out_result ) {
+    using namespace simd;
+    const lane8f_t _threshold = lane8f_set_scalar( 0.0001f );
+    const lane8f_t _zero      = lane8f_set_zero();
+
+    for( usize i = 0; i < v.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _x = lane8f_load_aligned( v.x + i );
+        lane8f_t _y = lane8f_load_aligned( v.y + i );
+        lane8f_t _z = lane8f_load_aligned( v.z + i );
+
+        lane8f_t _mag = lane8f_mul( _x, _x );
+        _mag = lane8f_fmadd( _y, _y, _mag );
+        _mag = lane8f_fmadd( _z, _z, _mag );
+        _mag = lane8f_sqrt( _mag );
+
+        lane8b_t _degenerate = lane8f_cmp_lt( _mag, _threshold );
+        lane8f_t _inv_mag    = lane8f_select(
+            _degenerate, _zero, lane8f_div( lane8f_set_scalar( 1.0f ), _mag ) );
+
+        lane8f_store_aligned( lane8f_mul( _x, _inv_mag ), out_result.x + i );
+        lane8f_store_aligned( lane8f_mul( _y, _inv_mag ), out_result.y + i );
+        lane8f_store_aligned( lane8f_mul( _z, _inv_mag ), out_result.z + i );
+    }
+    out_result.count = v.count;
+}
+SMATH_INLINE void normalize_n( const vec4_soa& v, vec4_soa& out_result ) {
+    using namespace simd;
+    const lane8f_t _threshold = lane8f_set_scalar( 0.0001f );
+    const lane8f_t _zero      = lane8f_set_zero();
+
+    for( usize i = 0; i < v.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _x = lane8f_load_aligned( v.x + i );
+        lane8f_t _y = lane8f_load_aligned( v.y + i );
+        lane8f_t _z = lane8f_load_aligned( v.z + i );
+        lane8f_t _w = lane8f_load_aligned( v.w + i );
+
+        lane8f_t _mag = lane8f_mul( _x, _x );
+        _mag = lane8f_fmadd( _y, _y, _mag );
+        _mag = lane8f_fmadd( _z, _z, _mag );
+        _mag = lane8f_fmadd( _w, _w, _mag );
+        _mag = lane8f_sqrt( _mag );
+
+        lane8b_t _degenerate = lane8f_cmp_lt( _mag, _threshold );
+        lane8f_t _inv_mag    = lane8f_select(
+            _degenerate, _zero, lane8f_div( lane8f_set_scalar( 1.0f ), _mag ) );
+
+        lane8f_store_aligned( lane8f_mul( _x, _inv_mag ), out_result.x + i );
+        lane8f_store_aligned( lane8f_mul( _y, _inv_mag ), out_result.y + i );
+        lane8f_store_aligned( lane8f_mul( _z, _inv_mag ), out_result.z + i );
+        lane8f_store_aligned( lane8f_mul( _w, _inv_mag ), out_result.w + i );
+    }
+    out_result.count = v.count;
+}
+SMATH_INLINE void dot_n( const vec3_soa& lhs, const vec3_soa& rhs, f32* out_result ) {
+    using namespace simd;
+    for( usize i = 0; i < lhs.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _dot = lane8f_mul(
+            lane8f_load_aligned( lhs.x + i ), lane8f_load_aligned( rhs.x + i ) );
+        _dot = lane8f_fmadd(
+            lane8f_load_aligned( lhs.y + i ), lane8f_load_aligned( rhs.y + i ), _dot );
+        _dot = lane8f_fmadd(
+            lane8f_load_aligned( lhs.z + i ), lane8f_load_aligned( rhs.z + i ), _dot );
+
+        internal::soa_store_lane( _dot, out_result + i, lhs.count - i );
+    }
+}
+SMATH_INLINE void dot_n( const vec4_soa& lhs, const vec4_soa& rhs, f32* out_result ) {
+    using namespace simd;
+    for( usize i = 0; i < lhs.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _dot = lane8f_mul(
+            lane8f_load_aligned( lhs.x + i ), lane8f_load_aligned( rhs.x + i ) );
+        _dot = lane8f_fmadd(
+            lane8f_load_aligned( lhs.y + i ), lane8f_load_aligned( rhs.y + i ), _dot );
+        _dot = lane8f_fmadd(
+            lane8f_load_aligned( lhs.z + i ), lane8f_load_aligned( rhs.z + i ), _dot );
+        _dot = lane8f_fmadd(
+            lane8f_load_aligned( lhs.w + i ), lane8f_load_aligned( rhs.w + i ), _dot );
+
+        internal::soa_store_lane( _dot, out_result + i, lhs.count - i );
+    }
+}
+SMATH_INLINE void cross_n( const vec3_soa& lhs, const vec3_soa& rhs, vec3_soa& out_result ) {
+    using namespace simd;
+    for( usize i = 0; i < lhs.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _lx = lane8f_load_aligned( lhs.x + i );
+        lane8f_t _ly = lane8f_load_aligned( lhs.y + i );
+        lane8f_t _lz = lane8f_load_aligned( lhs.z + i );
+        lane8f_t _rx = lane8f_load_aligned( rhs.x + i );
+        lane8f_t _ry = lane8f_load_aligned( rhs.y + i );
+        lane8f_t _rz = lane8f_load_aligned( rhs.z + i );
+
+        lane8f_store_aligned(
+            lane8f_fmsub( _ly, _rz, lane8f_mul( _lz, _ry ) ), out_result.x + i );
+        lane8f_store_aligned(
+            lane8f_fmsub( _lz, _rx, lane8f_mul( _lx, _rz ) ), out_result.y + i );
+        lane8f_store_aligned(
+            lane8f_fmsub( _lx, _ry, lane8f_mul( _ly, _rx ) ), out_result.z + i );
+    }
+    out_result.count = lhs.count;
+}
+SMATH_INLINE void lerp_n( const vec3_soa& a, const vec3_soa& b, f32 t, vec3_soa& out_result ) {
+    using namespace simd;
+    const lane8f_t _t = lane8f_set_scalar( t );
+    // a + ( b - a ) * t
+    for( usize i = 0; i < a.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _ax = lane8f_load_aligned( a.x + i );
+        lane8f_t _ay = lane8f_load_aligned( a.y + i );
+        lane8f_t _az = lane8f_load_aligned( a.z + i );
+
+        lane8f_store_aligned( lane8f_fmadd(
+            lane8f_sub( lane8f_load_aligned( b.x + i ), _ax ), _t, _ax ), out_result.x + i );
+        lane8f_store_aligned( lane8f_fmadd(
+            lane8f_sub( lane8f_load_aligned( b.y + i ), _ay ), _t, _ay ), out_result.y + i );
+        lane8f_store_aligned( lane8f_fmadd(
+            lane8f_sub( lane8f_load_aligned( b.z + i ), _az ), _t, _az ), out_result.z + i );
+    }
+    out_result.count = a.count;
+}
+SMATH_INLINE void lerp_n( const vec4_soa& a, const vec4_soa& b, f32 t, vec4_soa& out_result ) {
+    using namespace simd;
+    const lane8f_t _t = lane8f_set_scalar( t );
+    // a + ( b - a ) * t
+    for( usize i = 0; i < a.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _ax = lane8f_load_aligned( a.x + i );
+        lane8f_t _ay = lane8f_load_aligned( a.y + i );
+        lane8f_t _az = lane8f_load_aligned( a.z + i );
+        lane8f_t _aw = lane8f_load_aligned( a.w + i );
+
+        lane8f_store_aligned( lane8f_fmadd(
+            lane8f_sub( lane8f_load_aligned( b.x + i ), _ax ), _t, _ax ), out_result.x + i );
+        lane8f_store_aligned( lane8f_fmadd(
+            lane8f_sub( lane8f_load_aligned( b.y + i ), _ay ), _t, _ay ), out_result.y + i );
+        lane8f_store_aligned( lane8f_fmadd(
+            lane8f_sub( lane8f_load_aligned( b.z + i ), _az ), _t, _az ), out_result.z + i );
+        lane8f_store_aligned( lane8f_fmadd(
+            lane8f_sub( lane8f_load_aligned( b.w + i ), _aw ), _t, _aw ), out_result.w + i );
+    }
+    out_result.count = a.count;
+}
+SMATH_INLINE void mag_n( const vec3_soa& v, f32* out_result ) {
+    using namespace simd;
+    for( usize i = 0; i < v.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _x = lane8f_load_aligned( v.x + i );
+        lane8f_t _y = lane8f_load_aligned( v.y + i );
+        lane8f_t _z = lane8f_load_aligned( v.z + i );
+
+        lane8f_t _mag = lane8f_mul( _x, _x );
+        _mag = lane8f_fmadd( _y, _y, _mag );
+        _mag = lane8f_fmadd( _z, _z, _mag );
+
+        internal::soa_store_lane( lane8f_sqrt( _mag ), out_result + i, v.count - i );
+    }
+}
+SMATH_INLINE void mag_n( const vec4_soa& v, f32* out_result ) {
+    using namespace simd;
+    for( usize i = 0; i < v.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _x = lane8f_load_aligned( v.x + i );
+        lane8f_t _y = lane8f_load_aligned( v.y + i );
+        lane8f_t _z = lane8f_load_aligned( v.z + i );
+        lane8f_t _w = lane8f_load_aligned( v.w + i );
+
+        lane8f_t _mag = lane8f_mul( _x, _x );
+        _mag = lane8f_fmadd( _y, _y, _mag );
+        _mag = lane8f_fmadd( _z, _z, _mag );
+        _mag = lane8f_fmadd( _w, _w, _mag );
+
+        internal::soa_store_lane( lane8f_sqrt( _mag ), out_result + i, v.count - i );
+    }
+}
+
+namespace internal {
+
+// NOTE(alicia): quaternion interpolation kernels work on one lane of
+// eight quaternion pairs, the _n functions only differ in how t is loaded
+
+enum quat_interp_mode {
+    QUAT_INTERP_NLERP,
+    QUAT_INTERP_NLERP_CORRECTED,
+    QUAT_INTERP_SLERP,
+};
+
+inline void quat_interp_lane(
+    const quat_soa& a, const quat_soa& b, usize i,
+    simd::lane8f_t _t, quat_interp_mode mode, quat_soa& out_result
+) {
+    using namespace simd;
+    lane8f_t _aw = lane8f_load_aligned( a.w + i );
+    lane8f_t _ax = lane8f_load_aligned( a.x + i );
+    lane8f_t _ay = lane8f_load_aligned( a.y + i );
+    lane8f_t _az = lane8f_load_aligned( a.z + i );
+    lane8f_t _bw = lane8f_load_aligned( b.w + i );
+    lane8f_t _bx = lane8f_load_aligned( b.x + i );
+    lane8f_t _by = lane8f_load_aligned( b.y + i );
+    lane8f_t _bz = lane8f_load_aligned( b.z + i );
+
+    lane8f_t _cos = lane8f_mul( _aw, _bw );
+    _cos = lane8f_fmadd( _ax, _bx, _cos );
+    _cos = lane8f_fmadd( _ay, _by, _cos );
+    _cos = lane8f_fmadd( _az, _bz, _cos );
+
+    // NOTE(alicia): flip b into the same hemisphere as a by flipping its weight
+    lane8i_t _sign = lane8i_and(
+        lane8f_as_lane8i( _cos ), lane8i_set_scalar( (i32)0x80000000 ) );
+    _cos = lane8f_abs( _cos );
+
+    const lane8f_t _one = lane8f_set_scalar( 1.0f );
+    lane8f_t _wa, _wb;
+    switch( mode ) {
+        case QUAT_INTERP_NLERP: {
+            _wa = lane8f_sub( _one, _t );
+            _wb = _t;
+        } break;
+        case QUAT_INTERP_NLERP_CORRECTED: {
+            // NOTE(alicia): cubic in t fitted against slerp,
+            // k depends on the angle between a and b
+            const lane8f_t _half = lane8f_set_scalar( 0.5f );
+            lane8f_t _ka = lane8f_fmadd( _cos, lane8f_set_scalar( -1.43519f ), lane8f_set_scalar( 3.55645f ) );
+            _ka = lane8f_fmadd( _ka, _cos, lane8f_set_scalar( -3.2452f ) );
+            _ka = lane8f_fmadd( _ka, _cos, lane8f_set_scalar( 1.0904f ) );
+            lane8f_t _kb = lane8f_fmadd( _cos, lane8f_set_scalar( 0.215638f ), lane8f_set_scalar( -1.06021f ) );
+            _kb = lane8f_fmadd( _kb, _cos, lane8f_set_scalar( 0.848013f ) );
+
+            lane8f_t _centered = lane8f_sub( _t, _half );
+            lane8f_t _k = lane8f_fmadd( lane8f_mul( _centered, _centered ), _ka, _kb );
+            // t + t * ( t - 0.5 ) * ( t - 1 ) * k
+            lane8f_t _correction = lane8f_mul(
+                lane8f_mul( _t, _centered ), lane8f_mul( lane8f_sub( _t, _one ), _k ) );
+            _wb = lane8f_add( _t, _correction );
+            _wa = lane8f_sub( _one, _wb );
+        } break;
+        case QUAT_INTERP_SLERP: {
+            lane8f_t _theta   = lane8f_acos( _cos );
+            lane8f_t _inv_sin = lane8f_div( _one, lane8f_sqrt(
+                lane8f_mul( lane8f_sub( _one, _cos ), lane8f_add( _one, _cos ) ) ) );
+            lane8f_t _sa = lane8f_mul( lane8f_sin( lane8f_mul( lane8f_sub( _one, _t ), _theta ) ), _inv_sin );
+            lane8f_t _sb = lane8f_mul( lane8f_sin( lane8f_mul( _t, _theta ) ), _inv_sin );
+
+            // NOTE(alicia): sin(theta) goes to 0 as a and b get close, fall back to lerp
+            lane8b_t _close = lane8f_cmp_gt( _cos, lane8f_set_scalar( 1.0f - F32::EPSILON ) );
+            _wa = lane8f_select( _close, lane8f_sub( _one, _t ), _sa );
+            _wb = lane8f_select( _close, _t, _sb );
+        } break;
+    }
+    _wb = lane8i_as_lane8f( lane8i_xor( lane8f_as_lane8i( _wb ), _sign ) );
+
+    lane8f_t _w = lane8f_fmadd( _bw, _wb, lane8f_mul( _aw, _wa ) );
+    lane8f_t _x = lane8f_fmadd( _bx, _wb, lane8f_mul( _ax, _wa ) );
+    lane8f_t _y = lane8f_fmadd( _by, _wb, lane8f_mul( _ay, _wa ) );
+    lane8f_t _z = lane8f_fmadd( _bz, _wb, lane8f_mul( _az, _wa ) );
+
+    if( mode != QUAT_INTERP_SLERP ) {
+        lane8f_t _mag = lane8f_mul( _w, _w );
+        _mag = lane8f_fmadd( _x, _x, _mag );
+        _mag = lane8f_fmadd( _y, _y, _mag );
+        _mag = lane8f_fmadd( _z, _z, _mag );
+        // NOTE(alicia): padding lanes are zero, keep them zero instead of NaN
+        lane8f_t _inv_mag = lane8f_select( lane8f_cmp_gt( _mag, lane8f_set_zero() ),
+            lane8f_div( _one, lane8f_sqrt( _mag ) ), lane8f_set_zero() );
+
+        _w = lane8f_mul( _w, _inv_mag );
+        _x = lane8f_mul( _x, _inv_mag );
+        _y = lane8f_mul( _y, _inv_mag );
+        _z = lane8f_mul( _z, _inv_mag );
+    }
+
+    lane8f_store_aligned( _w, out_result.w + i );
+    lane8f_store_aligned( _x, out_result.x + i );
+    lane8f_store_aligned( _y, out_result.y + i );
+    lane8f_store_aligned( _z, out_result.z + i );
+}
+inline void quat_interp_n(
+    const quat_soa& a, const quat_soa& b, f32 t,
+    quat_interp_mode mode, quat_soa& out_result
+) {
+    const simd::lane8f_t _t = simd::lane8f_set_scalar( t );
+    for( usize i = 0; i < a.count; i += SOA_LANE_WIDTH ) {
+        quat_interp_lane( a, b, i, _t, mode, out_result );
+    }
+    out_result.count = a.count;
+}
+inline void quat_interp_n(
+    const quat_soa& a, const quat_soa& b, const f32* t,
+    quat_interp_mode mode, quat_soa& out_result
+) {
+    using namespace simd;
+    for( usize i = 0; i < a.count; i += SOA_LANE_WIDTH ) {
+        usize remaining = a.count - i;
+        lane8f_t _t = remaining >= SOA_LANE_WIDTH ?
+            lane8f_load_unaligned( t + i ) : lane8f_load_partial( t + i, remaining );
+        quat_interp_lane( a, b, i, _t, mode, out_result );
+    }
+    out_result.count = a.count;
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE void slerp_n( const quat_soa& a, const quat_soa& b, f32 t, quat_soa& out_result ) {
+    internal::quat_interp_n( a, b, t, internal::QUAT_INTERP_SLERP, out_result );
+}
+SMATH_INLINE void slerp_n( const quat_soa& a, const quat_soa& b, const f32* t, quat_soa& out_result ) {
+    internal::quat_interp_n( a, b, t, internal::QUAT_INTERP_SLERP, out_result );
+}
+SMATH_INLINE void nlerp_n( const quat_soa& a, const quat_soa& b, f32 t, quat_soa& out_result ) {
+    internal::quat_interp_n( a, b, t, internal::QUAT_INTERP_NLERP, out_result );
+}
+SMATH_INLINE void nlerp_n( const quat_soa& a, const quat_soa& b, const f32* t, quat_soa& out_result ) {
+    internal::quat_interp_n( a, b, t, internal::QUAT_INTERP_NLERP, out_result );
+}
+SMATH_INLINE void nlerp_corrected_n( const quat_soa& a, const quat_soa& b, f32 t, quat_soa& out_result ) {
+    internal::quat_interp_n( a, b, t, internal::QUAT_INTERP_NLERP_CORRECTED, out_result );
+}
+SMATH_INLINE void nlerp_corrected_n( const quat_soa& a, const quat_soa& b, const f32* t, quat_soa& out_result ) {
+    internal::quat_interp_n( a, b, t, internal::QUAT_INTERP_NLERP_CORRECTED, out_result );
+}
+
+// NOTE(alicia): curve
+
+namespace internal {
+
+inline curve_key* curve_keys( const curve& c ) {
+    return (curve_key*)c.keys.buffer;
+}
+// NOTE(alicia): find key that starts the segment containing time,
+// time must be inside the first and last key
+inline usize curve_find_segment( curve& c, f32 time ) {
+    const curve_key* keys = curve_keys( c );
+    usize last = c.keys.count - 1;
+
+    usize segment = c.segment < last ? c.segment : 0;
+    if( keys[segment].time <= time && time <= keys[segment + 1].time ) {
+        return segment;
+    }
+    if( segment + 2 <= last &&
+        keys[segment + 1].time <= time && time <= keys[segment + 2].time
+    ) {
+        return segment + 1;
+    }
+
+    usize low  = 0;
+    usize high = last;
+    while( high - low > 1 ) {
+        usize mid = low + ( ( high - low ) / 2 );
+        if( keys[mid].time <= time ) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+// NOTE(alicia): every interpolation mode is reduced to a hermite segment
+// over t in 0-1, linear uses the chord as both tangents and
+// bezier control points sit at a third of the tangent.
+// returns t and writes value 0, tangent 0, value 1, tangent 1
+inline f32 curve_segment( curve& c, f32 time, f32 out_hermite[4] ) {
+    const curve_key* keys = curve_keys( c );
+    usize last = c.keys.count - 1;
+    if( !last || time <= keys[0].time ) {
+        out_hermite[0] = out_hermite[2] = keys[0].value;
+        out_hermite[1] = out_hermite[3] = 0.0f;
+        return 0.0f;
+    }
+    if( time >= keys[last].time ) {
+        out_hermite[0] = out_hermite[2] = keys[last].value;
+        out_hermite[1] = out_hermite[3] = 0.0f;
+        return 0.0f;
+    }
+
+    usize segment = curve_find_segment( c, time );
+    c.segment = segment;
+
+    const curve_key& k0 = keys[segment];
+    const curve_key& k1 = keys[segment + 1];
+    f32 duration = k1.time - k0.time;
+    f32 t = duration > 0.0f ? ( time - k0.time ) / duration : 1.0f;
+
+    out_hermite[0] = k0.value;
+    out_hermite[2] = k1.value;
+    switch( c.interp ) {
+        case CURVE_INTERP_LINEAR: {
+            out_hermite[1] = out_hermite[3] = k1.value - k0.value;
+        } break;
+        case CURVE_INTERP_HERMITE: {
+            out_hermite[1] = k0.out_tangent * duration;
+            out_hermite[3] = k1.in_tangent * duration;
+        } break;
+        case CURVE_INTERP_BEZIER: {
+            out_hermite[1] = 3.0f * ( k0.out_tangent - k0.value );
+            out_hermite[3] = 3.0f * ( k1.value - k1.in_tangent );
+        } break;
+    }
+    return t;
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE bool32 curve_create( curve_interp interp, usize capacity, curve* out_result ) {
+    *out_result = {};
+    out_result->interp       = interp;
+    out_result->keys.stride  = sizeof(curve_key);
+    if( capacity ) {
+        return list_create( sizeof(curve_key), capacity, &out_result->keys );
+    }
+    return true;
+}
+SMATH_INLINE bool32 curve_create(
+    curve_interp interp, const curve_key* keys, usize count, curve* out_result
+) {
+    if( !curve_create( interp, count, out_result ) ) {
+        return false;
+    }
+    for( usize i = 0; i < count; ++i ) {
+        curve_push_key( *out_result, keys[i] );
+    }
+    return true;
+}
+SMATH_INLINE void curve_free( curve* c ) {
+    if( c->keys.buffer ) {
+        list_free( &c->keys );
+    }
+    *c = {};
+}
+SMATH_INLINE bool32 curve_push_key( curve& c, const curve_key& key ) {
+    curve_key value = key;
+    if( !list_push_realloc( &c.keys, &value ) ) {
+        return false;
+    }
+    // NOTE(alicia): insertion sort step, keys with equal time keep insertion order
+    curve_key* keys = internal::curve_keys( c );
+    usize index = c.keys.count - 1;
+    while( index && keys[index - 1].time > value.time ) {
+        keys[index] = keys[index - 1];
+        --index;
+    }
+    keys[index] = value;
+    return true;
+}
+SMATH_INLINE f32 sample( curve& c, f32 time ) {
+    if( !c.keys.count ) {
+        return 0.0f;
+    }
+    f32 hermite[4];
+    f32 t = internal::curve_segment( c, time, hermite );
+    if( c.interp == CURVE_INTERP_LINEAR ) {
+        return lerp( hermite[0], hermite[2], t );
+    }
+
+    f32 t2 = t * t;
+    f32 t3 = t2 * t;
+    return
+        ( ( 2.0f * t3 ) - ( 3.0f * t2 ) + 1.0f ) * hermite[0] +
+        ( t3 - ( 2.0f * t2 ) + t ) * hermite[1] +
+        ( ( -2.0f * t3 ) + ( 3.0f * t2 ) ) * hermite[2] +
+        ( t3 - t2 ) * hermite[3];
+}
+SMATH_INLINE void sample_n( curve* curves, usize count, f32 time, f32* out_result ) {
+    using namespace simd;
+    // NOTE(alicia): segment lookup is scalar, evaluation runs eight curves
+    // per lane as v0 + t * ( m0 + t * ( c2 + t * c3 ) )
+    alignas(SOA_ALIGNMENT) f32 t[SOA_LANE_WIDTH];
+    alignas(SOA_ALIGNMENT) f32 hermite[4][SOA_LANE_WIDTH];
+
+    for( usize i = 0; i < count; i += SOA_LANE_WIDTH ) {
+        usize lanes = min( count - i, (usize)SOA_LANE_WIDTH );
+        for( usize lane = 0; lane < SOA_LANE_WIDTH; ++lane ) {
+            f32 segment[4] = {};
+            t[lane] = 0.0f;
+            if( lane < lanes && curves[i + lane].keys.count ) {
+                t[lane] = internal::curve_segment( curves[i + lane], time, segment );
+            }
+            hermite[0][lane] = segment[0];
+            hermite[1][lane] = segment[1];
+            hermite[2][lane] = segment[2];
+            hermite[3][lane] = segment[3];
+        }
+
+        lane8f_t _t  = lane8f_load_aligned( t );
+        lane8f_t _v0 = lane8f_load_aligned( hermite[0] );
+        lane8f_t _m0 = lane8f_load_aligned( hermite[1] );
+        lane8f_t _v1 = lane8f_load_aligned( hermite[2] );
+        lane8f_t _m1 = lane8f_load_aligned( hermite[3] );
+
+        // c2 = 3 * ( v1 - v0 ) - 2 * m0 - m1
+        // c3 = 2 * ( v0 - v1 ) + m0 + m1
+        lane8f_t _delta = lane8f_sub( _v1, _v0 );
+        lane8f_t _c2 = lane8f_fmsub( _delta, lane8f_set_scalar( 3.0f ),
+            lane8f_fmadd( _m0, lane8f_set_scalar( 2.0f ), _m1 ) );
+        lane8f_t _c3 = lane8f_fnmadd( _delta, lane8f_set_scalar( 2.0f ),
+            lane8f_add( _m0, _m1 ) );
+
+        lane8f_t _result = lane8f_fmadd( _c3, _t, _c2 );
+        _result = lane8f_fmadd( _result, _t, _m0 );
+        _result = lane8f_fmadd( _result, _t, _v0 );
+
+        internal::soa_store_lane( _result, out_result + i, lanes );
+    }
+}
+
+// NOTE(alicia): bounding volumes
+
+SMATH_INLINE aabb aabb::create( const vec3& min, const vec3& max ) {
+    return { min, max };
+}
+SMATH_INLINE aabb aabb::from_center_extents( const vec3& center, const vec3& extents ) {
+    return { center - extents, center + extents };
+}
+SMATH_INLINE vec3 center( const aabb& box ) {
+    return ( box.min + box.max ) * 0.5f;
+}
+SMATH_INLINE vec3 extents( const aabb& box ) {
+    return ( box.max - box.min ) * 0.5f;
+}
+SMATH_INLINE aabb merge( const aabb& a, const aabb& b ) {
+    return {
+        { min( a.min.x, b.min.x ), min( a.min.y, b.min.y ), min( a.min.z, b.min.z ) },
+        { max( a.max.x, b.max.x ), max( a.max.y, b.max.y ), max( a.max.z, b.max.z ) }
+    };
+}
+SMATH_INLINE bool32 contains( const aabb& box, const vec3& point ) {
+    return
+        point.x >= box.min.x && point.x <= box.max.x &&
+        point.y >= box.min.y && point.y <= box.max.y &&
+        point.z >= box.min.z && point.z <= box.max.z;
+}
+SMATH_INLINE bool32 overlaps( const aabb& a, const aabb& b ) {
+    return
+        a.min.x <= b.max.x && a.max.x >= b.min.x &&
+        a.min.y <= b.max.y && a.max.y >= b.min.y &&
+        a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
+SMATH_INLINE sphere sphere::create( const vec3& center, f32 radius ) {
+    return { center, radius };
+}
+SMATH_INLINE bool32 contains( const sphere& s, const vec3& point ) {
+    return sqr_mag( point - s.center ) <= s.radius * s.radius;
+}
+SMATH_INLINE bool32 overlaps( const sphere& a, const sphere& b ) {
+    f32 radius = a.radius + b.radius;
+    return sqr_mag( a.center - b.center ) <= radius * radius;
+}
+SMATH_INLINE bool32 overlaps( const aabb& box, const sphere& s ) {
+    vec3 closest = {
+        clamp( s.center.x, box.min.x, box.max.x ),
+        clamp( s.center.y, box.min.y, box.max.y ),
+        clamp( s.center.z, box.min.z, box.max.z )
+    };
+    return contains( s, closest );
+}
+SMATH_INLINE frustum frustum::create( const mat4& view_projection ) {
+    const mat4& m = view_projection;
+    // NOTE(alicia): planes are sums of the w row with the x/y/z rows
+    vec4 row0 = { m._m00, m._m10, m._m20, m._m30 };
+    vec4 row1 = { m._m01, m._m11, m._m21, m._m31 };
+    vec4 row2 = { m._m02, m._m12, m._m22, m._m32 };
+    vec4 row3 = { m._m03, m._m13, m._m23, m._m33 };
+
+    frustum result;
+    result.planes[0] = row3 + row0;
+    result.planes[1] = row3 - row0;
+    result.planes[2] = row3 + row1;
+    result.planes[3] = row3 - row1;
+    result.planes[4] = row3 + row2;
+    result.planes[5] = row3 - row2;
+    for( u32 i = 0; i < 6; ++i ) {
+        vec4& plane = result.planes[i];
+        plane = plane / mag( vec3::create( plane ) );
+    }
+    return result;
+}
+SMATH_INLINE bool32 intersects( const frustum& f, const sphere& s ) {
+    for( u32 i = 0; i < 6; ++i ) {
+        const vec4& plane = f.planes[i];
+        if( dot( vec3::create( plane ), s.center ) + plane.w < -s.radius ) {
+            return false;
+        }
+    }
+    return true;
+}
+SMATH_INLINE bool32 intersects( const frustum& f, const aabb& box ) {
+    vec3 box_center  = center( box );
+    vec3 box_extents = extents( box );
+    for( u32 i = 0; i < 6; ++i ) {
+        const vec4& plane = f.planes[i];
+        f32 reach =
+            absolute( plane.x ) * box_extents.x +
+            absolute( plane.y ) * box_extents.y +
+            absolute( plane.z ) * box_extents.z;
+        if( dot( vec3::create( plane ), box_center ) + plane.w < -reach ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace internal {
+
+// NOTE(alicia): clears list for items of stride bytes and makes room for count items.
+// capacity is recounted from size since the list may have been made with a different stride,
+// a buffer too small for a single item is grown so list_push_realloc doesn't recreate (and leak) it
+inline bool32 list_reserve_items( list_t* list, usize stride, usize count ) {
+    list->stride   = stride;
+    list->count    = 0;
+    list->capacity = list->size / stride;
+    if( list->capacity >= count && ( list->capacity || !list->buffer ) ) {
+        return true;
+    }
+    return list_realloc( list, max( count, (usize)1 ) );
+}
+// NOTE(alicia): capacity must cover padded lanes, cull_append writes one past the last visible index
+inline bool32 cull_reserve( list_t* list, usize count ) {
+    return list_reserve_items( list, sizeof(u32), count );
+}
+// NOTE(alicia): append index of every set bit in lane mask,
+// written unconditionally so output stays compact without a branch per item
+inline void cull_append( list_t* list, u32 mask, usize first ) {
+    u32* indices = (u32*)list->buffer;
+    usize count  = list->count;
+    for( u32 lane = 0; lane < SOA_LANE_WIDTH; ++lane ) {
+        indices[count] = (u32)first + lane;
+        count += ( mask >> lane ) & 1;
+    }
+    list->count = count;
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE bool32 cull_spheres(
+    const frustum& f, const vec3_soa& centers,
+    const f32* radii, list_t* out_visible
+) {
+    using namespace simd;
+    if( !internal::cull_reserve( out_visible, internal::soa_padded( centers.count ) ) ) {
+        return false;
+    }
+
+    lane8f_t _planes[6][4];
+    for( u32 i = 0; i < 6; ++i ) {
+        _planes[i][0] = lane8f_set_scalar( f.planes[i].x );
+        _planes[i][1] = lane8f_set_scalar( f.planes[i].y );
+        _planes[i][2] = lane8f_set_scalar( f.planes[i].z );
+        _planes[i][3] = lane8f_set_scalar( f.planes[i].w );
+    }
+
+    for( usize i = 0; i < centers.count; i += SOA_LANE_WIDTH ) {
+        usize remaining = centers.count - i;
+        lane8f_t _x = lane8f_load_aligned( centers.x + i );
+        lane8f_t _y = lane8f_load_aligned( centers.y + i );
+        lane8f_t _z = lane8f_load_aligned( centers.z + i );
+        lane8f_t _neg_radius = lane8f_sub( lane8f_set_zero(), remaining >= SOA_LANE_WIDTH ?
+            lane8f_load_unaligned( radii + i ) : lane8f_load_partial( radii + i, remaining ) );
+
+        lane8b_t _visible = lane8f_cmp_eq( _x, _x );
+        for( u32 p = 0; p < 6; ++p ) {
+            lane8f_t _distance = lane8f_fmadd( _planes[p][0], _x, _planes[p][3] );
+            _distance = lane8f_fmadd( _planes[p][1], _y, _distance );
+            _distance = lane8f_fmadd( _planes[p][2], _z, _distance );
+            _visible  = lane8b_and( _visible, lane8f_cmp_ge( _distance, _neg_radius ) );
+        }
+
+        u32 mask = lane8b_bitmask( _visible );
+        if( remaining < SOA_LANE_WIDTH ) {
+            mask &= ( 1u << remaining ) - 1;
+        }
+        internal::cull_append( out_visible, mask, i );
+    }
+    return true;
+}
+SMATH_INLINE bool32 cull_aabbs(
+    const frustum& f, const vec3_soa& centers,
+    const vec3_soa& extents, list_t* out_visible
+) {
+    using namespace simd;
+    if( !internal::cull_reserve( out_visible, internal::soa_padded( centers.count ) ) ) {
+        return false;
+    }
+
+    lane8f_t _planes[6][4];
+    lane8f_t _abs_normals[6][3];
+    for( u32 i = 0; i < 6; ++i ) {
+        _planes[i][0] = lane8f_set_scalar( f.planes[i].x );
+        _planes[i][1] = lane8f_set_scalar( f.planes[i].y );
+        _planes[i][2] = lane8f_set_scalar( f.planes[i].z );
+        _planes[i][3] = lane8f_set_scalar( f.planes[i].w );
+        _abs_normals[i][0] = lane8f_set_scalar( absolute( f.planes[i].x ) );
+        _abs_normals[i][1] = lane8f_set_scalar( absolute( f.planes[i].y ) );
+        _abs_normals[i][2] = lane8f_set_scalar( absolute( f.planes[i].z ) );
+    }
+
+    for( usize i = 0; i < centers.count; i += SOA_LANE_WIDTH ) {
+        lane8f_t _x  = lane8f_load_aligned( centers.x + i );
+        lane8f_t _y  = lane8f_load_aligned( centers.y + i );
+        lane8f_t _z  = lane8f_load_aligned( centers.z + i );
+        lane8f_t _ex = lane8f_load_aligned( extents.x + i );
+        lane8f_t _ey = lane8f_load_aligned( extents.y + i );
+        lane8f_t _ez = lane8f_load_aligned( extents.z + i );
+
+        lane8b_t _visible = lane8f_cmp_eq( _x, _x );
+        for( u32 p = 0; p < 6; ++p ) {
+            // distance + reach >= 0 where reach = dot( abs( normal ), extents )
+            lane8f_t _distance = lane8f_fmadd( _planes[p][0], _x, _planes[p][3] );
+            _distance = lane8f_fmadd( _planes[p][1], _y, _distance );
+            _distance = lane8f_fmadd( _planes[p][2], _z, _distance );
+            _distance = lane8f_fmadd( _abs_normals[p][0], _ex, _distance );
+            _distance = lane8f_fmadd( _abs_normals[p][1], _ey, _distance );
+            _distance = lane8f_fmadd( _abs_normals[p][2], _ez, _distance );
+            _visible  = lane8b_and( _visible, lane8f_cmp_ge( _distance, lane8f_set_zero() ) );
+        }
+
+        u32 mask = lane8b_bitmask( _visible );
+        usize remaining = centers.count - i;
+        if( remaining < SOA_LANE_WIDTH ) {
+            mask &= ( 1u << remaining ) - 1;
+        }
+        internal::cull_append( out_visible, mask, i );
+    }
+    return true;
+}
+
+// NOTE(alicia): ray
+
+SMATH_INLINE ray ray::create( const vec3& origin, const vec3& direction ) {
+    return { origin, direction };
+}
+SMATH_INLINE vec3 point_at( const ray& r, f32 distance ) {
+    return r.origin + r.direction * distance;
+}
+SMATH_INLINE bool32 raycast( const ray& r, const aabb& box, f32 max_distance, f32* out_distance ) {
+    f32 near = 0.0f;
+    f32 far  = max_distance;
+    for( u32 axis = 0; axis < 3; ++axis ) {
+        f32 inv_direction = 1.0f / r.direction[axis];
+        f32 t0 = ( box.min[axis] - r.origin[axis] ) * inv_direction;
+        f32 t1 = ( box.max[axis] - r.origin[axis] ) * inv_direction;
+        // NOTE(alicia): 0 * inf, ray runs along a slab plane so the slab doesn't clip it
+        if( t0 != t0 || t1 != t1 ) {
+            continue;
+        }
+        near = max( near, min( t0, t1 ) );
+        far  = min( far, max( t0, t1 ) );
+    }
+    if( near > far ) {
+        return false;
+    }
+    *out_distance = near;
+    return true;
+}
+SMATH_INLINE bool32 raycast(
+    const ray& r, const vec3& a, const vec3& b, const vec3& c,
+    f32 max_distance, f32* out_distance, f32* out_u, f32* out_v
+) {
+    // NOTE(alicia): moller-trumbore
+    vec3 edge0 = b - a;
+    vec3 edge1 = c - a;
+    vec3 p     = cross( r.direction, edge1 );
+    f32  det   = dot( edge0, p );
+    if( absolute( det ) < F32::EPSILON ) {
+        return false;
+    }
+    f32  inv_det = 1.0f / det;
+    vec3 to_origin = r.origin - a;
+
+    f32 u = dot( to_origin, p ) * inv_det;
+    if( u < 0.0f || u > 1.0f ) {
+        return false;
+    }
+    vec3 q = cross( to_origin, edge0 );
+    f32  v = dot( r.direction, q ) * inv_det;
+    if( v < 0.0f || u + v > 1.0f ) {
+        return false;
+    }
+    f32 distance = dot( edge1, q ) * inv_det;
+    if( distance < 0.0f || distance > max_distance ) {
+        return false;
+    }
+    *out_distance = distance;
+    *out_u = u;
+    *out_v = v;
+    return true;
+}
+
+// NOTE(alicia): bvh
+
+#define BVH_BIN_COUNT      16
+#define BVH_MAX_LEAF_SIZE  8
+#define BVH_MAX_DEPTH      48
+// NOTE(alicia): past max depth ranges are halved, which adds at most 32 levels,
+// every level leaves up to 3 siblings on the stack
+#define BVH_STACK_SIZE     ( ( ( BVH_MAX_DEPTH + 32 ) * 3 ) + 1 )
+#define BVH_NODE_ALIGNMENT 64
+
+namespace internal {
+
+inline aabb aabb_empty() {
+    return {
+        { F32::MAX, F32::MAX, F32::MAX },
+        { -F32::MAX, -F32::MAX, -F32::MAX }
+    };
+}
+inline f32 aabb_half_area( const aabb& box ) {
+    vec3 size = box.max - box.min;
+    return ( size.x * size.y ) + ( size.y * size.z ) + ( size.z * size.x );
+}
+inline aabb triangle_bounds( const vec3* vertices ) {
+    aabb result = { vertices[0], vertices[0] };
+    for( u32 i = 1; i < 3; ++i ) {
+        result = merge( result, { vertices[i], vertices[i] } );
+    }
+    return result;
+}
+
+struct bvh_builder {
+    bvh*  tree;
+    vec3* centroids;
+};
+
+inline aabb bvh_range_bounds( const bvh& tree, u32 first, u32 count ) {
+    aabb result = aabb_empty();
+    for( u32 i = first; i < first + count; ++i ) {
+        result = merge( result, tree.bounds[tree.indices[i]] );
+    }
+    return result;
+}
+inline u32 bvh_bin( f32 value, f32 min, f32 scale ) {
+    u32 bin = (u32)( ( value - min ) * scale );
+    return bin < BVH_BIN_COUNT ? bin : BVH_BIN_COUNT - 1;
+}
+// NOTE(alicia): partition range with binned sah.
+// returns false if range is better off as a leaf, otherwise
+// reorders indices and writes number of primitives on the left side
+inline bool32 bvh_split(
+    bvh_builder& builder, u32 first, u32 count, u32 depth, u32* out_left_count
+) {
+    if( count <= 1 ) {
+        return false;
+    }
+    u32* indices = builder.tree->indices;
+
+    aabb centroid_bounds = aabb_empty();
+    for( u32 i = first; i < first + count; ++i ) {
+        vec3 centroid = builder.centroids[indices[i]];
+        centroid_bounds = merge( centroid_bounds, { centroid, centroid } );
+    }
+
+    f32 best_cost = F32::MAX;
+    u32 best_axis = 3;
+    u32 best_bin  = 0;
+    if( depth < BVH_MAX_DEPTH ) {
+        for( u32 axis = 0; axis < 3; ++axis ) {
+            f32 extent = centroid_bounds.max[axis] - centroid_bounds.min[axis];
+            if( extent <= 0.0f ) {
+                continue;
+            }
+            f32 scale = (f32)BVH_BIN_COUNT / extent;
+
+            aabb bin_bounds[BVH_BIN_COUNT];
+            u32  bin_counts[BVH_BIN_COUNT] = {};
+            for( u32 bin = 0; bin < BVH_BIN_COUNT; ++bin ) {
+                bin_bounds[bin] = aabb_empty();
+            }
+            for( u32 i = first; i < first + count; ++i ) {
+                u32 primitive = indices[i];
+                u32 bin = bvh_bin(
+                    builder.centroids[primitive][axis], centroid_bounds.min[axis], scale );
+                bin_bounds[bin] = merge( bin_bounds[bin], builder.tree->bounds[primitive] );
+                bin_counts[bin]++;
+            }
+
+            // NOTE(alicia): sweep from the right to get cost of everything past each split
+            f32 right_costs[BVH_BIN_COUNT];
+            aabb right_bounds = aabb_empty();
+            u32  right_count  = 0;
+            for( u32 bin = BVH_BIN_COUNT - 1; bin > 0; --bin ) {
+                right_bounds = merge( right_bounds, bin_bounds[bin] );
+                right_count += bin_counts[bin];
+                right_costs[bin] = right_count ?
+                    aabb_half_area( right_bounds ) * (f32)right_count : -1.0f;
+            }
+
+            aabb left_bounds = aabb_empty();
+            u32  left_count  = 0;
+            for( u32 bin = 0; bin < BVH_BIN_COUNT - 1; ++bin ) {
+                left_bounds = merge( left_bounds, bin_bounds[bin] );
+                left_count += bin_counts[bin];
+                if( !left_count || right_costs[bin + 1] < 0.0f ) {
+                    continue;
+                }
+                f32 cost = ( aabb_half_area( left_bounds ) * (f32)left_count ) + right_costs[bin + 1];
+                if( cost < best_cost ) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_bin  = bin;
+                }
+            }
+        }
+    }
+
+    if( best_axis == 3 ) {
+        // NOTE(alicia): centroids are all in one spot or tree is too deep,
+        // split in half so depth stays bounded
+        if( count <= BVH_MAX_LEAF_SIZE ) {
+            return false;
+        }
+        *out_left_count = count / 2;
+        return true;
+    }
+
+    // NOTE(alicia): sah cost with traversal and intersection cost both 1
+    f32 area = aabb_half_area( bvh_range_bounds( *builder.tree, first, count ) );
+    if( count <= BVH_MAX_LEAF_SIZE && area * (f32)count <= area + best_cost ) {
+        return false;
+    }
+
+    f32 min   = centroid_bounds.min[best_axis];
+    f32 scale = (f32)BVH_BIN_COUNT / ( centroid_bounds.max[best_axis] - min );
+    u32 left  = first;
+    u32 right = first + count;
+    while( left < right ) {
+        if( bvh_bin( builder.centroids[indices[left]][best_axis], min, scale ) <= best_bin ) {
+            ++left;
+        } else {
+            --right;
+            u32 temp       = indices[left];
+            indices[left]  = indices[right];
+            indices[right] = temp;
+        }
+    }
+    *out_left_count = left - first;
+    return true;
+}
+inline void bvh_set_slot(
+    bvh_node& node, u32 slot, const aabb& bounds, u32 child, u32 count
+) {
+    node.min_x[slot] = bounds.min.x;
+    node.min_y[slot] = bounds.min.y;
+    node.min_z[slot] = bounds.min.z;
+    node.max_x[slot] = bounds.max.x;
+    node.max_y[slot] = bounds.max.y;
+    node.max_z[slot] = bounds.max.z;
+    node.child[slot] = child;
+    node.count[slot] = count;
+}
+inline bool32 bvh_slot_used( const bvh_node& node, u32 slot ) {
+    return node.child[slot] || node.count[slot];
+}
+inline aabb bvh_node_bounds( const bvh_node& node ) {
+    aabb result = aabb_empty();
+    for( u32 slot = 0; slot < 4; ++slot ) {
+        if( bvh_slot_used( node, slot ) ) {
+            result = merge( result, {
+                { node.min_x[slot], node.min_y[slot], node.min_z[slot] },
+                { node.max_x[slot], node.max_y[slot], node.max_z[slot] } } );
+        }
+    }
+    return result;
+}
+
+struct bvh_range {
+    u32    first;
+    u32    count;
+    u32    left_count;
+    bool32 is_split;
+    bool32 is_leaf;
+};
+
+// NOTE(alicia): range must already be split in two, splits the
+// largest child ranges again until there are four children
+inline u32 bvh_build_node(
+    bvh_builder& builder, u32 first, u32 count, u32 left_count, u32 depth
+) {
+    bvh& tree = *builder.tree;
+    u32 node_index = tree.node_count++;
+
+    bvh_range ranges[4] = {};
+    ranges[0] = { first, left_count, 0, false, false };
+    ranges[1] = { first + left_count, count - left_count, 0, false, false };
+    u32 range_count = 2;
+
+    for( ;; ) {
+        u32 largest = 4;
+        for( u32 i = 0; i < range_count; ++i ) {
+            if( !ranges[i].is_split && !ranges[i].is_leaf &&
+                ( largest == 4 || ranges[i].count > ranges[largest].count )
+            ) {
+                largest = i;
+            }
+        }
+        if( largest == 4 ) {
+            break;
+        }
+
+        bvh_range& range = ranges[largest];
+        range.is_split = bvh_split( builder, range.first, range.count, depth + 1, &range.left_count );
+        range.is_leaf  = !range.is_split;
+        // NOTE(alicia): once all four slots are taken, split ranges
+        // become child nodes and reuse the split that was just made
+        if( range.is_split && range_count < 4 ) {
+            ranges[range_count++] = {
+                range.first + range.left_count, range.count - range.left_count, 0, false, false };
+            range.count    = range.left_count;
+            range.is_split = false;
+        }
+    }
+
+    for( u32 slot = 0; slot < range_count; ++slot ) {
+        const bvh_range& range = ranges[slot];
+        u32 child = range.first;
+        u32 leaf_count = range.count;
+        if( range.is_split ) {
+            child = bvh_build_node( builder, range.first, range.count, range.left_count, depth + 1 );
+            leaf_count = 0;
+        }
+        bvh_set_slot( tree.nodes[node_index], slot,
+            bvh_range_bounds( tree, range.first, range.count ), child, leaf_count );
+    }
+    for( u32 slot = range_count; slot < 4; ++slot ) {
+        bvh_set_slot( tree.nodes[node_index], slot, aabb_empty(), 0, 0 );
+    }
+    return node_index;
+}
+inline bool32 bvh_build_from_bounds( bvh* out_result, const vec3* triangles ) {
+    bvh& tree = *out_result;
+    u32 count = tree.primitive_count;
+    if( !count ) {
+        return true;
+    }
+
+    // NOTE(alicia): every node has at least two children or is the root,
+    // so there are never more nodes than primitives
+    tree.nodes = (bvh_node*)smcol_alloc_aligned( sizeof(bvh_node) * count, BVH_NODE_ALIGNMENT );
+    tree.indices = (u32*)smcol_alloc_aligned( sizeof(u32) * count, alignof(u32) );
+    vec3* centroids = (vec3*)smcol_alloc_aligned( sizeof(vec3) * count, alignof(vec3) );
+    if( !tree.nodes || !tree.indices || !centroids ) {
+        smcol_free_aligned( centroids );
+        bvh_free( out_result );
+        return false;
+    }
+
+    for( u32 i = 0; i < count; ++i ) {
+        tree.indices[i] = i;
+        centroids[i] = center( tree.bounds[i] );
+    }
+    tree.triangles = triangles;
+
+    bvh_builder builder = { out_result, centroids };
+    u32 left_count = 0;
+    if( bvh_split( builder, 0, count, 0, &left_count ) ) {
+        bvh_build_node( builder, 0, count, left_count, 0 );
+    } else {
+        tree.node_count = 1;
+        bvh_set_slot( tree.nodes[0], 0, bvh_range_bounds( tree, 0, count ), 0, count );
+        for( u32 slot = 1; slot < 4; ++slot ) {
+            bvh_set_slot( tree.nodes[0], slot, aabb_empty(), 0, 0 );
+        }
+    }
+
+    smcol_free_aligned( centroids );
+    return true;
+}
+inline void bvh_refit_nodes( bvh& tree ) {
+    // NOTE(alicia): children always come after their parent,
+    // so walking backwards sees every child before its parent
+    for( u32 node_index = tree.node_count; node_index-- > 0; ) {
+        bvh_node& node = tree.nodes[node_index];
+        for( u32 slot = 0; slot < 4; ++slot ) {
+            if( !bvh_slot_used( node, slot ) ) {
+                continue;
+            }
+            aabb bounds = node.count[slot] ?
+                bvh_range_bounds( tree, node.child[slot], node.count[slot] ) :
+                bvh_node_bounds( tree.nodes[node.child[slot]] );
+            bvh_set_slot( node, slot, bounds, node.child[slot], node.count[slot] );
+        }
+    }
+}
+
+struct bvh_ray {
+    simd::lane4f_t origin[3];
+    simd::lane4f_t inv_direction[3];
+};
+inline bvh_ray bvh_ray_create( const ray& r ) {
+    using namespace simd;
+    bvh_ray result;
+    for( u32 axis = 0; axis < 3; ++axis ) {
+        result.origin[axis]        = lane4f_set_scalar( r.origin[axis] );
+        result.inv_direction[axis] = lane4f_set_scalar( 1.0f / r.direction[axis] );
+    }
+    return result;
+}
+// NOTE(alicia): slab test against all four children, returns mask of hit slots
+inline u32 bvh_node_raycast(
+    const bvh_node& node, const bvh_ray& r, f32 max_distance, f32 out_near[4]
+) {
+    using namespace simd;
+    const f32* mins[3] = { node.min_x, node.min_y, node.min_z };
+    const f32* maxs[3] = { node.max_x, node.max_y, node.max_z };
+
+    const lane4f_t _neg_inf = lane4f_set_scalar( F32::NEG_INFINITY );
+    const lane4f_t _pos_inf = lane4f_set_scalar( F32::POS_INFINITY );
+
+    lane4f_t _near = lane4f_set_zero();
+    lane4f_t _far  = lane4f_set_scalar( max_distance );
+    for( u32 axis = 0; axis < 3; ++axis ) {
+        lane4f_t _t0 = lane4f_mul(
+            lane4f_sub( lane4f_load_unaligned( mins[axis] ), r.origin[axis] ), r.inv_direction[axis] );
+        lane4f_t _t1 = lane4f_mul(
+            lane4f_sub( lane4f_load_unaligned( maxs[axis] ), r.origin[axis] ), r.inv_direction[axis] );
+        // NOTE(alicia): 0 * inf gives NaN when the ray runs along a slab plane,
+        // min/max NaN handling is platform specific so the slab is opened up explicitly
+        lane4b_t _ordered = lane4b_and( lane4f_cmp_eq( _t0, _t0 ), lane4f_cmp_eq( _t1, _t1 ) );
+        _near = lane4f_max( _near, lane4f_select( _ordered, lane4f_min( _t0, _t1 ), _neg_inf ) );
+        _far  = lane4f_min( _far,  lane4f_select( _ordered, lane4f_max( _t0, _t1 ), _pos_inf ) );
+    }
+    lane4f_store_unaligned( _near, out_near );
+
+    u32 mask = lane4b_bitmask( lane4f_cmp_le( _near, _far ) );
+    for( u32 slot = 0; slot < 4; ++slot ) {
+        if( !bvh_slot_used( node, slot ) ) {
+            mask &= ~( 1u << slot );
+        }
+    }
+    return mask;
+}
+inline bool32 bvh_primitive_raycast(
+    const bvh& tree, u32 primitive, const ray& r,
+    f32 max_distance, raycast_hit* out_hit
+) {
+    out_hit->primitive = primitive;
+    out_hit->u = out_hit->v = 0.0f;
+    if( tree.triangles ) {
+        const vec3* vertices = tree.triangles + ( (usize)primitive * 3 );
+        return raycast( r, vertices[0], vertices[1], vertices[2],
+            max_distance, &out_hit->distance, &out_hit->u, &out_hit->v );
+    }
+    return raycast( r, tree.bounds[primitive], max_distance, &out_hit->distance );
+}
+inline bool32 bvh_raycast( const bvh& tree, const ray& r, f32 max_distance, bool32 any, raycast_hit* out_hit ) {
+    if( !tree.node_count ) {
+        return false;
+    }
+    bvh_ray lanes = bvh_ray_create( r );
+    bool32 result = false;
+
+    u32 stack[BVH_STACK_SIZE];
+    u32 stack_count = 0;
+    stack[stack_count++] = 0;
+    while( stack_count ) {
+        const bvh_node& node = tree.nodes[stack[--stack_count]];
+        f32 near[4];
+        u32 mask = bvh_node_raycast( node, lanes, max_distance, near );
+
+        // NOTE(alicia): test leaves right away, sort internal
+        // children so the nearest one is popped first
+        u32 children[4];
+        f32 distances[4];
+        u32 child_count = 0;
+        for( u32 slot = 0; slot < 4; ++slot ) {
+            if( !( mask & ( 1u << slot ) ) ) {
+                continue;
+            }
+            if( !node.count[slot] ) {
+                u32 i = child_count++;
+                while( i && distances[i - 1] < near[slot] ) {
+                    children[i]  = children[i - 1];
+                    distances[i] = distances[i - 1];
+                    --i;
+                }
+                children[i]  = node.child[slot];
+                distances[i] = near[slot];
+                continue;
+            }
+            for( u32 i = 0; i < node.count[slot]; ++i ) {
+                raycast_hit hit;
+                u32 primitive = tree.indices[node.child[slot] + i];
+                if( bvh_primitive_raycast( tree, primitive, r, max_distance, &hit ) ) {
+                    result = true;
+                    if( any ) {
+                        return true;
+                    }
+                    max_distance = hit.distance;
+                    *out_hit = hit;
+                }
+            }
+        }
+        for( u32 i = 0; i < child_count; ++i ) {
+            if( distances[i] <= max_distance ) {
+                stack[stack_count++] = children[i];
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE bool32 bvh_build( const aabb* bounds, usize count, bvh* out_result ) {
+    *out_result = {};
+    out_result->primitive_count = (u32)count;
+    if( count ) {
+        out_result->bounds = (aabb*)smcol_alloc_aligned( sizeof(aabb) * count, alignof(aabb) );
+        if( !out_result->bounds ) {
+            return false;
+        }
+        for( usize i = 0; i < count; ++i ) {
+            out_result->bounds[i] = bounds[i];
+        }
+    }
+    return internal::bvh_build_from_bounds( out_result, nullptr );
+}
+SMATH_INLINE bool32 bvh_build_triangles(
+    const vec3* vertices, usize triangle_count, bvh* out_result
+) {
+    *out_result = {};
+    out_result->primitive_count = (u32)triangle_count;
+    if( triangle_count ) {
+        out_result->bounds = (aabb*)smcol_alloc_aligned(
+            sizeof(aabb) * triangle_count, alignof(aabb) );
+        if( !out_result->bounds ) {
+            return false;
+        }
+        for( usize i = 0; i < triangle_count; ++i ) {
+            out_result->bounds[i] = internal::triangle_bounds( vertices + ( i * 3 ) );
+        }
+    }
+    return internal::bvh_build_from_bounds( out_result, vertices );
+}
+SMATH_INLINE void bvh_free( bvh* tree ) {
+    smcol_free_aligned( tree->nodes );
+    smcol_free_aligned( tree->indices );
+    smcol_free_aligned( tree->bounds );
+    *tree = {};
+}
+SMATH_INLINE void bvh_refit( bvh& tree, const aabb* bounds ) {
+    for( u32 i = 0; i < tree.primitive_count; ++i ) {
+        tree.bounds[i] = bounds[i];
+    }
+    internal::bvh_refit_nodes( tree );
+}
+SMATH_INLINE void bvh_refit_triangles( bvh& tree, const vec3* vertices ) {
+    tree.triangles = vertices;
+    for( u32 i = 0; i < tree.primitive_count; ++i ) {
+        tree.bounds[i] = internal::triangle_bounds( vertices + ( (usize)i * 3 ) );
+    }
+    internal::bvh_refit_nodes( tree );
+}
+SMATH_INLINE bool32 raycast_closest(
+    const bvh& tree, const ray& r, f32 max_distance, raycast_hit* out_hit
+) {
+    return internal::bvh_raycast( tree, r, max_distance, false, out_hit );
+}
+SMATH_INLINE bool32 raycast_any( const bvh& tree, const ray& r, f32 max_distance ) {
+    raycast_hit hit;
+    return internal::bvh_raycast( tree, r, max_distance, true, &hit );
+}
+SMATH_INLINE bool32 overlap_aabb( const bvh& tree, const aabb& box, list_t* out_primitives ) {
+    using namespace simd;
+    if( !internal::list_reserve_items( out_primitives, sizeof(u32), 0 ) ) {
+        return false;
+    }
+    if( !tree.node_count ) {
+        return true;
+    }
+
+    const lane4f_t _min_x = lane4f_set_scalar( box.min.x );
+    const lane4f_t _min_y = lane4f_set_scalar( box.min.y );
+    const lane4f_t _min_z = lane4f_set_scalar( box.min.z );
+    const lane4f_t _max_x = lane4f_set_scalar( box.max.x );
+    const lane4f_t _max_y = lane4f_set_scalar( box.max.y );
+    const lane4f_t _max_z = lane4f_set_scalar( box.max.z );
+
+    u32 stack[BVH_STACK_SIZE];
+    u32 stack_count = 0;
+    stack[stack_count++] = 0;
+    while( stack_count ) {
+        const bvh_node& node = tree.nodes[stack[--stack_count]];
+        lane4b_t _overlap = lane4b_and(
+            lane4f_cmp_le( lane4f_load_unaligned( node.min_x ), _max_x ),
+            lane4f_cmp_ge( lane4f_load_unaligned( node.max_x ), _min_x ) );
+        _overlap = lane4b_and( _overlap, lane4b_and(
+            lane4f_cmp_le( lane4f_load_unaligned( node.min_y ), _max_y ),
+            lane4f_cmp_ge( lane4f_load_unaligned( node.max_y ), _min_y ) ) );
+        _overlap = lane4b_and( _overlap, lane4b_and(
+            lane4f_cmp_le( lane4f_load_unaligned( node.min_z ), _max_z ),
+            lane4f_cmp_ge( lane4f_load_unaligned( node.max_z ), _min_z ) ) );
+        u32 mask = lane4b_bitmask( _overlap );
+
+        for( u32 slot = 0; slot < 4; ++slot ) {
+            if( !( mask & ( 1u << slot ) ) || !internal::bvh_slot_used( node, slot ) ) {
+                continue;
+            }
+            if( !node.count[slot] ) {
+                stack[stack_count++] = node.child[slot];
+                continue;
+            }
+            for( u32 i = 0; i < node.count[slot]; ++i ) {
+                u32 primitive = tree.indices[node.child[slot] + i];
+                if( overlaps( tree.bounds[primitive], box ) &&
+                    !list_push_realloc( out_primitives, &primitive )
+                ) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// NOTE(alicia): spatial grid
+
+#define SPATIAL_GRID_MIN_BUCKETS 16
+#define OCTREE_MAX_DEPTH         16
+#define OCTREE_STACK_SIZE        ( ( OCTREE_MAX_DEPTH * 8 ) + 1 )
+
+namespace internal {
+
+inline vec3 grid_point( const vec3& point ) {
+    return point;
+}
+inline vec3 grid_point( const vec2& point ) {
+    return { point.x, point.y, 0.0f };
+}
+// NOTE(alicia): cells are clamped to +-2^30 so converting to i32 is defined
+// and first-to-last cell spans can't overflow, far away points share the edge cells
+constexpr f32 GRID_CELL_LIMIT = 1073741824.0f;
+inline i32 grid_cell_axis( f32 x ) {
+    return floor32( clamp( x, -GRID_CELL_LIMIT, GRID_CELL_LIMIT ) );
+}
+inline ivec3 grid_cell( const vec3& point, f32 inv_cell_size ) {
+    return {
+        grid_cell_axis( point.x * inv_cell_size ),
+        grid_cell_axis( point.y * inv_cell_size ),
+        grid_cell_axis( point.z * inv_cell_size )
+    };
+}
+inline u32 grid_hash( i32 x, i32 y, i32 z, u32 bucket_count ) {
+    u32 hash = ( (u32)x * 73856093u ) ^ ( (u32)y * 19349663u ) ^ ( (u32)z * 83492791u );
+    return hash & ( bucket_count - 1 );
+}
+inline bool32 grid_reserve( spatial_grid& grid, usize count ) {
+    u32 bucket_count = SPATIAL_GRID_MIN_BUCKETS;
+    while( bucket_count < count * 2 ) {
+        bucket_count *= 2;
+    }
+    if( bucket_count > grid.bucket_count ) {
+        smcol_free_aligned( grid.bucket_start );
+        grid.bucket_count = 0;
+        grid.bucket_start = (u32*)smcol_alloc_aligned(
+            sizeof(u32) * ( bucket_count + 1 ), alignof(u32) );
+        if( !grid.bucket_start ) {
+            return false;
+        }
+        grid.bucket_count = bucket_count;
+    }
+    if( count > grid.capacity ) {
+        smcol_free_aligned( grid.indices );
+        smcol_free_aligned( grid.positions );
+        grid.capacity  = 0;
+        grid.indices   = (u32*)smcol_alloc_aligned( sizeof(u32) * count, alignof(u32) );
+        grid.positions = (vec3*)smcol_alloc_aligned( sizeof(vec3) * count, alignof(vec3) );
+        if( !grid.indices || !grid.positions ) {
+            return false;
+        }
+        grid.capacity = (u32)count;
+    }
+    return true;
+}
+// NOTE(alicia): counting sort by bucket. counts go one slot to the right so the
+// prefix sum gives bucket starts, scattering bumps each start to its end,
+// shifting back by one restores the starts
+template<typename T>
+inline bool32 grid_rebuild( spatial_grid& grid, const T* positions, usize count ) {
+    grid.count = 0;
+    if( !grid_reserve( grid, count ) ) {
+        return false;
+    }
+    f32 inv_cell_size = 1.0f / grid.cell_size;
+    u32* start = grid.bucket_start;
+    for( u32 bucket = 0; bucket <= grid.bucket_count; ++bucket ) {
+        start[bucket] = 0;
+    }
+    for( usize i = 0; i < count; ++i ) {
+        ivec3 cell = grid_cell( grid_point( positions[i] ), inv_cell_size );
+        start[grid_hash( cell.x, cell.y, cell.z, grid.bucket_count ) + 1]++;
+    }
+    for( u32 bucket = 0; bucket < grid.bucket_count; ++bucket ) {
+        start[bucket + 1] += start[bucket];
+    }
+    for( usize i = 0; i < count; ++i ) {
+        vec3  point = grid_point( positions[i] );
+        ivec3 cell  = grid_cell( point, inv_cell_size );
+        u32 sorted  = start[grid_hash( cell.x, cell.y, cell.z, grid.bucket_count )]++;
+        grid.indices[sorted]   = (u32)i;
+        grid.positions[sorted] = point;
+    }
+    for( u32 bucket = grid.bucket_count; bucket > 0; --bucket ) {
+        start[bucket] = start[bucket - 1];
+    }
+    start[0] = 0;
+
+    grid.count = (u32)count;
+    return true;
+}
+// NOTE(alicia): appends to out_indices, flat grids only look at the z = 0 layer
+inline bool32 grid_query(
+    const spatial_grid& grid, const vec3& center, f32 radius,
+    bool32 flat, list_t* out_indices
+) {
+    if( !grid.count ) {
+        return true;
+    }
+    f32 inv_cell_size = 1.0f / grid.cell_size;
+    f32 radius_sqr    = radius * radius;
+    vec3 extent = { radius, radius, flat ? 0.0f : radius };
+    ivec3 first = grid_cell( center - extent, inv_cell_size );
+    ivec3 last  = grid_cell( center + extent, inv_cell_size );
+
+    // NOTE(alicia): query covers more cells than there are points, scanning is cheaper.
+    // spans are widened before subtracting and the product stops growing once it passes count
+    u64 span_x = (u64)( (i64)last.x - (i64)first.x + 1 );
+    u64 span_y = (u64)( (i64)last.y - (i64)first.y + 1 );
+    u64 span_z = (u64)( (i64)last.z - (i64)first.z + 1 );
+    u64 cell_count = span_x;
+    if( cell_count < grid.count ) {
+        cell_count *= span_y;
+    }
+    if( cell_count < grid.count ) {
+        cell_count *= span_z;
+    }
+    if( cell_count >= grid.count ) {
+        for( u32 i = 0; i < grid.count; ++i ) {
+            if( sqr_mag( grid.positions[i] - center ) <= radius_sqr &&
+                !list_push_realloc( out_indices, &grid.indices[i] )
+            ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    for( i32 z = first.z; z <= last.z; ++z ) {
+        for( i32 y = first.y; y <= last.y; ++y ) {
+            for( i32 x = first.x; x <= last.x; ++x ) {
+                u32 bucket = grid_hash( x, y, z, grid.bucket_count );
+                for( u32 i = grid.bucket_start[bucket]; i < grid.bucket_start[bucket + 1]; ++i ) {
+                    const vec3& point = grid.positions[i];
+                    if( sqr_mag( point - center ) > radius_sqr ) {
+                        continue;
+                    }
+                    // NOTE(alicia): other cells can hash to the same bucket,
+                    // only take points from this cell so none are reported twice
+                    ivec3 cell = grid_cell( point, inv_cell_size );
+                    if( cell.x != x || cell.y != y || cell.z != z ) {
+                        continue;
+                    }
+                    if( !list_push_realloc( out_indices, &grid.indices[i] ) ) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+inline bool32 query_clear( list_t* out_indices ) {
+    return list_reserve_items( out_indices, sizeof(u32), 0 );
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE bool32 spatial_grid_create( f32 cell_size, usize capacity, spatial_grid* out_result ) {
+    *out_result = {};
+    out_result->cell_size = cell_size;
+    if( !internal::grid_reserve( *out_result, capacity ) ) {
+        spatial_grid_free( out_result );
+        return false;
+    }
+    for( u32 bucket = 0; bucket <= out_result->bucket_count; ++bucket ) {
+        out_result->bucket_start[bucket] = 0;
+    }
+    return true;
+}
+SMATH_INLINE void spatial_grid_free( spatial_grid* grid ) {
+    smcol_free_aligned( grid->bucket_start );
+    smcol_free_aligned( grid->indices );
+    smcol_free_aligned( grid->positions );
+    *grid = {};
+}
+SMATH_INLINE bool32 spatial_grid_rebuild( spatial_grid& grid, const vec3* positions, usize count ) {
+    return internal::grid_rebuild( grid, positions, count );
+}
+SMATH_INLINE bool32 spatial_grid_rebuild( spatial_grid& grid, const vec2* positions, usize count ) {
+    return internal::grid_rebuild( grid, positions, count );
+}
+SMATH_INLINE bool32 query_radius(
+    const spatial_grid& grid, const vec3& center, f32 radius, list_t* out_indices
+) {
+    if( !internal::query_clear( out_indices ) ) {
+        return false;
+    }
+    return internal::grid_query( grid, center, radius, false, out_indices );
+}
+SMATH_INLINE bool32 query_radius(
+    const spatial_grid& grid, const vec2& center, f32 radius, list_t* out_indices
+) {
+    if( !internal::query_clear( out_indices ) ) {
+        return false;
+    }
+    return internal::grid_query( grid, internal::grid_point( center ), radius, true, out_indices );
+}
+SMATH_INLINE bool32 query_radius_n(
+    const spatial_grid& grid, const vec3* centers, usize count,
+    f32 radius, list_t* out_indices, u32* out_offsets
+) {
+    if( !internal::query_clear( out_indices ) ) {
+        return false;
+    }
+    for( usize i = 0; i < count; ++i ) {
+        out_offsets[i] = (u32)out_indices->count;
+        if( !internal::grid_query( grid, centers[i], radius, false, out_indices ) ) {
+            return false;
+        }
+    }
+    out_offsets[count] = (u32)out_indices->count;
+    return true;
+}
+
+// NOTE(alicia): loose octree
+
+namespace internal {
+
+inline octree_node* octree_nodes( const loose_octree& tree ) {
+    return (octree_node*)tree.nodes.buffer;
+}
+// NOTE(alicia): walk down while the child is still at least as large as the radius,
+// spheres with centers outside of root stay in root
+inline bool32 octree_locate(
+    loose_octree& tree, const vec3& center, f32 radius, bool32 create, u32* out_node
+) {
+    u32 node_index = 0;
+    const octree_node& root = octree_nodes( tree )[0];
+    vec3 offset = center - root.center;
+    if( absolute( offset.x ) > root.half_size ||
+        absolute( offset.y ) > root.half_size ||
+        absolute( offset.z ) > root.half_size
+    ) {
+        *out_node = 0;
+        return true;
+    }
+
+    for( u32 depth = 0; depth < tree.max_depth; ++depth ) {
+        octree_node node = octree_nodes( tree )[node_index];
+        f32 child_half_size = node.half_size * 0.5f;
+        if( radius > child_half_size ) {
+            break;
+        }
+        u32 octant =
+            ( center.x >= node.center.x ? 1 : 0 ) |
+            ( center.y >= node.center.y ? 2 : 0 ) |
+            ( center.z >= node.center.z ? 4 : 0 );
+        if( !node.children[octant] ) {
+            if( !create ) {
+                break;
+            }
+            octree_node child = {};
+            child.center = node.center + vec3::create(
+                octant & 1 ? child_half_size : -child_half_size,
+                octant & 2 ? child_half_size : -child_half_size,
+                octant & 4 ? child_half_size : -child_half_size );
+            child.half_size = child_half_size;
+            u32 child_index = (u32)tree.nodes.count;
+            if( !list_push_realloc( &tree.nodes, &child ) ) {
+                return false;
+            }
+            octree_nodes( tree )[node_index].children[octant] = child_index;
+            node.children[octant] = child_index;
+        }
+        node_index = node.children[octant];
+    }
+    *out_node = node_index;
+    return true;
+}
+inline bool32 octree_reserve( loose_octree& tree, usize count ) {
+    if( count <= tree.capacity ) {
+        return true;
+    }
+    smcol_free_aligned( tree.indices );
+    smcol_free_aligned( tree.spheres );
+    tree.capacity = 0;
+    tree.indices  = (u32*)smcol_alloc_aligned( sizeof(u32) * count, alignof(u32) );
+    tree.spheres  = (vec4*)smcol_alloc_aligned( sizeof(vec4) * count, 16 );
+    if( !tree.indices || !tree.spheres ) {
+        return false;
+    }
+    tree.capacity = (u32)count;
+    return true;
+}
+inline bool32 octree_query(
+    const loose_octree& tree, const vec3& center, f32 radius, list_t* out_indices
+) {
+    const octree_node* nodes = octree_nodes( tree );
+    u32 stack[OCTREE_STACK_SIZE];
+    u32 stack_count = 0;
+    stack[stack_count++] = 0;
+    while( stack_count ) {
+        const octree_node& node = nodes[stack[--stack_count]];
+        for( u32 i = node.first; i < node.first + node.count; ++i ) {
+            const vec4& s = tree.spheres[i];
+            f32 reach = radius + s.w;
+            if( sqr_mag( vec3::create( s ) - center ) <= reach * reach &&
+                !list_push_realloc( out_indices, &tree.indices[i] )
+            ) {
+                return false;
+            }
+        }
+        for( u32 octant = 0; octant < 8; ++octant ) {
+            if( !node.children[octant] ) {
+                continue;
+            }
+            const octree_node& child = nodes[node.children[octant]];
+            f32 loose_half_size = child.half_size * 2.0f;
+            vec3 loose_extents  = { loose_half_size, loose_half_size, loose_half_size };
+            if( overlaps(
+                aabb::from_center_extents( child.center, loose_extents ),
+                sphere::create( center, radius ) )
+            ) {
+                stack[stack_count++] = node.children[octant];
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE bool32 loose_octree_create(
+    const vec3& center, f32 half_size, u32 max_depth, loose_octree* out_result
+) {
+    *out_result = {};
+    out_result->max_depth = min( max_depth, (u32)OCTREE_MAX_DEPTH );
+    octree_node root = {};
+    root.center    = center;
+    root.half_size = half_size;
+    if( !list_create( sizeof(octree_node), 1, &out_result->nodes ) ) {
+        return false;
+    }
+    list_push( &out_result->nodes, &root );
+    return true;
+}
+SMATH_INLINE void loose_octree_free( loose_octree* tree ) {
+    list_free( &tree->nodes );
+    smcol_free_aligned( tree->indices );
+    smcol_free_aligned( tree->spheres );
+    *tree = {};
+}
+SMATH_INLINE bool32 loose_octree_rebuild(
+    loose_octree& tree, const vec3* centers, const f32* radii, usize count
+) {
+    tree.count = 0;
+    if( !internal::octree_reserve( tree, count ) ) {
+        return false;
+    }
+    // NOTE(alicia): keep the node buffer, drop everything below root
+    tree.nodes.count = 1;
+    octree_node* nodes = internal::octree_nodes( tree );
+    octree_node root = {};
+    root.center    = nodes[0].center;
+    root.half_size = nodes[0].half_size;
+    nodes[0] = root;
+
+    // NOTE(alicia): counting sort by node, first pass builds nodes and counts,
+    // second pass finds the same nodes again and scatters
+    for( usize i = 0; i < count; ++i ) {
+        u32 node = 0;
+        if( !internal::octree_locate( tree, centers[i], radii[i], true, &node ) ) {
+            return false;
+        }
+        internal::octree_nodes( tree )[node].count++;
+    }
+    nodes = internal::octree_nodes( tree );
+    u32 first = 0;
+    for( usize i = 0; i < tree.nodes.count; ++i ) {
+        nodes[i].first = first;
+        first += nodes[i].count;
+        nodes[i].count = 0;
+    }
+    for( usize i = 0; i < count; ++i ) {
+        u32 node = 0;
+        internal::octree_locate( tree, centers[i], radii[i], false, &node );
+        u32 sorted = nodes[node].first + nodes[node].count++;
+        tree.indices[sorted] = (u32)i;
+        tree.spheres[sorted] = { centers[i].x, centers[i].y, centers[i].z, radii[i] };
+    }
+
+    tree.count = (u32)count;
+    return true;
+}
+SMATH_INLINE bool32 query_radius(
+    const loose_octree& tree, const vec3& center, f32 radius, list_t* out_indices
+) {
+    if( !internal::query_clear( out_indices ) ) {
+        return false;
+    }
+    return internal::octree_query( tree, center, radius, out_indices );
+}
+SMATH_INLINE bool32 query_radius_n(
+    const loose_octree& tree, const vec3* centers, usize count,
+    f32 radius, list_t* out_indices, u32* out_offsets
+) {
+    if( !internal::query_clear( out_indices ) ) {
+        return false;
+    }
+    for( usize i = 0; i < count; ++i ) {
+        out_offsets[i] = (u32)out_indices->count;
+        if( !internal::octree_query( tree, centers[i], radius, out_indices ) ) {
+            return false;
+        }
+    }
+    out_offsets[count] = (u32)out_indices->count;
+    return true;
+}
+
+SMATH_INLINE lcg new_lcg( i32 seed ) {
+    lcg result  = {};
+    result.seed = seed;
+    result.a    = 166463;
+    result.b    = 235;
+    result.m    = 21446837;
+    result.current = result.seed;
+    return result;
+}
+SMATH_INLINE lcg64 new_lcg64( i64 seed ) {
+    lcg64 result  = {};
+    result.seed = seed;
+    result.a    = 1664654683;
+    result.b    = 2384695;
+    result.m    = 2144683865487;
+    result.current = result.seed;
+    return result;
+}
+SMATH_INLINE void rand( lcg& state, i32& next ) {
+    state.current = ( state.a * state.current + state.b ) % state.m;
+    next = state.current;
+}
+SMATH_INLINE void rand( lcg& state, f32& next ) {
+    i32 result;
+    rand( state, result );
+    next = (f32)result / (f32)state.m;
+}
+SMATH_INLINE void rand( lcg& state, vec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( lcg& state, ivec2& result ) {
+    rand(state, result.x);
+    rand(state, result.y);
+}
+SMATH_INLINE void rand( lcg& state, vec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( lcg& state, ivec3& result ) {
+    rand(state, result.x);
+    rand(state, result.y);
+    rand(state, result.z);
+}
+SMATH_INLINE void rand( lcg& state, vec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void rand( lcg& state, ivec4& result ) {
+    rand(state, result.x);
+    rand(state, result.y);
+    rand(state, result.z);
+    rand(state, result.w);
+}
+SMATH_INLINE void rand( lcg64& state, i64& next ) {
+    state.current = ( state.a * state.current + state.b ) % state.m;
+    next = state.current;
+}
+SMATH_INLINE void rand( lcg64& state, f64& next ) {
+    i64 result;
+    rand( state, result );
+    next = (f64)result / (f64)state.m;
+}
+
+SMATH_INLINE xor_shift new_xor_shift( u32 seed ) {
+    xor_shift result = {};
+    result.seed = max( seed, (u32)1 );
+    result.current = result.seed;
+    return result;
+}
+SMATH_INLINE xor_shift64 new_xor_shift64( u64 seed ) {
+    xor_shift64 result = {};
+    result.seed = max( seed, (u64)1 );
+    result.current = result.seed;
+    return result;
+}
+SMATH_INLINE void rand( xor_shift& state, u32& next ) {
+    u32 result = state.current;
+    result ^= result << 13;
+    result ^= result >> 17;
+    result ^= result << 5;
+
+    state.current = result;
+    next = result;
+}
+SMATH_INLINE void rand( xor_shift& state, i32& next ) {
+    u32 result;
+    rand( state, result );
+    next = *(i32*)&result;
+}
+SMATH_INLINE void rand( xor_shift& state, f32& next ) {
     i32 result;
     rand( state, result );
-    next = normalize_range(result);
+    next = normalize_range(result);
+}
+SMATH_INLINE void rand( xor_shift& state, vec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( xor_shift& state, ivec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( xor_shift& state, vec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( xor_shift& state, ivec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( xor_shift& state, vec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void rand( xor_shift& state, ivec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void rand( xor_shift64& state, u64& next ) {
+    u64 result = state.current;
+    result ^= result << 13;
+    result ^= result >> 7;
+    result ^= result << 17;
+
+    state.current = result;
+    next = result;
+}
+SMATH_INLINE void rand( xor_shift64& state, i64& next ) {
+    u64 result;
+    rand( state, result );
+    next = *(i64*)&result;
+}
+SMATH_INLINE void rand( xor_shift64& state, f64& next ) {
+    i64 result;
+    rand( state, result );
+    next = normalize_range64(result);
+}
+
+namespace internal {
+
+// NOTE(alicia): murmur3 finalizer, spreads nearby seeds across streams
+inline u32 rand_scramble( u32 x ) {
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x ? x : 1;
+}
+inline simd::lane4i_t xor_shift_step( simd::lane4i_t x ) {
+    using namespace simd;
+    x = lane4i_xor( x, lane4i_shift_left( x, 13 ) );
+    x = lane4i_xor( x, lane4i_shift_right_logical( x, 17 ) );
+    x = lane4i_xor( x, lane4i_shift_left( x, 5 ) );
+    return x;
+}
+inline simd::lane8i_t xor_shift_step( simd::lane8i_t x ) {
+    using namespace simd;
+    x = lane8i_xor( x, lane8i_shift_left( x, 13 ) );
+    x = lane8i_xor( x, lane8i_shift_right_logical( x, 17 ) );
+    x = lane8i_xor( x, lane8i_shift_left( x, 5 ) );
+    return x;
+}
+// NOTE(alicia): top 23 bits become the mantissa of a float in 1-2 for unit
+// or 2-4 for signed, subtracting 1 or 3 moves it into the interval
+inline simd::lane4f_t rand_bits_to_f32( simd::lane4i_t bits, rand_interval interval ) {
+    using namespace simd;
+    bool32 is_signed = interval == RAND_INTERVAL_SIGNED;
+    lane4i_t mantissa = lane4i_shift_right_logical( bits, 9 );
+    lane4f_t value = lane4i_as_lane4f( lane4i_or( mantissa,
+        lane4i_set_scalar( is_signed ? 0x40000000 : 0x3F800000 ) ) );
+    return lane4f_sub( value, lane4f_set_scalar( is_signed ? 3.0f : 1.0f ) );
+}
+inline simd::lane8f_t rand_bits_to_f32( simd::lane8i_t bits, rand_interval interval ) {
+    using namespace simd;
+    bool32 is_signed = interval == RAND_INTERVAL_SIGNED;
+    lane8i_t mantissa = lane8i_shift_right_logical( bits, 9 );
+    lane8f_t value = lane8i_as_lane8f( lane8i_or( mantissa,
+        lane8i_set_scalar( is_signed ? 0x40000000 : 0x3F800000 ) ) );
+    return lane8f_sub( value, lane8f_set_scalar( is_signed ? 3.0f : 1.0f ) );
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE xor_shift_x4 new_xor_shift_x4( u32 seed ) {
+    xor_shift_x4 result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.current[i] = internal::rand_scramble( seed + ( i * 0x9E3779B9u ) );
+    }
+    return result;
+}
+SMATH_INLINE xor_shift_x8 new_xor_shift_x8( u32 seed ) {
+    xor_shift_x8 result;
+    for( u32 i = 0; i < 8; ++i ) {
+        result.current[i] = internal::rand_scramble( seed + ( i * 0x9E3779B9u ) );
+    }
+    return result;
+}
+SMATH_INLINE void rand( xor_shift_x4& state, simd::lane4i_t& next ) {
+    using namespace simd;
+    next = internal::xor_shift_step( lane4i_load_unaligned( (i32*)state.current ) );
+    lane4i_store_unaligned( next, (i32*)state.current );
+}
+SMATH_INLINE void rand( xor_shift_x8& state, simd::lane8i_t& next ) {
+    using namespace simd;
+    next = internal::xor_shift_step( lane8i_load_unaligned( (i32*)state.current ) );
+    lane8i_store_unaligned( next, (i32*)state.current );
+}
+SMATH_INLINE void rand( xor_shift_x4& state, simd::lane4f_t& next ) {
+    simd::lane4i_t bits;
+    rand( state, bits );
+    next = internal::rand_bits_to_f32( bits, RAND_INTERVAL_SIGNED );
+}
+SMATH_INLINE void rand( xor_shift_x8& state, simd::lane8f_t& next ) {
+    simd::lane8i_t bits;
+    rand( state, bits );
+    next = internal::rand_bits_to_f32( bits, RAND_INTERVAL_SIGNED );
+}
+SMATH_INLINE void rand_fill( xor_shift_x4& state, f32* out_result, usize count, rand_interval interval ) {
+    using namespace simd;
+    lane4i_t _state = lane4i_load_unaligned( (i32*)state.current );
+    for( usize i = 0; i < count; i += 4 ) {
+        _state = internal::xor_shift_step( _state );
+        lane4f_t _value = internal::rand_bits_to_f32( _state, interval );
+        if( count - i >= 4 ) {
+            lane4f_store_unaligned( _value, out_result + i );
+        } else {
+            lane4f_store_partial( _value, out_result + i, count - i );
+        }
+    }
+    lane4i_store_unaligned( _state, (i32*)state.current );
+}
+SMATH_INLINE void rand_fill( xor_shift_x8& state, f32* out_result, usize count, rand_interval interval ) {
+    using namespace simd;
+    lane8i_t _state = lane8i_load_unaligned( (i32*)state.current );
+    for( usize i = 0; i < count; i += 8 ) {
+        _state = internal::xor_shift_step( _state );
+        lane8f_t _value = internal::rand_bits_to_f32( _state, interval );
+        if( count - i >= 8 ) {
+            lane8f_store_unaligned( _value, out_result + i );
+        } else {
+            lane8f_store_partial( _value, out_result + i, count - i );
+        }
+    }
+    lane8i_store_unaligned( _state, (i32*)state.current );
+}
+SMATH_INLINE void rand_fill_vec3( xor_shift_x4& state, vec3* out_result, usize count, rand_interval interval ) {
+    static_assert( sizeof(vec3) == sizeof(f32) * 3, "vec3 must be tightly packed" );
+    rand_fill( state, out_result->ptr(), count * 3, interval );
+}
+SMATH_INLINE void rand_fill_vec3( xor_shift_x8& state, vec3* out_result, usize count, rand_interval interval ) {
+    static_assert( sizeof(vec3) == sizeof(f32) * 3, "vec3 must be tightly packed" );
+    rand_fill( state, out_result->ptr(), count * 3, interval );
+}
+
+namespace internal {
+
+inline u32 rotate_left( u32 x, u32 k ) {
+    return ( x << k ) | ( x >> ( 32 - k ) );
+}
+inline u64 rotate_left( u64 x, u32 k ) {
+    return ( x << k ) | ( x >> ( 64 - k ) );
+}
+// NOTE(alicia): same mantissa trick as the lane version
+inline f32 rand_bits_to_f32( u32 bits, rand_interval interval ) {
+    bool32 is_signed = interval == RAND_INTERVAL_SIGNED;
+    union { u32 u; f32 f; } value;
+    value.u = ( bits >> 9 ) | ( is_signed ? 0x40000000u : 0x3F800000u );
+    return value.f - ( is_signed ? 3.0f : 1.0f );
+}
+inline f64 rand_bits_to_f64( u64 bits ) {
+    union { u64 u; f64 f; } value;
+    value.u = ( bits >> 12 ) | 0x4000000000000000ull;
+    return value.f - 3.0;
+}
+inline u32 pcg32_step( pcg32& state ) {
+    u64 previous  = state.current;
+    state.current = previous * 6364136223846793005ull + state.increment;
+    u32 shifted   = (u32)( ( ( previous >> 18 ) ^ previous ) >> 27 );
+    u32 rotation  = (u32)( previous >> 59 );
+    return ( shifted >> rotation ) | ( shifted << ( ( 0u - rotation ) & 31 ) );
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE splitmix64 new_splitmix64( u64 seed ) {
+    splitmix64 result = {};
+    result.seed    = seed;
+    result.current = seed;
+    return result;
+}
+SMATH_INLINE pcg32 new_pcg32( u64 seed ) {
+    return new_pcg32( seed, 0xDA3E39CB94B95BDBull );
+}
+SMATH_INLINE pcg32 new_pcg32( u64 seed, u64 stream ) {
+    pcg32 result = {};
+    result.increment = ( stream << 1 ) | 1;
+    internal::pcg32_step( result );
+    result.current += seed;
+    internal::pcg32_step( result );
+    return result;
+}
+SMATH_INLINE xoshiro128plus new_xoshiro128plus( u64 seed ) {
+    splitmix64 seeder = new_splitmix64( seed );
+    xoshiro128plus result = {};
+    do {
+        u64 a, b;
+        rand( seeder, a );
+        rand( seeder, b );
+        result.current[0] = (u32)a;
+        result.current[1] = (u32)( a >> 32 );
+        result.current[2] = (u32)b;
+        result.current[3] = (u32)( b >> 32 );
+    } while( !( result.current[0] | result.current[1] | result.current[2] | result.current[3] ) );
+    return result;
+}
+SMATH_INLINE xoshiro256starstar new_xoshiro256starstar( u64 seed ) {
+    splitmix64 seeder = new_splitmix64( seed );
+    xoshiro256starstar result = {};
+    do {
+        for( u32 i = 0; i < 4; ++i ) {
+            rand( seeder, result.current[i] );
+        }
+    } while( !( result.current[0] | result.current[1] | result.current[2] | result.current[3] ) );
+    return result;
+}
+SMATH_INLINE void rand( splitmix64& state, u64& next ) {
+    state.current += 0x9E3779B97F4A7C15ull;
+    u64 result = state.current;
+    result = ( result ^ ( result >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+    result = ( result ^ ( result >> 27 ) ) * 0x94D049BB133111EBull;
+    next = result ^ ( result >> 31 );
+}
+SMATH_INLINE void rand( pcg32& state, u32& next ) {
+    next = internal::pcg32_step( state );
+}
+SMATH_INLINE void rand( xoshiro128plus& state, u32& next ) {
+    u32* s = state.current;
+    u32 result = s[0] + s[3];
+    u32 t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = internal::rotate_left( s[3], 11 );
+
+    next = result;
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, u64& next ) {
+    u64* s = state.current;
+    u64 result = internal::rotate_left( s[1] * 5, 7 ) * 9;
+    u64 t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = internal::rotate_left( s[3], 45 );
+
+    next = result;
+}
+SMATH_INLINE void rand( splitmix64& state, i64& next ) {
+    u64 result;
+    rand( state, result );
+    next = *(i64*)&result;
+}
+SMATH_INLINE void rand( splitmix64& state, f64& next ) {
+    u64 result;
+    rand( state, result );
+    next = internal::rand_bits_to_f64( result );
+}
+SMATH_INLINE void rand( splitmix64& state, u32& next ) {
+    u64 result;
+    rand( state, result );
+    next = (u32)( result >> 32 );
 }
-void rand( xor_shift& state, vec2& result ) {
+SMATH_INLINE void rand( splitmix64& state, i32& next ) {
+    u32 result;
+    rand( state, result );
+    next = *(i32*)&result;
+}
+SMATH_INLINE void rand( splitmix64& state, f32& next ) {
+    u32 result;
+    rand( state, result );
+    next = internal::rand_bits_to_f32( result, RAND_INTERVAL_SIGNED );
+}
+SMATH_INLINE void rand( splitmix64& state, vec2& result ) {
     rand( state, result.x );
     rand( state, result.y );
 }
-void rand( xor_shift& state, ivec2& result ) {
+SMATH_INLINE void rand( splitmix64& state, ivec2& result ) {
     rand( state, result.x );
     rand( state, result.y );
 }
-void rand( xor_shift& state, vec3& result ) {
+SMATH_INLINE void rand( splitmix64& state, vec3& result ) {
     rand( state, result.x );
     rand( state, result.y );
     rand( state, result.z );
 }
-void rand( xor_shift& state, ivec3& result ) {
+SMATH_INLINE void rand( splitmix64& state, ivec3& result ) {
     rand( state, result.x );
     rand( state, result.y );
     rand( state, result.z );
 }
-void rand( xor_shift& state, vec4& result ) {
+SMATH_INLINE void rand( splitmix64& state, vec4& result ) {
     rand( state, result.x );
     rand( state, result.y );
     rand( state, result.z );
     rand( state, result.w );
 }
-void rand( xor_shift& state, ivec4& result ) {
+SMATH_INLINE void rand( splitmix64& state, ivec4& result ) {
     rand( state, result.x );
     rand( state, result.y );
     rand( state, result.z );
     rand( state, result.w );
 }
-void rand( xor_shift64& state, u64& next ) {
-    u64 result = state.current;
-    result ^= result << 13;
-    result ^= result >> 7;
-    result ^= result << 17;
-
-    state.current = result;
-    next = result;
+SMATH_INLINE void rand( pcg32& state, i32& next ) {
+    u32 result;
+    rand( state, result );
+    next = *(i32*)&result;
+}
+SMATH_INLINE void rand( pcg32& state, f32& next ) {
+    u32 result;
+    rand( state, result );
+    next = internal::rand_bits_to_f32( result, RAND_INTERVAL_SIGNED );
+}
+SMATH_INLINE void rand( pcg32& state, vec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( pcg32& state, ivec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( pcg32& state, vec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( pcg32& state, ivec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( pcg32& state, vec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void rand( pcg32& state, ivec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void rand( xoshiro128plus& state, i32& next ) {
+    u32 result;
+    rand( state, result );
+    next = *(i32*)&result;
 }
-void rand( xor_shift64& state, i64& next ) {
+SMATH_INLINE void rand( xoshiro128plus& state, f32& next ) {
+    u32 result;
+    rand( state, result );
+    next = internal::rand_bits_to_f32( result, RAND_INTERVAL_SIGNED );
+}
+SMATH_INLINE void rand( xoshiro128plus& state, vec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( xoshiro128plus& state, ivec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( xoshiro128plus& state, vec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( xoshiro128plus& state, ivec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( xoshiro128plus& state, vec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void rand( xoshiro128plus& state, ivec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, i64& next ) {
     u64 result;
     rand( state, result );
     next = *(i64*)&result;
 }
-void rand( xor_shift64& state, f64& next ) {
-    i64 result;
+SMATH_INLINE void rand( xoshiro256starstar& state, f64& next ) {
+    u64 result;
     rand( state, result );
-    next = normalize_range64(result);
+    next = internal::rand_bits_to_f64( result );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, u32& next ) {
+    u64 result;
+    rand( state, result );
+    next = (u32)( result >> 32 );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, i32& next ) {
+    u32 result;
+    rand( state, result );
+    next = *(i32*)&result;
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, f32& next ) {
+    u32 result;
+    rand( state, result );
+    next = internal::rand_bits_to_f32( result, RAND_INTERVAL_SIGNED );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, vec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, ivec2& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, vec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, ivec3& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, vec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void rand( xoshiro256starstar& state, ivec4& result ) {
+    rand( state, result.x );
+    rand( state, result.y );
+    rand( state, result.z );
+    rand( state, result.w );
+}
+SMATH_INLINE void advance( splitmix64& state, u64 delta ) {
+    state.current += delta * 0x9E3779B97F4A7C15ull;
+}
+SMATH_INLINE void advance( pcg32& state, u64 delta ) {
+    // NOTE(alicia): composes the lcg step with itself by squaring,
+    // see Brown, "Random Number Generation with Arbitrary Strides"
+    u64 multiplier     = 6364136223846793005ull;
+    u64 increment      = state.increment;
+    u64 acc_multiplier = 1;
+    u64 acc_increment  = 0;
+    while( delta ) {
+        if( delta & 1 ) {
+            acc_multiplier *= multiplier;
+            acc_increment   = acc_increment * multiplier + increment;
+        }
+        increment   = ( multiplier + 1 ) * increment;
+        multiplier *= multiplier;
+        delta >>= 1;
+    }
+    state.current = acc_multiplier * state.current + acc_increment;
+}
+SMATH_INLINE void jump( xoshiro128plus& state ) {
+    constexpr u32 JUMP[] = { 0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu };
+
+    u32 result[4] = {};
+    for( u32 i = 0; i < 4; ++i ) {
+        for( u32 bit = 0; bit < 32; ++bit ) {
+            if( JUMP[i] & ( 1u << bit ) ) {
+                for( u32 j = 0; j < 4; ++j ) {
+                    result[j] ^= state.current[j];
+                }
+            }
+            u32 discard;
+            rand( state, discard );
+        }
+    }
+    for( u32 j = 0; j < 4; ++j ) {
+        state.current[j] = result[j];
+    }
+}
+SMATH_INLINE void jump( xoshiro256starstar& state ) {
+    constexpr u64 JUMP[] = {
+        0x180EC6D33CFD0A8Dull, 0xD5A61266F0C9392Cull,
+        0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+    };
+
+    u64 result[4] = {};
+    for( u32 i = 0; i < 4; ++i ) {
+        for( u32 bit = 0; bit < 64; ++bit ) {
+            if( JUMP[i] & ( 1ull << bit ) ) {
+                for( u32 j = 0; j < 4; ++j ) {
+                    result[j] ^= state.current[j];
+                }
+            }
+            u64 discard;
+            rand( state, discard );
+        }
+    }
+    for( u32 j = 0; j < 4; ++j ) {
+        state.current[j] = result[j];
+    }
+}
+
+namespace internal {
+
+// NOTE(alicia): samplers pull generator output in blocks of this many values,
+// multiple of SOA_LANE_WIDTH
+constexpr usize RAND_BATCH = 256;
+
+inline void rand_fill_xor_shift( void* state, u32* out_bits, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        rand( *(xor_shift*)state, out_bits[i] );
+    }
+}
+template<typename T>
+inline void rand_fill_split64( void* state, u32* out_bits, usize count ) {
+    for( usize i = 0; i < count; i += 2 ) {
+        u64 bits;
+        rand( *(T*)state, bits );
+        out_bits[i] = (u32)( bits >> 32 );
+        if( i + 1 < count ) {
+            out_bits[i + 1] = (u32)bits;
+        }
+    }
+}
+template<typename T>
+inline void rand_fill_u32( void* state, u32* out_bits, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        rand( *(T*)state, out_bits[i] );
+    }
+}
+inline void rand_fill_xor_shift_x4( void* state, u32* out_bits, usize count ) {
+    using namespace simd;
+    for( usize i = 0; i < count; i += 4 ) {
+        lane4i_t _bits;
+        rand( *(xor_shift_x4*)state, _bits );
+        if( count - i >= 4 ) {
+            lane4i_store_unaligned( _bits, (i32*)out_bits + i );
+        } else {
+            i32 tail[4];
+            lane4i_store_unaligned( _bits, tail );
+            for( usize j = 0; j < count - i; ++j ) {
+                out_bits[i + j] = (u32)tail[j];
+            }
+        }
+    }
+}
+inline void rand_fill_xor_shift_x8( void* state, u32* out_bits, usize count ) {
+    using namespace simd;
+    for( usize i = 0; i < count; i += 8 ) {
+        lane8i_t _bits;
+        rand( *(xor_shift_x8*)state, _bits );
+        if( count - i >= 8 ) {
+            lane8i_store_unaligned( _bits, (i32*)out_bits + i );
+        } else {
+            i32 tail[8];
+            lane8i_store_unaligned( _bits, tail );
+            for( usize j = 0; j < count - i; ++j ) {
+                out_bits[i + j] = (u32)tail[j];
+            }
+        }
+    }
+}
+
+// NOTE(alicia): buffered reader for scalar samplers that draw
+// a varying number of values per output
+struct rand_bits {
+    rand_source* source;
+    usize at;
+    u32 buffer[RAND_BATCH];
+};
+inline void rand_bits_create( rand_source& source, rand_bits* out_bits ) {
+    out_bits->source = &source;
+    out_bits->at     = RAND_BATCH;
+}
+inline u32 rand_bits_next( rand_bits& bits ) {
+    if( bits.at == RAND_BATCH ) {
+        bits.source->fill( bits.source->state, bits.buffer, RAND_BATCH );
+        bits.at = 0;
+    }
+    return bits.buffer[bits.at++];
+}
+
+// NOTE(alicia): z uniform in -1-1 and uniform angle around z
+// gives uniform directions (Archimedes), no rejection loop
+inline void rand_unit_vec3_lane(
+    simd::lane8i_t bits_z, simd::lane8i_t bits_angle,
+    simd::lane8f_t* out_x, simd::lane8f_t* out_y, simd::lane8f_t* out_z
+) {
+    using namespace simd;
+    lane8f_t _z     = rand_bits_to_f32( bits_z, RAND_INTERVAL_SIGNED );
+    lane8f_t _angle = lane8f_mul(
+        rand_bits_to_f32( bits_angle, RAND_INTERVAL_UNIT ), lane8f_set_scalar( F32::TAU ) );
+    lane8f_t _r = lane8f_sqrt( lane8f_max(
+        lane8f_sub( lane8f_set_scalar( 1.0f ), lane8f_mul( _z, _z ) ), lane8f_set_scalar( 0.0f ) ) );
+
+    lane8f_t _sin, _cos;
+    lane8f_sincos( _angle, &_sin, &_cos );
+
+    *out_x = lane8f_mul( _r, _cos );
+    *out_y = lane8f_mul( _r, _sin );
+    *out_z = _z;
+}
+inline void rand_store_vec3(
+    simd::lane8f_t x, simd::lane8f_t y, simd::lane8f_t z,
+    vec3* out_result, usize remaining
+) {
+    using namespace simd;
+    f32 _x[SOA_LANE_WIDTH], _y[SOA_LANE_WIDTH], _z[SOA_LANE_WIDTH];
+    lane8f_store_unaligned( x, _x );
+    lane8f_store_unaligned( y, _y );
+    lane8f_store_unaligned( z, _z );
+    usize count = min( remaining, (usize)SOA_LANE_WIDTH );
+    for( usize i = 0; i < count; ++i ) {
+        out_result[i] = { _x[i], _y[i], _z[i] };
+    }
+}
+
+// NOTE(alicia): Marsaglia and Tsang ziggurat with 128 layers.
+// layer index comes from the low 7 bits and the signed 25-bit offset from the rest,
+// so the two are not correlated
+constexpr f32 ZIGGURAT_R = 3.442619855899f;
+struct ziggurat_table {
+    u32 k[128];
+    f32 w[128];
+    f32 f[128];
+};
+inline ziggurat_table ziggurat_build() {
+    const f64 m  = 16777216.0;
+    const f64 v  = 9.91256303526217e-3;
+    f64 d = ZIGGURAT_R;
+    f64 t = d;
+    f64 q = v / _exp_( -0.5 * d * d );
+
+    ziggurat_table table = {};
+    table.k[0]   = (u32)( ( d / q ) * m );
+    table.k[1]   = 0;
+    table.w[0]   = (f32)( q / m );
+    table.w[127] = (f32)( d / m );
+    table.f[0]   = 1.0f;
+    table.f[127] = (f32)_exp_( -0.5 * d * d );
+    for( u32 i = 126; i >= 1; --i ) {
+        d = _sqrt_( -2.0 * _log_( v / d + _exp_( -0.5 * d * d ) ) );
+        table.k[i + 1] = (u32)( ( d / t ) * m );
+        t = d;
+        table.f[i] = (f32)_exp_( -0.5 * d * d );
+        table.w[i] = (f32)( d / m );
+    }
+    return table;
+}
+inline f32 ziggurat_sample( const ziggurat_table& table, rand_bits& bits ) {
+    for( ;; ) {
+        u32 next   = rand_bits_next( bits );
+        u32 layer  = next & 127;
+        i32 offset = (i32)next >> 7;
+        u32 offset_abs = offset < 0 ? (u32)-offset : (u32)offset;
+        f32 x = (f32)offset * table.w[layer];
+        if( offset_abs < table.k[layer] ) {
+            return x;
+        }
+        if( layer == 0 ) {
+            // NOTE(alicia): tail past R, Marsaglia's exponential method
+            f32 tail, y;
+            do {
+                tail = -_logf_( 1.0f - rand_bits_to_f32( rand_bits_next( bits ), RAND_INTERVAL_UNIT ) ) / ZIGGURAT_R;
+                y    = -_logf_( 1.0f - rand_bits_to_f32( rand_bits_next( bits ), RAND_INTERVAL_UNIT ) );
+            } while( y + y < tail * tail );
+            return offset > 0 ? ZIGGURAT_R + tail : -ZIGGURAT_R - tail;
+        }
+        f32 u = rand_bits_to_f32( rand_bits_next( bits ), RAND_INTERVAL_UNIT );
+        if( table.f[layer] + u * ( table.f[layer - 1] - table.f[layer] ) < _expf_( -0.5f * x * x ) ) {
+            return x;
+        }
+    }
+}
+
+} // namespace smath::internal
+
+SMATH_INLINE rand_source new_rand_source( xor_shift& state ) {
+    return { &state, internal::rand_fill_xor_shift };
+}
+SMATH_INLINE rand_source new_rand_source( xor_shift64& state ) {
+    return { &state, internal::rand_fill_split64<xor_shift64> };
+}
+SMATH_INLINE rand_source new_rand_source( xor_shift_x4& state ) {
+    return { &state, internal::rand_fill_xor_shift_x4 };
+}
+SMATH_INLINE rand_source new_rand_source( xor_shift_x8& state ) {
+    return { &state, internal::rand_fill_xor_shift_x8 };
+}
+SMATH_INLINE rand_source new_rand_source( splitmix64& state ) {
+    return { &state, internal::rand_fill_split64<splitmix64> };
+}
+SMATH_INLINE rand_source new_rand_source( pcg32& state ) {
+    return { &state, internal::rand_fill_u32<pcg32> };
+}
+SMATH_INLINE rand_source new_rand_source( xoshiro128plus& state ) {
+    return { &state, internal::rand_fill_u32<xoshiro128plus> };
+}
+SMATH_INLINE rand_source new_rand_source( xoshiro256starstar& state ) {
+    return { &state, internal::rand_fill_split64<xoshiro256starstar> };
+}
+SMATH_INLINE void rand_range_n( rand_source& source, f32 min, f32 max, f32* out_values, usize count ) {
+    using namespace simd;
+    u32 bits[internal::RAND_BATCH];
+    lane8f_t _min    = lane8f_set_scalar( min );
+    lane8f_t _extent = lane8f_set_scalar( max - min );
+    for( usize first = 0; first < count; first += internal::RAND_BATCH ) {
+        usize batch = smath::min( count - first, internal::RAND_BATCH );
+        source.fill( source.state, bits, internal::soa_padded( batch ) );
+        for( usize i = 0; i < batch; i += SOA_LANE_WIDTH ) {
+            lane8f_t _unit = internal::rand_bits_to_f32(
+                lane8i_load_unaligned( (i32*)bits + i ), RAND_INTERVAL_UNIT );
+            internal::soa_store_lane(
+                lane8f_fmadd( _unit, _extent, _min ), out_values + first + i, batch - i );
+        }
+    }
+}
+SMATH_INLINE void rand_range_n( rand_source& source, i32 min, i32 max, i32* out_values, usize count ) {
+    u32 range = (u32)max - (u32)min;
+    if( max <= min ) {
+        for( usize i = 0; i < count; ++i ) {
+            out_values[i] = min;
+        }
+        return;
+    }
+    // NOTE(alicia): Lemire's multiply-shift, values landing in the
+    // biased low part of a bucket are redrawn
+    u32 threshold = ( 0u - range ) % range;
+    internal::rand_bits bits;
+    internal::rand_bits_create( source, &bits );
+    for( usize i = 0; i < count; ++i ) {
+        u64 product;
+        do {
+            product = (u64)internal::rand_bits_next( bits ) * range;
+        } while( (u32)product < threshold );
+        out_values[i] = (i32)( (u32)min + (u32)( product >> 32 ) );
+    }
+}
+SMATH_INLINE bool32 rand_range_n( rand_source& source, f32 min, f32 max, usize count, list_t* out_values ) {
+    if( !internal::list_reserve_items( out_values, sizeof(f32), count ) ) {
+        return false;
+    }
+    out_values->count = count;
+    rand_range_n( source, min, max, (f32*)out_values->buffer, count );
+    return true;
+}
+SMATH_INLINE bool32 rand_range_n( rand_source& source, i32 min, i32 max, usize count, list_t* out_values ) {
+    if( !internal::list_reserve_items( out_values, sizeof(i32), count ) ) {
+        return false;
+    }
+    out_values->count = count;
+    rand_range_n( source, min, max, (i32*)out_values->buffer, count );
+    return true;
+}
+SMATH_INLINE void rand_normal_n( rand_source& source, f32 mean, f32 std_dev, f32* out_values, usize count ) {
+    static const internal::ziggurat_table table = internal::ziggurat_build();
+    internal::rand_bits bits;
+    internal::rand_bits_create( source, &bits );
+    for( usize i = 0; i < count; ++i ) {
+        out_values[i] = mean + std_dev * internal::ziggurat_sample( table, bits );
+    }
+}
+SMATH_INLINE bool32 rand_normal_n( rand_source& source, f32 mean, f32 std_dev, usize count, list_t* out_values ) {
+    if( !internal::list_reserve_items( out_values, sizeof(f32), count ) ) {
+        return false;
+    }
+    out_values->count = count;
+    rand_normal_n( source, mean, std_dev, (f32*)out_values->buffer, count );
+    return true;
+}
+SMATH_INLINE void rand_unit_vec3_n( rand_source& source, vec3* out_values, usize count ) {
+    using namespace simd;
+    u32 bits[internal::RAND_BATCH * 2];
+    for( usize first = 0; first < count; first += internal::RAND_BATCH ) {
+        usize batch  = smath::min( count - first, internal::RAND_BATCH );
+        usize padded = internal::soa_padded( batch );
+        source.fill( source.state, bits, padded * 2 );
+        for( usize i = 0; i < batch; i += SOA_LANE_WIDTH ) {
+            lane8f_t _x, _y, _z;
+            internal::rand_unit_vec3_lane(
+                lane8i_load_unaligned( (i32*)bits + i ),
+                lane8i_load_unaligned( (i32*)bits + padded + i ),
+                &_x, &_y, &_z );
+            internal::rand_store_vec3( _x, _y, _z, out_values + first + i, batch - i );
+        }
+    }
+}
+SMATH_INLINE bool32 rand_unit_vec3_n( rand_source& source, usize count, list_t* out_values ) {
+    if( !internal::list_reserve_items( out_values, sizeof(vec3), count ) ) {
+        return false;
+    }
+    out_values->count = count;
+    rand_unit_vec3_n( source, (vec3*)out_values->buffer, count );
+    return true;
+}
+SMATH_INLINE void rand_in_sphere_n( rand_source& source, vec3* out_values, usize count ) {
+    using namespace simd;
+    u32 bits[internal::RAND_BATCH * 3];
+    lane8f_t _one   = lane8f_set_scalar( 1.0f );
+    lane8f_t _third = lane8f_set_scalar( 1.0f / 3.0f );
+    for( usize first = 0; first < count; first += internal::RAND_BATCH ) {
+        usize batch  = smath::min( count - first, internal::RAND_BATCH );
+        usize padded = internal::soa_padded( batch );
+        source.fill( source.state, bits, padded * 3 );
+        for( usize i = 0; i < batch; i += SOA_LANE_WIDTH ) {
+            lane8f_t _x, _y, _z;
+            internal::rand_unit_vec3_lane(
+                lane8i_load_unaligned( (i32*)bits + i ),
+                lane8i_load_unaligned( (i32*)bits + padded + i ),
+                &_x, &_y, &_z );
+            // NOTE(alicia): cube root of uniform 0-1 (0 excluded) gives uniform volume
+            lane8f_t _unit = internal::rand_bits_to_f32(
+                lane8i_load_unaligned( (i32*)bits + ( padded * 2 ) + i ), RAND_INTERVAL_UNIT );
+            lane8f_t _radius = lane8f_pow( lane8f_sub( _one, _unit ), _third );
+            internal::rand_store_vec3(
+                lane8f_mul( _x, _radius ), lane8f_mul( _y, _radius ), lane8f_mul( _z, _radius ),
+                out_values + first + i, batch - i );
+        }
+    }
+}
+SMATH_INLINE bool32 rand_in_sphere_n( rand_source& source, usize count, list_t* out_values ) {
+    if( !internal::list_reserve_items( out_values, sizeof(vec3), count ) ) {
+        return false;
+    }
+    out_values->count = count;
+    rand_in_sphere_n( source, (vec3*)out_values->buffer, count );
+    return true;
+}
+SMATH_INLINE void rand_in_disk_n( rand_source& source, vec2* out_values, usize count ) {
+    using namespace simd;
+    u32 bits[internal::RAND_BATCH * 2];
+    f32 x[SOA_LANE_WIDTH], y[SOA_LANE_WIDTH];
+    lane8f_t _tau = lane8f_set_scalar( F32::TAU );
+    for( usize first = 0; first < count; first += internal::RAND_BATCH ) {
+        usize batch  = smath::min( count - first, internal::RAND_BATCH );
+        usize padded = internal::soa_padded( batch );
+        source.fill( source.state, bits, padded * 2 );
+        for( usize i = 0; i < batch; i += SOA_LANE_WIDTH ) {
+            // NOTE(alicia): square root of uniform radius gives uniform area
+            lane8f_t _radius = lane8f_sqrt( internal::rand_bits_to_f32(
+                lane8i_load_unaligned( (i32*)bits + i ), RAND_INTERVAL_UNIT ) );
+            lane8f_t _angle = lane8f_mul( internal::rand_bits_to_f32(
+                lane8i_load_unaligned( (i32*)bits + padded + i ), RAND_INTERVAL_UNIT ), _tau );
+
+            lane8f_t _sin, _cos;
+            lane8f_sincos( _angle, &_sin, &_cos );
+            lane8f_store_unaligned( lane8f_mul( _radius, _cos ), x );
+            lane8f_store_unaligned( lane8f_mul( _radius, _sin ), y );
+
+            usize lanes = smath::min( batch - i, (usize)SOA_LANE_WIDTH );
+            for( usize lane = 0; lane < lanes; ++lane ) {
+                out_values[first + i + lane] = { x[lane], y[lane] };
+            }
+        }
+    }
+}
+SMATH_INLINE bool32 rand_in_disk_n( rand_source& source, usize count, list_t* out_values ) {
+    if( !internal::list_reserve_items( out_values, sizeof(vec2), count ) ) {
+        return false;
+    }
+    out_values->count = count;
+    rand_in_disk_n( source, (vec2*)out_values->buffer, count );
+    return true;
+}
+SMATH_INLINE bool32 alias_table_create( const f32* weights, usize count, alias_table* out_result ) {
+    *out_result = {};
+    if( !count || count > U32::MAX ) {
+        return false;
+    }
+    f64 total = 0.0;
+    for( usize i = 0; i < count; ++i ) {
+        if( !( weights[i] >= 0.0f ) ) {
+            return false;
+        }
+        total += weights[i];
+    }
+    if( !( total > 0.0 ) ) {
+        return false;
+    }
+
+    f32* probability = (f32*)smcol_alloc_aligned( sizeof(f32) * count, SOA_ALIGNMENT );
+    u32* alias       = (u32*)smcol_alloc_aligned( sizeof(u32) * count, SOA_ALIGNMENT );
+    u32* work        = (u32*)smcol_alloc_aligned( sizeof(u32) * count, SOA_ALIGNMENT );
+    if( !probability || !alias || !work ) {
+        smcol_free_aligned( probability );
+        smcol_free_aligned( alias );
+        smcol_free_aligned( work );
+        return false;
+    }
+
+    // NOTE(alicia): small buckets stack up from the front of work,
+    // large buckets stack down from the back
+    u32 small_count = 0;
+    u32 large_first = (u32)count;
+    f64 scale = (f64)count / total;
+    for( u32 i = 0; i < (u32)count; ++i ) {
+        probability[i] = (f32)( weights[i] * scale );
+        alias[i]       = i;
+        if( probability[i] < 1.0f ) {
+            work[small_count++] = i;
+        } else {
+            work[--large_first] = i;
+        }
+    }
+    while( small_count && large_first < (u32)count ) {
+        u32 small = work[--small_count];
+        u32 large = work[large_first];
+
+        alias[small]       = large;
+        probability[large] = ( probability[large] + probability[small] ) - 1.0f;
+        if( probability[large] < 1.0f ) {
+            large_first++;
+            work[small_count++] = large;
+        }
+    }
+    // NOTE(alicia): leftovers are only off from 1 by rounding
+    for( u32 i = 0; i < small_count; ++i ) {
+        probability[work[i]] = 1.0f;
+    }
+    for( u32 i = large_first; i < (u32)count; ++i ) {
+        probability[work[i]] = 1.0f;
+    }
+    smcol_free_aligned( work );
+
+    out_result->probability = probability;
+    out_result->alias       = alias;
+    out_result->count       = (u32)count;
+    return true;
+}
+SMATH_INLINE void alias_table_free( alias_table* table ) {
+    smcol_free_aligned( table->probability );
+    smcol_free_aligned( table->alias );
+    *table = {};
+}
+SMATH_INLINE void rand_choice_n( rand_source& source, const alias_table& table, u32* out_indices, usize count ) {
+    internal::rand_bits bits;
+    internal::rand_bits_create( source, &bits );
+    for( usize i = 0; i < count; ++i ) {
+        u32 bucket = (u32)( ( (u64)internal::rand_bits_next( bits ) * table.count ) >> 32 );
+        f32 coin   = internal::rand_bits_to_f32( internal::rand_bits_next( bits ), RAND_INTERVAL_UNIT );
+        out_indices[i] = coin < table.probability[bucket] ? bucket : table.alias[bucket];
+    }
+}
+SMATH_INLINE bool32 rand_choice_n( rand_source& source, const alias_table& table, usize count, list_t* out_indices ) {
+    if( !internal::list_reserve_items( out_indices, sizeof(u32), count ) ) {
+        return false;
+    }
+    out_indices->count = count;
+    rand_choice_n( source, table, (u32*)out_indices->buffer, count );
+    return true;
 }
 
 } // namespace smath
@@ -3248,3 +6468,4 @@ void rand( xor_shift64& state, f64& next ) {
     #pragma clang diagnostic pop
 #endif
 
+#endif // SMUSHY_SMATH_IMPL
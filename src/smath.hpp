@@ -2,440 +2,373 @@
  * Description:  C++ Math library
  * Author:       Alicia Amarilla (smushy) 
  * File Created: February 06, 2023
- * Includes:     "smalias.h"   required
- *               <immintrin.h> if SMUSHY_SIMD_ENABLED is defined (BEFORE INCLUDING smath.hpp!)
+ * Includes:     "smdef.h", "smsimd.h", "smcol.h" required
+ * Notes:        SIMD paths are selected through SMUSHY_SIMD_WIDTH,
+ *               see smsimd.h
+ *               define SMATH_HEADER_ONLY to use smath without
+ *               compiling smath.cpp
 */
 
 #if !defined(SMUSHY_SMATH)
 #define SMUSHY_SMATH
 
 #include "smdef.h"
+#include "smsimd.h"
+#include "smcol.h"
+
+// NOTE(alicia): SMATH_HEADER_ONLY pulls the definitions from smath.cpp
+// into every translation unit so the compiler can inline them without LTO,
+// simple scalar and vector functions also become constexpr.
+// smsimd.c still has to be compiled separately.
+#if defined(SMATH_HEADER_ONLY)
+    #define SMATH_INLINE    inline
+    #define SMATH_CONSTEXPR constexpr
+#else
+    #define SMATH_INLINE
+    #define SMATH_CONSTEXPR
+#endif
 
 #if defined(SM_COMPILER_CLANG)
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Wmissing-braces"
 #endif
 
-#if defined(__x86_64__) || defined(_M_X64)
-    #define SMUSHY_X86_64_PLATFORM
-#endif
-
-#if defined(SMUSHY_SIMD_ENABLED)
-
-#if defined(SMUSHY_X86_64_PLATFORM)
-
-typedef __attribute((vector_size(16))) float __m128;
-typedef __attribute((vector_size(32))) float __m256;
-
-#endif // simd::x86
-
-#endif // simd
-
 namespace smath {
 
-namespace simd {
-
-struct lane4f {
-    union {
-        struct { f32 a, b, c, d; };
-#if defined(SMUSHY_SIMD_ENABLED)
-
-#if defined(SMUSHY_X86_64_PLATFORM)
-        __m128 simd;
-#endif // simd::x86
-
-#endif // simd
-    };
-
-    lane4f();
-    lane4f( f32 a, f32 b, f32 c, f32 d );
-    lane4f( f32 scalar );
-    lane4f( const f32* four_wide_array );
-
-    f32& operator[]( u32 index );
-    f32  operator[]( u32 index ) const;
-
-    lane4f& operator+=( const lane4f& rhs );
-    lane4f& operator-=( const lane4f& rhs );
-    lane4f& operator*=( const lane4f& rhs );
-    lane4f& operator/=( const lane4f& rhs );
-};
-lane4f operator+( const lane4f& lhs, const lane4f& rhs );
-lane4f operator-( const lane4f& lhs, const lane4f& rhs );
-lane4f operator*( const lane4f& lhs, const lane4f& rhs );
-lane4f operator/( const lane4f& lhs, const lane4f& rhs );
-lane4f sqrt( lane4f x );
-void store( f32* four_wide_array, lane4f registers );
-
-struct lane8f {
-    union {
-        struct { f32 a, b, c, d, e, f, g, h; };
-#if defined(SMUSHY_SIMD_ENABLED)
-
-#if defined(SMUSHY_X86_64_PLATFORM)
-        __m256 simd;
-#endif // simd::x86
-
-#endif // simd
-    };
-
-    lane8f();
-    lane8f( f32 a, f32 b, f32 c, f32 d, f32 e, f32 f, f32 g, f32 h );
-    lane8f( f32 scalar );
-    lane8f( const f32* eight_wide_array );
-
-    f32& operator[]( u32 index );
-    f32  operator[]( u32 index ) const;
-    lane8f& operator+=( const lane8f& rhs );
-    lane8f& operator-=( const lane8f& rhs );
-    lane8f& operator*=( const lane8f& rhs );
-    lane8f& operator/=( const lane8f& rhs );
-};
-lane8f operator+( const lane8f& lhs, const lane8f& rhs );
-lane8f operator-( const lane8f& lhs, const lane8f& rhs );
-lane8f operator*( const lane8f& lhs, const lane8f& rhs );
-lane8f operator/( const lane8f& lhs, const lane8f& rhs );
-lane8f sqrt( lane8f x );
-void store( f32* eight_wide_array, lane8f registers );
-lane4f extract_high( lane8f a );
-lane4f extract_low( lane8f a );
-
-} // namespace smath::simd
-
 // NOTE(alicia): FUNCTIONS -------------------------------------------------------------------------------------------------
 
 /// @brief  truncate x
 /// @param x floating-point number
 /// @return input number without the fractional part as i64
-i64 trunc64( f32 x );
+SMATH_CONSTEXPR i64 trunc64( f32 x );
 /// @brief  truncate x
 /// @param x floating-point number
 /// @return input number without the fractional part as i64
-i64 trunc64( f64 x );
+SMATH_CONSTEXPR i64 trunc64( f64 x );
 /// @brief  truncate x
 /// @param x floating-point number
 /// @return input number without the fractional part as i32
-i32 trunc32( f32 x );
+SMATH_CONSTEXPR i32 trunc32( f32 x );
 /// @brief  truncate x
 /// @param x floating-point number
 /// @return input number without the fractional part as i32
-i32 trunc32( f64 x );
+SMATH_CONSTEXPR i32 trunc32( f64 x );
 /// @brief  truncate x
 /// @param x floating-point number
 /// @return input number without the fractional part as i16
-i16 trunc16( f32 x );
+SMATH_CONSTEXPR i16 trunc16( f32 x );
 /// @brief  truncate x
 /// @param x floating-point number
 /// @return input number without the fractional part as i16
-i16 trunc16( f64 x );
+SMATH_CONSTEXPR i16 trunc16( f64 x );
 /// @brief  truncate x
 /// @param x floating-point number
 /// @return input number without the fractional part as i8
-i8 trunc8( f32 x );
+SMATH_CONSTEXPR i8 trunc8( f32 x );
 /// @brief  truncate x
 /// @param x floating-point number
 /// @return input number without the fractional part as i8
-i8 trunc8( f64 x );
+SMATH_CONSTEXPR i8 trunc8( f64 x );
 
 /// @brief  floor x
 /// @param x floating-point number
 /// @return round down as i64
-i64 floor64( f64 x );
+SMATH_CONSTEXPR i64 floor64( f64 x );
 /// @brief  floor x
 /// @param x floating-point number
 /// @return round down as i64
-i64 floor64( f32 x );
+SMATH_CONSTEXPR i64 floor64( f32 x );
 /// @brief  floor x
 /// @param x floating-point number
 /// @return round down as i32
-i32 floor32( f64 x );
+SMATH_CONSTEXPR i32 floor32( f64 x );
 /// @brief  floor x
 /// @param x floating-point number
 /// @return round down as i32
-i32 floor32( f32 x );
+SMATH_CONSTEXPR i32 floor32( f32 x );
 /// @brief  floor x
 /// @param x floating-point number
 /// @return round down as i16
-i16 floor16( f64 x );
+SMATH_CONSTEXPR i16 floor16( f64 x );
 /// @brief  floor x
 /// @param x floating-point number
 /// @return round down as i16
-i16 floor16( f32 x );
+SMATH_CONSTEXPR i16 floor16( f32 x );
 /// @brief  floor x
 /// @param x floating-point number
 /// @return round down as i8
-i8 floor8( f64 x );
+SMATH_CONSTEXPR i8 floor8( f64 x );
 /// @brief  floor x
 /// @param x floating-point number
 /// @return round down as i8
-i8 floor8( f32 x );
+SMATH_CONSTEXPR i8 floor8( f32 x );
 
 /// @brief  ceil x
 /// @param x floating-point number
 /// @return round up as i64
-i64 ceil64( f64 x );
+SMATH_CONSTEXPR i64 ceil64( f64 x );
 /// @brief  ceil x
 /// @param x floating-point number
 /// @return round up as i64
-i64 ceil64( f32 x );
+SMATH_CONSTEXPR i64 ceil64( f32 x );
 /// @brief  ceil x
 /// @param x floating-point number
 /// @return round up as i32
-i32 ceil32( f64 x );
+SMATH_CONSTEXPR i32 ceil32( f64 x );
 /// @brief  ceil x
 /// @param x floating-point number
 /// @return round up as i32
-i32 ceil32( f32 x );
+SMATH_CONSTEXPR i32 ceil32( f32 x );
 /// @brief  ceil x
 /// @param x floating-point number
 /// @return round up as i16
-i16 ceil16( f64 x );
+SMATH_CONSTEXPR i16 ceil16( f64 x );
 /// @brief  ceil x
 /// @param x floating-point number
 /// @return round up as i16
-i16 ceil16( f32 x );
+SMATH_CONSTEXPR i16 ceil16( f32 x );
 /// @brief  ceil x
 /// @param x floating-point number
 /// @return round up as i8
-i8 ceil8( f64 x );
+SMATH_CONSTEXPR i8 ceil8( f64 x );
 /// @brief  ceil x
 /// @param x floating-point number
 /// @return round up as i8
-i8 ceil8( f32 x );
+SMATH_CONSTEXPR i8 ceil8( f32 x );
 
 /// @brief  round x
 /// @param x floating-point number
 /// @return round as i64
-i64 round64( f64 x );
+SMATH_CONSTEXPR i64 round64( f64 x );
 /// @brief  round x
 /// @param x floating-point number
 /// @return round as i64
-i64 round64( f32 x );
+SMATH_CONSTEXPR i64 round64( f32 x );
 /// @brief  round x
 /// @param x floating-point number
 /// @return round as i32
-i32 round32( f64 x );
+SMATH_CONSTEXPR i32 round32( f64 x );
 /// @brief  round x
 /// @param x floating-point number
 /// @return round as i32
-i32 round32( f32 x );
+SMATH_CONSTEXPR i32 round32( f32 x );
 /// @brief  round x
 /// @param x floating-point number
 /// @return round as i16
-i16 round16( f64 x );
+SMATH_CONSTEXPR i16 round16( f64 x );
 /// @brief  round x
 /// @param x floating-point number
 /// @return round as i16
-i16 round16( f32 x );
+SMATH_CONSTEXPR i16 round16( f32 x );
 /// @brief  round x
 /// @param x floating-point number
 /// @return round as i8
-i8 round8( f64 x );
+SMATH_CONSTEXPR i8 round8( f64 x );
 /// @brief  round x
 /// @param x floating-point number
 /// @return round as i8
-i8 round8( f32 x );
+SMATH_CONSTEXPR i8 round8( f32 x );
 
 /// @brief sign of x
 /// @param x integer
 /// @return -1 if negative, otherwise 1 as i8
-i8 sign( i8 x );
+SMATH_CONSTEXPR i8 sign( i8 x );
 /// @brief sign of x
 /// @param x integer
 /// @return -1 if negative, otherwise 1 as i16
-i16 sign( i16 x );
+SMATH_CONSTEXPR i16 sign( i16 x );
 /// @brief sign of x
 /// @param x integer
 /// @return -1 if negative, otherwise 1 as i32
-i32 sign( i32 x );
+SMATH_CONSTEXPR i32 sign( i32 x );
 /// @brief sign of x
 /// @param x integer
 /// @return -1 if negative, otherwise 1 as i64
-i64 sign( i64 x );
+SMATH_CONSTEXPR i64 sign( i64 x );
 /// @brief sign of x
 /// @param x floating-point number
 /// @return -1.0 if negative, otherwise 1.0 as f32
-f32 sign( f32 x );
+SMATH_CONSTEXPR f32 sign( f32 x );
 /// @brief sign of x
 /// @param x floating-point number
 /// @return -1.0 if negative, otherwise 1.0 as f64
-f64 sign( f64 x );
+SMATH_CONSTEXPR f64 sign( f64 x );
 
 /// @brief absolute value of x
 /// @param x integer
 /// @return magnitude of real number x as i8
-i8 absolute( i8 x );
+SMATH_CONSTEXPR i8 absolute( i8 x );
 /// @brief absolute value of x
 /// @param x integer
 /// @return magnitude of real number x as i16
-i16 absolute( i16 x );
+SMATH_CONSTEXPR i16 absolute( i16 x );
 /// @brief absolute value of x
 /// @param x integer
 /// @return magnitude of real number x as i32
-i32 absolute( i32 x );
+SMATH_CONSTEXPR i32 absolute( i32 x );
 /// @brief absolute value of x
 /// @param x integer
 /// @return magnitude of real number x as i64
-i64 absolute( i64 x );
+SMATH_CONSTEXPR i64 absolute( i64 x );
 /// @brief absolute value of x
 /// @param x integer
 /// @return magnitude of real number x as f32
-f32 absolute( f32 x );
+SMATH_CONSTEXPR f32 absolute( f32 x );
 /// @brief absolute value of x
 /// @param x integer
 /// @return magnitude of real number x as f64
-f64 absolute( f64 x );
+SMATH_CONSTEXPR f64 absolute( f64 x );
 
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as i8
-i8 clamp( i8 value, i8 min, i8 max );
+SMATH_CONSTEXPR i8 clamp( i8 value, i8 min, i8 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as i16
-i16 clamp( i16 value, i16 min, i16 max );
+SMATH_CONSTEXPR i16 clamp( i16 value, i16 min, i16 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as i32
-i32 clamp( i32 value, i32 min, i32 max );
+SMATH_CONSTEXPR i32 clamp( i32 value, i32 min, i32 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as i64
-i64 clamp( i64 value, i64 min, i64 max );
+SMATH_CONSTEXPR i64 clamp( i64 value, i64 min, i64 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as u8
-u8 clamp( u8 value, u8 min, u8 max );
+SMATH_CONSTEXPR u8 clamp( u8 value, u8 min, u8 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as u16
-u16 clamp( u16 value, u16 min, u16 max );
+SMATH_CONSTEXPR u16 clamp( u16 value, u16 min, u16 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as u32
-u32 clamp( u32 value, u32 min, u32 max );
+SMATH_CONSTEXPR u32 clamp( u32 value, u32 min, u32 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as u64
-u64 clamp( u64 value, u64 min, u64 max );
+SMATH_CONSTEXPR u64 clamp( u64 value, u64 min, u64 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as f32
-f32 clamp( f32 value, f32 min, f32 max );
+SMATH_CONSTEXPR f32 clamp( f32 value, f32 min, f32 max );
 /// @brief clamp value between min and max range
 /// @param value value to clamp
 /// @param min minimum range, inclusive
 /// @param max maximum range, inclusive
 /// @return clamped value as f64
-f64 clamp( f64 value, f64 min, f64 max );
+SMATH_CONSTEXPR f64 clamp( f64 value, f64 min, f64 max );
 /// @brief clamp value between 0-1 range
 /// @param value value to clamp
 /// @return clamped value as f32
-f32 clamp01( f32 value );
+SMATH_CONSTEXPR f32 clamp01( f32 value );
 /// @brief clamp value between 0-1 range
 /// @param value value to clamp
 /// @return clamped value as f64
-f64 clamp01( f64 value );
+SMATH_CONSTEXPR f64 clamp01( f64 value );
 
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as i8
-i8 min( i8 a, i8 b);
+SMATH_CONSTEXPR i8 min( i8 a, i8 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as i16
-i16 min( i16 a, i16 b);
+SMATH_CONSTEXPR i16 min( i16 a, i16 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as i32
-i32 min( i32 a, i32 b);
+SMATH_CONSTEXPR i32 min( i32 a, i32 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as i64
-i64 min( i64 a, i64 b);
+SMATH_CONSTEXPR i64 min( i64 a, i64 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as u8
-u8 min( u8 a, u8 b);
+SMATH_CONSTEXPR u8 min( u8 a, u8 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as u16
-u16 min( u16 a, u16 b);
+SMATH_CONSTEXPR u16 min( u16 a, u16 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as u32
-u32 min( u32 a, u32 b);
+SMATH_CONSTEXPR u32 min( u32 a, u32 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as u64
-u64 min( u64 a, u64 b);
+SMATH_CONSTEXPR u64 min( u64 a, u64 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as f32
-f32 min( f32 a, f32 b);
+SMATH_CONSTEXPR f32 min( f32 a, f32 b);
 /// @brief smallest of two values
 /// @param a,b values to test
 /// @return smallest value as f64
-f64 min( f64 a, f64 b);
+SMATH_CONSTEXPR f64 min( f64 a, f64 b);
 
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as i8
-i8 max( i8 a, i8 b);
+SMATH_CONSTEXPR i8 max( i8 a, i8 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as i16
-i16 max( i16 a, i16 b);
+SMATH_CONSTEXPR i16 max( i16 a, i16 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as i32
-i32 max( i32 a, i32 b);
+SMATH_CONSTEXPR i32 max( i32 a, i32 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as i64
-i64 max( i64 a, i64 b);
+SMATH_CONSTEXPR i64 max( i64 a, i64 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as u8
-u8 max( u8 a, u8 b);
+SMATH_CONSTEXPR u8 max( u8 a, u8 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as u16
-u16 max( u16 a, u16 b);
+SMATH_CONSTEXPR u16 max( u16 a, u16 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as u32
-u32 max( u32 a, u32 b);
+SMATH_CONSTEXPR u32 max( u32 a, u32 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as u64
-u64 max( u64 a, u64 b);
+SMATH_CONSTEXPR u64 max( u64 a, u64 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as f32
-f32 max( f32 a, f32 b);
+SMATH_CONSTEXPR f32 max( f32 a, f32 b);
 /// @brief largest of two values
 /// @param a,b values to test
 /// @return largest value as f64
-f64 max( f64 a, f64 b);
+SMATH_CONSTEXPR f64 max( f64 a, f64 b);
 
 /// @brief normalize integer to -1 to 1 range.
 /// @param x integer
@@ -615,19 +548,19 @@ f64 atan2( f64 y, f64 x );
 /// @brief convert degrees to radians
 /// @param theta floating-point number, degrees
 /// @return radians as f32
-constexpr f32 to_rad( f32 theta );
+SMATH_CONSTEXPR f32 to_rad( f32 theta );
 /// @brief convert degrees to radians
 /// @param theta floating-point number, degrees
 /// @return radians as f64
-constexpr f64 to_rad( f64 theta );
+SMATH_CONSTEXPR f64 to_rad( f64 theta );
 /// @brief convert radians to degrees
 /// @param theta floating-point number, radians
 /// @return degrees as f32
-constexpr f32 to_deg( f32 theta );
+SMATH_CONSTEXPR f32 to_deg( f32 theta );
 /// @brief convert radians to degrees
 /// @param theta floating-point number, radians
 /// @return degrees as f64
-constexpr f64 to_deg( f64 theta );
+SMATH_CONSTEXPR f64 to_deg( f64 theta );
 
 /// @brief the natural logarithm of x
 /// @param x floating-point number
@@ -643,37 +576,37 @@ f64 log( f64 x );
 /// @param b maximum value
 /// @param t fraction
 /// @return result as f32
-f32 lerp( f32 a, f32 b, f32 t );
+SMATH_CONSTEXPR f32 lerp( f32 a, f32 b, f32 t );
 /// @brief linear interpolation. blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction
 /// @return result as f64
-f64 lerp( f64 a, f64 b, f64 t );
+SMATH_CONSTEXPR f64 lerp( f64 a, f64 b, f64 t );
 /// @brief linear interpolation. blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction clamped to 0-1 range
 /// @return result as f32
-f32 clamped_lerp( f32 a, f32 b, f32 t );
+SMATH_CONSTEXPR f32 clamped_lerp( f32 a, f32 b, f32 t );
 /// @brief linear interpolation. blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction clamped to 0-1 range
 /// @return result as f64
-f64 clamped_lerp( f64 a, f64 b, f64 t );
+SMATH_CONSTEXPR f64 clamped_lerp( f64 a, f64 b, f64 t );
 /// @brief inverse linear interpolation. fraction that value occupies between a and b.
 /// @param a minimum value
 /// @param b maximum value
 /// @param v value between a and b
 /// @return result as f32
-f32 inverse_lerp( f32 a, f32 b, f32 v );
+SMATH_CONSTEXPR f32 inverse_lerp( f32 a, f32 b, f32 v );
 /// @brief inverse linear interpolation. fraction that value occupies between a and b.
 /// @param a minimum value
 /// @param b maximum value
 /// @param v value between a and b
 /// @return result as f64
-f64 inverse_lerp( f64 a, f64 b, f64 v );
+SMATH_CONSTEXPR f64 inverse_lerp( f64 a, f64 b, f64 v );
 /// @brief remap value from input range to output range
 /// @param imin input range minimum
 /// @param imax input range maximum
@@ -681,7 +614,7 @@ f64 inverse_lerp( f64 a, f64 b, f64 v );
 /// @param omax output range maximum
 /// @param v value to remap
 /// @return remapped value as f32
-f32 remap( f32 imin, f32 imax, f32 omin, f32 omax, f32 v );
+SMATH_CONSTEXPR f32 remap( f32 imin, f32 imax, f32 omin, f32 omax, f32 v );
 /// @brief remap value from input range to output range
 /// @param imin input range minimum
 /// @param imax input range maximum
@@ -689,55 +622,55 @@ f32 remap( f32 imin, f32 imax, f32 omin, f32 omax, f32 v );
 /// @param omax output range maximum
 /// @param v value to remap
 /// @return remapped value as f64
-f64 remap( f64 imin, f64 imax, f64 omin, f64 omax, f64 v );
+SMATH_CONSTEXPR f64 remap( f64 imin, f64 imax, f64 omin, f64 omax, f64 v );
 /// @brief smooth-step interpolation. smooth blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction
 /// @return result as f32
-f32 smooth_step( f32 a, f32 b, f32 t );
+SMATH_CONSTEXPR f32 smooth_step( f32 a, f32 b, f32 t );
 /// @brief smooth-step interpolation. smooth blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction
 /// @return result as f64
-f64 smooth_step( f64 a, f64 b, f64 t );
+SMATH_CONSTEXPR f64 smooth_step( f64 a, f64 b, f64 t );
 /// @brief smooth-step interpolation. smooth blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction clamped to 0-1 range
 /// @return result as f32
-f32 smooth_step_clamped( f32 a, f32 b, f32 t );
+SMATH_CONSTEXPR f32 smooth_step_clamped( f32 a, f32 b, f32 t );
 /// @brief smooth-step interpolation. smooth blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction clamped to 0-1 range
 /// @return result as f64
-f64 smooth_step_clamped( f64 a, f64 b, f64 t );
+SMATH_CONSTEXPR f64 smooth_step_clamped( f64 a, f64 b, f64 t );
 /// @brief smoother-step interpolation. smooth blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction
 /// @return result as f32
-f32 smoother_step( f32 a, f32 b, f32 t );
+SMATH_CONSTEXPR f32 smoother_step( f32 a, f32 b, f32 t );
 /// @brief smoother-step interpolation. smooth blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction
 /// @return result as f64
-f64 smoother_step( f64 a, f64 b, f64 t );
+SMATH_CONSTEXPR f64 smoother_step( f64 a, f64 b, f64 t );
 /// @brief smoother-step interpolation. smooth blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction clamped to 0-1 range
 /// @return result as f32
-f32 smoother_step_clamped( f32 a, f32 b, f32 t );
+SMATH_CONSTEXPR f32 smoother_step_clamped( f32 a, f32 b, f32 t );
 /// @brief smoother-step interpolation. smooth blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
 /// @param t fraction clamped to 0-1 range
 /// @return result as f64
-f64 smoother_step_clamped( f64 a, f64 b, f64 t );
+SMATH_CONSTEXPR f64 smoother_step_clamped( f64 a, f64 b, f64 t );
 
 // NOTE(alicia): TYPES -----------------------------------------------------------------------------------------------------
 
@@ -769,6 +702,9 @@ struct quat;
 struct mat2;
 struct mat3;
 struct mat4;
+struct mat3x4;
+struct transform;
+struct dual_quat;
 
 /// @brief 2-component 32-bit float vector
 struct vec2 {
@@ -781,11 +717,11 @@ struct vec2 {
     /// @brief create vec2 from components
     /// @param x,y components
     /// @return vec2
-    static vec2 create( f32 x, f32 y );
+    static SMATH_CONSTEXPR vec2 create( f32 x, f32 y );
     /// @brief create vec2 with all components set to the same value
     /// @param scalar component value
     /// @return vec2
-    static vec2 create( f32 scalar );
+    static SMATH_CONSTEXPR vec2 create( f32 scalar );
     /// @brief create vec2 from vec3
     /// @param v vec3
     /// @return vec2
@@ -832,37 +768,37 @@ struct vec2 {
     /// @brief compare vectors for inequality
     bool32 operator!=( const vec2& rhs ) const;
     /// @brief add vectors
-    vec2& operator+=( const vec2& rhs );
+    SMATH_CONSTEXPR vec2& operator+=( const vec2& rhs );
     /// @brief subtract vectors
-    vec2& operator-=( const vec2& rhs );
+    SMATH_CONSTEXPR vec2& operator-=( const vec2& rhs );
     /// @brief scale vector
-    vec2& operator*=( f32 rhs );
+    SMATH_CONSTEXPR vec2& operator*=( f32 rhs );
     /// @brief divide vector
-    vec2& operator/=( f32 rhs );
+    SMATH_CONSTEXPR vec2& operator/=( f32 rhs );
 };
 /// @brief add vectors
 /// @param lhs,rhs operands
 /// @return result
-vec2 operator+( const vec2& lhs, const vec2& rhs );
+SMATH_CONSTEXPR vec2 operator+( const vec2& lhs, const vec2& rhs );
 /// @brief subtract vectors
 /// @param lhs,rhs operands
 /// @return result
-vec2 operator-( const vec2& lhs, const vec2& rhs );
+SMATH_CONSTEXPR vec2 operator-( const vec2& lhs, const vec2& rhs );
 /// @brief scale vector
 /// @param lhs vector to scale
 /// @param rhs scalar
 /// @return result
-vec2 operator*( const vec2& lhs, f32 rhs );
+SMATH_CONSTEXPR vec2 operator*( const vec2& lhs, f32 rhs );
 /// @brief scale vector
 /// @param lhs scalar
 /// @param rhs vector to scale
 /// @return result
-vec2 operator*( f32 lhs, const vec2& rhs );
+SMATH_CONSTEXPR vec2 operator*( f32 lhs, const vec2& rhs );
 /// @brief divide vector
 /// @param lhs vector to divide
 /// @param rhs scalar
 /// @return result
-vec2 operator/( const vec2& lhs, f32 rhs );
+SMATH_CONSTEXPR vec2 operator/( const vec2& lhs, f32 rhs );
 /// @brief compare two vectors
 /// @param a,b vectors to compare
 /// @return true if they are approximately equal
@@ -873,7 +809,7 @@ void swap( vec2& v );
 /// @brief horizontal addition
 /// @param v vector to sum
 /// @return sum of all components of given vector
-f32 horizontal_add( const vec2& v );
+SMATH_CONSTEXPR f32 horizontal_add( const vec2& v );
 /// @brief horizontal multiplication
 /// @param v vector to multiply
 /// @return product of all components of given vector
@@ -881,7 +817,7 @@ f32 horizontal_mul( const vec2& v );
 /// @brief component-wise multiply two vectors
 /// @param lhs,rhs vectors to multiply
 /// @return result of multiplication
-vec2 hadamard( const vec2& lhs, const vec2& rhs );
+SMATH_CONSTEXPR vec2 hadamard( const vec2& lhs, const vec2& rhs );
 /// @brief calculate square magnitude of given vector
 /// @param v vector
 /// @return square magnitude
@@ -897,7 +833,7 @@ vec2 normalize( const vec2& v );
 /// @brief calculate dot product between two vectors
 /// @param lhs,rhs vectors
 /// @return dot product
-f32 dot( const vec2& lhs, const vec2& rhs );
+SMATH_CONSTEXPR f32 dot( const vec2& lhs, const vec2& rhs );
 /// @brief calculate signed angle between two vectors
 /// @param a,b vectors
 /// @return signed angle in radians
@@ -911,7 +847,7 @@ f32 unsigned_angle( const vec2& a, const vec2& b );
 /// @param b maximum value
 /// @param t fraction
 /// @return result
-vec2 lerp( const vec2& a, const vec2& b, f32 t );
+SMATH_CONSTEXPR vec2 lerp( const vec2& a, const vec2& b, f32 t );
 /// @brief linear interpolation. blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
@@ -1204,11 +1140,11 @@ struct vec3 {
     /// @brief create vec3 from components
     /// @param x,y,z components
     /// @return vec3
-    static vec3 create( f32 x, f32 y, f32 z );
+    static SMATH_CONSTEXPR vec3 create( f32 x, f32 y, f32 z );
     /// @brief create vec3 with all components set to the same value
     /// @param scalar component value
     /// @return vec3
-    static vec3 create( f32 scalar );
+    static SMATH_CONSTEXPR vec3 create( f32 scalar );
     /// @brief create vec3 from vec2
     /// @param v vec2
     /// @return vec3
@@ -1286,37 +1222,37 @@ struct vec3 {
     /// @brief compare vectors for inequality
     bool32 operator!=( const vec3& rhs ) const;
     /// @brief add vectors
-    vec3& operator+=( const vec3& rhs );
+    SMATH_CONSTEXPR vec3& operator+=( const vec3& rhs );
     /// @brief subtract vectors
-    vec3& operator-=( const vec3& rhs );
+    SMATH_CONSTEXPR vec3& operator-=( const vec3& rhs );
     /// @brief scale vector
-    vec3& operator*=( f32 rhs );
+    SMATH_CONSTEXPR vec3& operator*=( f32 rhs );
     /// @brief divide vector
-    vec3& operator/=( f32 rhs );
+    SMATH_CONSTEXPR vec3& operator/=( f32 rhs );
 };
 /// @brief add vectors
 /// @param lhs,rhs operands
 /// @return result
-vec3 operator+( const vec3& lhs, const vec3& rhs );
+SMATH_CONSTEXPR vec3 operator+( const vec3& lhs, const vec3& rhs );
 /// @brief subtract vectors
 /// @param lhs,rhs operands
 /// @return result
-vec3 operator-( const vec3& lhs, const vec3& rhs );
+SMATH_CONSTEXPR vec3 operator-( const vec3& lhs, const vec3& rhs );
 /// @brief scale vector
 /// @param lhs vector to scale
 /// @param rhs scalar
 /// @return result
-vec3 operator*( const vec3& lhs, f32 rhs );
+SMATH_CONSTEXPR vec3 operator*( const vec3& lhs, f32 rhs );
 /// @brief scale vector
 /// @param lhs scalar
 /// @param rhs vector to scale
 /// @return result
-vec3 operator*( f32 lhs, const vec3& rhs );
+SMATH_CONSTEXPR vec3 operator*( f32 lhs, const vec3& rhs );
 /// @brief divide vector
 /// @param lhs vector to divide
 /// @param rhs scalar
 /// @return result
-vec3 operator/( const vec3& lhs, f32 rhs );
+SMATH_CONSTEXPR vec3 operator/( const vec3& lhs, f32 rhs );
 /// @brief compare two vectors
 /// @param a,b vectors to compare
 /// @return true if they are approximately equal
@@ -1324,7 +1260,7 @@ bool32 cmp( const vec3& a, const vec3& b );
 /// @brief calculate cross product of two vectors
 /// @param lhs,rhs vectors
 /// @return cross product
-vec3 cross( const vec3& lhs, const vec3& rhs );
+SMATH_CONSTEXPR vec3 cross( const vec3& lhs, const vec3& rhs );
 /// @brief normalize given vector
 /// @param v vector to normalize
 /// @return normalized vector
@@ -1332,7 +1268,7 @@ vec3 normalize( const vec3& v );
 /// @brief calculate dot product of two vectors
 /// @param lhs,rhs vectors
 /// @return dot product
-f32 dot( const vec3& lhs, const vec3& rhs );
+SMATH_CONSTEXPR f32 dot( const vec3& lhs, const vec3& rhs );
 /// @brief shift components of vector to the left
 /// @param v vector to shift
 void shift_left( vec3& v );
@@ -1342,7 +1278,7 @@ void shift_right( vec3& v );
 /// @brief horizontal addition
 /// @param v vector to sum
 /// @return sum of all components of given vector
-f32 horizontal_add( const vec3& v );
+SMATH_CONSTEXPR f32 horizontal_add( const vec3& v );
 /// @brief horizontal multiplication
 /// @param v vector to multiply
 /// @return product of all components of given vector
@@ -1350,7 +1286,7 @@ f32 horizontal_mul( const vec3& v );
 /// @brief component-wise multiply two vectors
 /// @param lhs,rhs vectors to multiply
 /// @return result of multiplication
-vec3 hadamard( const vec3& lhs, const vec3& rhs );
+SMATH_CONSTEXPR vec3 hadamard( const vec3& lhs, const vec3& rhs );
 /// @brief calculate square magnitude of given vector
 /// @param v vector
 /// @return square magnitude
@@ -1377,7 +1313,7 @@ f32 unsigned_angle( const vec3& a, const vec3& b );
 /// @param b maximum value
 /// @param t fraction
 /// @return result
-vec3 lerp( const vec3& a, const vec3& b, f32 t );
+SMATH_CONSTEXPR vec3 lerp( const vec3& a, const vec3& b, f32 t );
 /// @brief linear interpolation. blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
@@ -1717,11 +1653,11 @@ struct vec4 {
     /// @brief create vec4 from components
     /// @param x,y,z,w components
     /// @return vec4
-    static vec4 create( f32 x, f32 y, f32 z, f32 w );
+    static SMATH_CONSTEXPR vec4 create( f32 x, f32 y, f32 z, f32 w );
     /// @brief create vec4 with all components set to the same value
     /// @param scalar component value
     /// @return vec4
-    static vec4 create( f32 scalar );
+    static SMATH_CONSTEXPR vec4 create( f32 scalar );
     /// @brief create vec4 from vec2
     /// @param v vec2
     /// @return vec4
@@ -1782,37 +1718,37 @@ struct vec4 {
     /// @brief compare vectors for inequality
     bool32 operator!=( const vec4& rhs ) const;
     /// @brief add vectors
-    vec4& operator+=( const vec4& rhs );
+    SMATH_CONSTEXPR vec4& operator+=( const vec4& rhs );
     /// @brief subtract vectors
-    vec4& operator-=( const vec4& rhs );
+    SMATH_CONSTEXPR vec4& operator-=( const vec4& rhs );
     /// @brief scale vector
-    vec4& operator*=( f32 rhs );
+    SMATH_CONSTEXPR vec4& operator*=( f32 rhs );
     /// @brief divide vector
-    vec4& operator/=( f32 rhs );
+    SMATH_CONSTEXPR vec4& operator/=( f32 rhs );
 };
 /// @brief add vectors
 /// @param lhs,rhs operands
 /// @return result
-vec4 operator+( const vec4& lhs, const vec4& rhs );
+SMATH_CONSTEXPR vec4 operator+( const vec4& lhs, const vec4& rhs );
 /// @brief subtract vectors
 /// @param lhs,rhs operands
 /// @return result
-vec4 operator-( const vec4& lhs, const vec4& rhs );
+SMATH_CONSTEXPR vec4 operator-( const vec4& lhs, const vec4& rhs );
 /// @brief scale vector
 /// @param lhs vector to scale
 /// @param rhs scalar
 /// @return result
-vec4 operator*( const vec4& lhs, f32 rhs );
+SMATH_CONSTEXPR vec4 operator*( const vec4& lhs, f32 rhs );
 /// @brief scale vector
 /// @param lhs scalar
 /// @param rhs vector to scale
 /// @return result
-vec4 operator*( f32 lhs, const vec4& rhs );
+SMATH_CONSTEXPR vec4 operator*( f32 lhs, const vec4& rhs );
 /// @brief divide vector
 /// @param lhs vector to divide
 /// @param rhs scalar
 /// @return result
-vec4 operator/( const vec4& lhs, f32 rhs );
+SMATH_CONSTEXPR vec4 operator/( const vec4& lhs, f32 rhs );
 /// @brief convert linear RGBA to sRGBA. Alpha is unaffected.
 /// @param linear linear RGBA
 /// @return sRGBA
@@ -1830,7 +1766,7 @@ void shift_right( vec4& v );
 /// @brief horizontal addition
 /// @param v vector to sum
 /// @return sum of all components of given vector
-f32 horizontal_add( const vec4& v );
+SMATH_CONSTEXPR f32 horizontal_add( const vec4& v );
 /// @brief horizontal multiplication
 /// @param v vector to multiply
 /// @return product of all components of given vector
@@ -1838,7 +1774,7 @@ f32 horizontal_mul( const vec4& v );
 /// @brief component-wise multiply two vectors
 /// @param lhs,rhs vectors to multiply
 /// @return result of multiplication
-vec4 hadamard( const vec4& lhs, const vec4& rhs );
+SMATH_CONSTEXPR vec4 hadamard( const vec4& lhs, const vec4& rhs );
 /// @brief calculate square magnitude of given vector
 /// @param v vector
 /// @return square magnitude
@@ -1860,7 +1796,7 @@ f32 dot( const vec4& lhs, const vec4& rhs );
 /// @param b maximum value
 /// @param t fraction
 /// @return result
-vec4 lerp( const vec4& a, const vec4& b, f32 t );
+SMATH_CONSTEXPR vec4 lerp( const vec4& a, const vec4& b, f32 t );
 /// @brief linear interpolation. blend between a and b, based on fraction t.
 /// @param a minimum value
 /// @param b maximum value
@@ -2562,6 +2498,10 @@ struct mat4 {
     /// @param m 3x3 matrix
     /// @return 4x4 matrix
     static mat4 create( const mat3& m );
+    /// @brief create 4x4 matrix from 3x4 affine matrix
+    /// @param m 3x4 affine matrix
+    /// @return 4x4 matrix with 0, 0, 0, 1 as the last row
+    static mat4 create( const mat3x4& m );
     /// @brief create new look at matrix
     /// @param position position of camera
     /// @param target camera target
@@ -2817,6 +2757,16 @@ bool32 inverse( const mat4& m, mat4& result );
 /// @param m matrix to invert
 /// @return inverted matrix
 mat4 inverse_unchecked( const mat4& m );
+/// @brief invert affine matrix (last row is 0, 0, 0, 1) such as a translation, rotation, scale transform.
+/// faster than inverse, matrix must be invertible
+/// @param m affine matrix to invert
+/// @return inverted matrix
+mat4 inverse_affine( const mat4& m );
+/// @brief invert rigid matrix (translation and rotation only, no scale).
+/// faster than inverse_affine
+/// @param m rigid matrix to invert
+/// @return inverted matrix
+mat4 inverse_rigid( const mat4& m );
 /// @brief calculate the normal matrix of transform, if possible
 /// @param transform matrix
 /// @param result result
@@ -2826,6 +2776,952 @@ bool32 normal_matrix( const mat4& transform, mat3& result );
 /// @param transform matrix
 /// @return normal matrix
 mat3 normal_matrix_unchecked( const mat4& transform );
+/// @brief multiply pairs of matrices, out[i] = lhs[i] * rhs[i]
+/// @param lhs left hand matrices
+/// @param rhs right hand matrices
+/// @param out products, can be the same array as lhs or rhs
+/// @param count number of pairs
+void mat4_mul_n( const mat4* lhs, const mat4* rhs, mat4* out, usize count );
+/// @brief propagate transform hierarchy, worlds[i] = worlds[parents[i]] * locals[i].
+/// nodes must be topologically sorted (parents[i] < i), roots have a negative parent and worlds[i] = locals[i]
+/// @param parents parent index of each node
+/// @param locals local transforms
+/// @param worlds world transforms
+/// @param count number of nodes
+void mat4_mul_hierarchy( const i32* parents, const mat4* locals, mat4* worlds, usize count );
+/// @brief propagate a range of a transform hierarchy, see mat4_mul_hierarchy.
+/// world transforms of parents outside of the range must already be calculated
+/// @param parents parent index of each node
+/// @param locals local transforms
+/// @param worlds world transforms
+/// @param first first node in range
+/// @param count number of nodes in range
+void mat4_mul_hierarchy_range(
+    const i32* parents, const mat4* locals, mat4* worlds, usize first, usize count );
+/// @brief split transform hierarchy into ranges of whole top-level subtrees.
+/// ranges don't depend on each other so each one can be given to
+/// mat4_mul_hierarchy_range on a different thread.
+/// nodes must be in depth-first order so that subtrees are contiguous
+/// @param parents parent index of each node
+/// @param count number of nodes
+/// @param max_ranges maximum number of ranges
+/// @param out_range_starts array that can hold max_ranges + 1 values, range i is
+/// [ out_range_starts[i], out_range_starts[i + 1] )
+/// @return number of ranges
+usize mat4_hierarchy_split(
+    const i32* parents, usize count, usize max_ranges, usize* out_range_starts );
+/// @brief transform points by matrix, w is treated as 1
+/// @param m transform matrix
+/// @param in points to transform
+/// @param out transformed points, can be the same array as in
+/// @param count number of points
+void transform_points( const mat4& m, const vec3* in, vec3* out, usize count );
+/// @brief transform points by matrix and divide by resulting w,
+/// use with projection matrices to go from clip space to normalized device coordinates
+/// @param m transform matrix
+/// @param in points to transform
+/// @param out projected points, can be the same array as in
+/// @param count number of points
+void transform_points_perspective( const mat4& m, const vec3* in, vec3* out, usize count );
+/// @brief transform directions by matrix, w is treated as 0 so translation is ignored
+/// @param m transform matrix
+/// @param in directions to transform
+/// @param out transformed directions, can be the same array as in
+/// @param count number of directions
+void transform_directions( const mat4& m, const vec3* in, vec3* out, usize count );
+/// @brief transform 4-component vectors by matrix
+/// @param m transform matrix
+/// @param in vectors to transform
+/// @param out transformed vectors, can be the same array as in
+/// @param count number of vectors
+void transform_vec4( const mat4& m, const vec4* in, vec4* out, usize count );
+
+/// @brief 3x4 affine matrix, row-major.
+/// each row holds one row of the 3x3 linear part in xyz and the translation in w,
+/// the projective row is always 0, 0, 0, 1 and isn't stored
+struct mat3x4 {
+    union {
+        struct { f32 _m00, _m01, _m02, _m03; };
+        vec4 _row0;
+    };
+    union {
+        struct { f32 _m10, _m11, _m12, _m13; };
+        vec4 _row1;
+    };
+    union {
+        struct { f32 _m20, _m21, _m22, _m23; };
+        vec4 _row2;
+    };
+
+    /// @brief create matrix from cells
+    /// @param m00,m01,m02,m03 row 0
+    /// @param m10,m11,m12,m13 row 1
+    /// @param m20,m21,m22,m23 row 2
+    /// @return matrix
+    static mat3x4 create(
+        f32 m00, f32 m01, f32 m02, f32 m03,
+        f32 m10, f32 m11, f32 m12, f32 m13,
+        f32 m20, f32 m21, f32 m22, f32 m23
+    );
+    /// @brief create 3x4 affine matrix from 4x4 matrix, last row is dropped
+    /// @param m 4x4 matrix
+    /// @return 3x4 affine matrix
+    static mat3x4 create( const mat4& m );
+    /// @brief create new transform matrix directly from components
+    /// @param translation coordinates
+    /// @param rotation quaternion rotation
+    /// @param scale scale
+    /// @return transform matrix, same as mat4::transform
+    static mat3x4 transform(
+        const vec3& translation,
+        const quat& rotation,
+        const vec3& scale
+    );
+    /// @return identity matrix
+    static mat3x4 identity() {
+        return {
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f
+        };
+    }
+
+    // get pointer to matrix as f32
+    f32* ptr();
+    // get pointer to matrix as f32
+    const f32* ptr() const;
+    /// @brief index into matrix, row-major
+    f32& operator[]( u32 index );
+    /// @brief index into matrix, row-major
+    f32 operator[]( u32 index ) const;
+
+    /// @brief compose affine matrices
+    mat3x4& operator*=( const mat3x4& rhs );
+};
+/// @brief compose affine matrices
+/// @param lhs,rhs operands
+/// @return result, applies rhs first then lhs
+mat3x4 operator*( const mat3x4& lhs, const mat3x4& rhs );
+/// @brief transform point by affine matrix
+/// @param lhs matrix
+/// @param rhs point
+/// @return transformed point
+vec3 operator*( const mat3x4& lhs, const vec3& rhs );
+/// @brief transform direction by affine matrix, translation is ignored
+/// @param m matrix
+/// @param direction direction
+/// @return transformed direction
+vec3 transform_direction( const mat3x4& m, const vec3& direction );
+/// @brief translation of affine matrix
+/// @param m matrix
+/// @return translation
+vec3 translation( const mat3x4& m );
+/// @brief invert affine matrix, if possible
+/// @param m matrix to invert
+/// @param result inverted matrix
+/// @return true if successful
+bool32 inverse( const mat3x4& m, mat3x4& result );
+/// @brief invert affine matrix, even if determinant is 0
+/// @param m matrix to invert
+/// @return inverted matrix
+mat3x4 inverse_unchecked( const mat3x4& m );
+/// @brief transform points by affine matrix
+/// @param m transform matrix
+/// @param in points to transform
+/// @param out transformed points, can be the same array as in
+/// @param count number of points
+void transform_points( const mat3x4& m, const vec3* in, vec3* out, usize count );
+
+/// @brief translation, rotation and scale transform.
+/// applies scale, then rotation, then translation
+struct transform {
+    quat rotation;
+    vec3 translation;
+    vec3 scale;
+
+    /// @brief create transform from components
+    /// @param translation coordinates
+    /// @param rotation quaternion rotation
+    /// @param scale scale
+    /// @return transform
+    static transform create(
+        const vec3& translation,
+        const quat& rotation,
+        const vec3& scale
+    );
+    /// @return identity transform
+    static transform identity() {
+        return { quat::identity(), vec3::zero(), vec3::one() };
+    }
+};
+/// @brief compose transforms.
+/// exact when parent scale is uniform, otherwise scale is combined per axis
+/// and shear is discarded
+/// @param parent transform applied last
+/// @param child transform applied first
+/// @return composed transform
+transform compose( const transform& parent, const transform& child );
+/// @brief compose transforms
+/// @param lhs,rhs operands
+/// @return result, applies rhs first then lhs
+transform operator*( const transform& lhs, const transform& rhs );
+/// @brief transform point
+/// @param lhs transform
+/// @param rhs point
+/// @return transformed point
+vec3 operator*( const transform& lhs, const vec3& rhs );
+/// @brief calculate inverse of transform.
+/// exact when scale is uniform
+/// @param t transform
+/// @return inverse transform
+transform inverse( const transform& t );
+/// @brief normalized linear interpolation. blend between a and b, based on fraction t.
+/// rotation takes the shortest path
+/// @param a minimum value
+/// @param b maximum value
+/// @param t fraction
+/// @return result
+transform nlerp( const transform& a, const transform& b, f32 t );
+/// @brief weighted blend of transforms.
+/// rotations are flipped into the hemisphere of the first rotation before summing
+/// @param transforms transforms to blend
+/// @param weights weight for each transform, should add up to 1
+/// @param count number of transforms
+/// @return blended transform, identity if count is 0
+transform blend( const transform* transforms, const f32* weights, usize count );
+/// @brief convert transform to affine matrix
+/// @param t transform
+/// @return affine matrix
+mat3x4 transform_to_mat3x4( const transform& t );
+/// @brief convert transform to 4x4 matrix
+/// @param t transform
+/// @return 4x4 matrix
+mat4 transform_to_mat4( const transform& t );
+/// @brief transform points
+/// @param t transform
+/// @param in points to transform
+/// @param out transformed points, can be the same array as in
+/// @param count number of points
+void apply_to_points( const transform& t, const vec3* in, vec3* out, usize count );
+
+/// @brief dual quaternion, rigid transform made of rotation and translation
+struct dual_quat {
+    quat real;
+    quat dual;
+
+    /// @brief create dual quaternion from rotation and translation
+    /// @param rotation normalized quaternion rotation
+    /// @param translation coordinates
+    /// @return dual quaternion
+    static dual_quat create( const quat& rotation, const vec3& translation );
+    /// @brief create dual quaternion from transform, scale is discarded
+    /// @param t transform
+    /// @return dual quaternion
+    static dual_quat create( const transform& t );
+    /// @return identity dual quaternion
+    static dual_quat identity() {
+        return { quat::identity(), { 0.0f, 0.0f, 0.0f, 0.0f } };
+    }
+};
+/// @brief compose dual quaternions
+/// @param lhs,rhs operands
+/// @return result, applies rhs first then lhs
+dual_quat operator*( const dual_quat& lhs, const dual_quat& rhs );
+/// @brief compose dual quaternions
+/// @param parent transform applied last
+/// @param child transform applied first
+/// @return composed dual quaternion
+dual_quat compose( const dual_quat& parent, const dual_quat& child );
+/// @brief transform point by unit dual quaternion
+/// @param lhs dual quaternion
+/// @param rhs point
+/// @return transformed point
+vec3 operator*( const dual_quat& lhs, const vec3& rhs );
+/// @brief normalize dual quaternion
+/// @param dq dual quaternion
+/// @return unit dual quaternion
+dual_quat normalize( const dual_quat& dq );
+/// @brief calculate inverse of unit dual quaternion
+/// @param dq unit dual quaternion
+/// @return inverse
+dual_quat inverse( const dual_quat& dq );
+/// @brief extract translation from unit dual quaternion
+/// @param dq unit dual quaternion
+/// @return translation
+vec3 translation( const dual_quat& dq );
+/// @brief normalized linear interpolation. blend between a and b, based on fraction t.
+/// @param a minimum value
+/// @param b maximum value
+/// @param t fraction
+/// @return result
+dual_quat nlerp( const dual_quat& a, const dual_quat& b, f32 t );
+/// @brief dual quaternion linear blending.
+/// inputs are flipped into the hemisphere of the first input before summing
+/// @param dqs unit dual quaternions to blend
+/// @param weights weight for each dual quaternion
+/// @param count number of dual quaternions
+/// @return normalized blend, identity if count is 0
+dual_quat blend( const dual_quat* dqs, const f32* weights, usize count );
+/// @brief convert unit dual quaternion to affine matrix
+/// @param dq unit dual quaternion
+/// @return affine matrix
+mat3x4 dual_quat_to_mat3x4( const dual_quat& dq );
+/// @brief transform points by unit dual quaternion
+/// @param dq unit dual quaternion
+/// @param in points to transform
+/// @param out transformed points, can be the same array as in
+/// @param count number of points
+void apply_to_points( const dual_quat& dq, const vec3* in, vec3* out, usize count );
+
+/// @brief structure of arrays of 3-component vectors.
+/// each component array is 32-byte aligned and padded to a multiple of 8
+/// so batch functions can run on full eight-wide lanes
+struct vec3_soa {
+    /// @brief x components
+    f32* x;
+    /// @brief y components
+    f32* y;
+    /// @brief z components
+    f32* z;
+    /// @brief number of vectors in use
+    usize count;
+    /// @brief number of vectors each component array can hold
+    usize capacity;
+};
+/// @brief structure of arrays of 4-component vectors.
+/// each component array is 32-byte aligned and padded to a multiple of 8
+/// so batch functions can run on full eight-wide lanes
+struct vec4_soa {
+    /// @brief x components
+    f32* x;
+    /// @brief y components
+    f32* y;
+    /// @brief z components
+    f32* z;
+    /// @brief w components
+    f32* w;
+    /// @brief number of vectors in use
+    usize count;
+    /// @brief number of vectors each component array can hold
+    usize capacity;
+};
+/// @brief structure of arrays of quaternions.
+/// each component array is 32-byte aligned and padded to a multiple of 8
+/// so batch functions can run on full eight-wide lanes
+struct quat_soa {
+    /// @brief w components
+    f32* w;
+    /// @brief x components
+    f32* x;
+    /// @brief y components
+    f32* y;
+    /// @brief z components
+    f32* z;
+    /// @brief number of quaternions in use
+    usize count;
+    /// @brief number of quaternions each component array can hold
+    usize capacity;
+};
+
+/// @brief allocate soa with smcol allocator, components are zeroed
+/// @param count number of vectors
+/// @param out_result soa
+/// @return true if successful
+bool32 soa_create( usize count, vec3_soa* out_result );
+/// @brief allocate soa with smcol allocator, components are zeroed
+/// @param count number of vectors
+/// @param out_result soa
+/// @return true if successful
+bool32 soa_create( usize count, vec4_soa* out_result );
+/// @brief allocate soa with smcol allocator, components are zeroed
+/// @param count number of quaternions
+/// @param out_result soa
+/// @return true if successful
+bool32 soa_create( usize count, quat_soa* out_result );
+/// @brief free soa buffers
+/// @param soa soa to free
+void soa_free( vec3_soa* soa );
+/// @brief free soa buffers
+/// @param soa soa to free
+void soa_free( vec4_soa* soa );
+/// @brief free soa buffers
+/// @param soa soa to free
+void soa_free( quat_soa* soa );
+/// @brief get vector at index
+/// @param soa soa
+/// @param index index of vector
+/// @return vector
+vec3 soa_get( const vec3_soa& soa, usize index );
+/// @brief get vector at index
+/// @param soa soa
+/// @param index index of vector
+/// @return vector
+vec4 soa_get( const vec4_soa& soa, usize index );
+/// @brief get quaternion at index
+/// @param soa soa
+/// @param index index of quaternion
+/// @return quaternion
+quat soa_get( const quat_soa& soa, usize index );
+/// @brief set vector at index
+/// @param soa soa
+/// @param index index of vector
+/// @param v vector
+void soa_set( vec3_soa& soa, usize index, const vec3& v );
+/// @brief set vector at index
+/// @param soa soa
+/// @param index index of vector
+/// @param v vector
+void soa_set( vec4_soa& soa, usize index, const vec4& v );
+/// @brief set quaternion at index
+/// @param soa soa
+/// @param index index of quaternion
+/// @param q quaternion
+void soa_set( quat_soa& soa, usize index, const quat& q );
+/// @brief convert array of vectors to soa
+/// @param aos array of vectors
+/// @param count number of vectors, must not be greater than soa capacity
+/// @param out_result soa, count is set to count
+void aos_to_soa( const vec3* aos, usize count, vec3_soa& out_result );
+/// @brief convert array of vectors to soa
+/// @param aos array of vectors
+/// @param count number of vectors, must not be greater than soa capacity
+/// @param out_result soa, count is set to count
+void aos_to_soa( const vec4* aos, usize count, vec4_soa& out_result );
+/// @brief convert array of quaternions to soa
+/// @param aos array of quaternions
+/// @param count number of quaternions, must not be greater than soa capacity
+/// @param out_result soa, count is set to count
+void aos_to_soa( const quat* aos, usize count, quat_soa& out_result );
+/// @brief convert soa to array of vectors
+/// @param soa soa
+/// @param out_aos array that can hold soa.count vectors
+void soa_to_aos( const vec3_soa& soa, vec3* out_aos );
+/// @brief convert soa to array of vectors
+/// @param soa soa
+/// @param out_aos array that can hold soa.count vectors
+void soa_to_aos( const vec4_soa& soa, vec4* out_aos );
+/// @brief convert soa to array of quaternions
+/// @param soa soa
+/// @param out_aos array that can hold soa.count quaternions
+void soa_to_aos( const quat_soa& soa, quat* out_aos );
+
+/// @brief normalize every vector, vectors with magnitude close to zero become zero
+/// @param v vectors
+/// @param out_result normalized vectors, capacity must be at least v.count, can be v
+void normalize_n( const vec3_soa& v, vec3_soa& out_result );
+/// @brief normalize every vector, vectors with magnitude close to zero become zero
+/// @param v vectors
+/// @param out_result normalized vectors, capacity must be at least v.count, can be v
+void normalize_n( const vec4_soa& v, vec4_soa& out_result );
+/// @brief calculate dot product of every pair of vectors
+/// @param lhs,rhs vectors, must have the same count
+/// @param out_result array that can hold lhs.count floats
+void dot_n( const vec3_soa& lhs, const vec3_soa& rhs, f32* out_result );
+/// @brief calculate dot product of every pair of vectors
+/// @param lhs,rhs vectors, must have the same count
+/// @param out_result array that can hold lhs.count floats
+void dot_n( const vec4_soa& lhs, const vec4_soa& rhs, f32* out_result );
+/// @brief calculate cross product of every pair of vectors
+/// @param lhs,rhs vectors, must have the same count
+/// @param out_result cross products, capacity must be at least lhs.count, can be lhs or rhs
+void cross_n( const vec3_soa& lhs, const vec3_soa& rhs, vec3_soa& out_result );
+/// @brief linearly interpolate every pair of vectors
+/// @param a,b vectors, must have the same count
+/// @param t fraction
+/// @param out_result interpolated vectors, capacity must be at least a.count, can be a or b
+void lerp_n( const vec3_soa& a, const vec3_soa& b, f32 t, vec3_soa& out_result );
+/// @brief linearly interpolate every pair of vectors
+/// @param a,b vectors, must have the same count
+/// @param t fraction
+/// @param out_result interpolated vectors, capacity must be at least a.count, can be a or b
+void lerp_n( const vec4_soa& a, const vec4_soa& b, f32 t, vec4_soa& out_result );
+/// @brief calculate magnitude of every vector
+/// @param v vectors
+/// @param out_result array that can hold v.count floats
+void mag_n( const vec3_soa& v, f32* out_result );
+/// @brief calculate magnitude of every vector
+/// @param v vectors
+/// @param out_result array that can hold v.count floats
+void mag_n( const vec4_soa& v, f32* out_result );
+/// @brief spherical linear interpolation of every pair of unit quaternions,
+/// takes the shortest path. uses lane-wide acos/sin approximations
+/// @param a,b quaternions, must have the same count
+/// @param t fraction
+/// @param out_result interpolated quaternions, capacity must be at least a.count, can be a or b
+void slerp_n( const quat_soa& a, const quat_soa& b, f32 t, quat_soa& out_result );
+/// @brief spherical linear interpolation of every pair of unit quaternions,
+/// takes the shortest path. uses lane-wide acos/sin approximations
+/// @param a,b quaternions, must have the same count
+/// @param t fraction for each pair, array of a.count floats
+/// @param out_result interpolated quaternions, capacity must be at least a.count, can be a or b
+void slerp_n( const quat_soa& a, const quat_soa& b, const f32* t, quat_soa& out_result );
+/// @brief normalized linear interpolation of every pair of quaternions, takes the shortest path
+/// @param a,b quaternions, must have the same count
+/// @param t fraction
+/// @param out_result interpolated quaternions, capacity must be at least a.count, can be a or b
+void nlerp_n( const quat_soa& a, const quat_soa& b, f32 t, quat_soa& out_result );
+/// @brief normalized linear interpolation of every pair of quaternions, takes the shortest path
+/// @param a,b quaternions, must have the same count
+/// @param t fraction for each pair, array of a.count floats
+/// @param out_result interpolated quaternions, capacity must be at least a.count, can be a or b
+void nlerp_n( const quat_soa& a, const quat_soa& b, const f32* t, quat_soa& out_result );
+/// @brief normalized linear interpolation with t corrected towards constant angular velocity.
+/// costs about the same as nlerp_n, rotation angle error vs slerp is under 1.5e-3 radians
+/// @param a,b unit quaternions, must have the same count
+/// @param t fraction
+/// @param out_result interpolated quaternions, capacity must be at least a.count, can be a or b
+void nlerp_corrected_n( const quat_soa& a, const quat_soa& b, f32 t, quat_soa& out_result );
+/// @brief normalized linear interpolation with t corrected towards constant angular velocity.
+/// costs about the same as nlerp_n, rotation angle error vs slerp is under 1.5e-3 radians
+/// @param a,b unit quaternions, must have the same count
+/// @param t fraction for each pair, array of a.count floats
+/// @param out_result interpolated quaternions, capacity must be at least a.count, can be a or b
+void nlerp_corrected_n( const quat_soa& a, const quat_soa& b, const f32* t, quat_soa& out_result );
+
+/// @brief how curve values are interpolated between keys
+enum curve_interp : u32 {
+    /// @brief straight line between key values, tangents are ignored
+    CURVE_INTERP_LINEAR,
+    /// @brief cubic hermite spline, tangents are slopes in value per unit of time
+    CURVE_INTERP_HERMITE,
+    /// @brief cubic bezier, tangents are values of the control points
+    /// placed a third of the way into the segment on either side of the key
+    CURVE_INTERP_BEZIER,
+};
+/// @brief curve keyframe
+struct curve_key {
+    /// @brief time of key
+    f32 time;
+    /// @brief value at time
+    f32 value;
+    /// @brief tangent of segment ending at this key
+    f32 in_tangent;
+    /// @brief tangent of segment starting at this key
+    f32 out_tangent;
+};
+/// @brief keyframed curve.
+/// keys are kept sorted by time in a list_t of curve_key,
+/// sampling remembers the last segment so monotonic playback skips the search
+struct curve {
+    /// @brief list of curve_key sorted by time
+    list_t keys;
+    /// @brief interpolation between keys
+    curve_interp interp;
+    /// @brief index of key that starts the last sampled segment
+    usize segment;
+};
+/// @brief create empty curve
+/// @param interp interpolation between keys
+/// @param capacity number of keys to allocate up front, can be 0
+/// @param out_result curve
+/// @return true if successful
+bool32 curve_create( curve_interp interp, usize capacity, curve* out_result );
+/// @brief create curve from array of keys, keys don't need to be sorted
+/// @param interp interpolation between keys
+/// @param keys keys to copy
+/// @param count number of keys
+/// @param out_result curve
+/// @return true if successful
+bool32 curve_create( curve_interp interp, const curve_key* keys, usize count, curve* out_result );
+/// @brief free curve keys
+/// @param c curve to free
+void curve_free( curve* c );
+/// @brief insert key, keeping keys sorted by time.
+/// appending in time order doesn't move any keys
+/// @param c curve
+/// @param key key to insert
+/// @return true if successful, false if keys couldn't be reallocated
+bool32 curve_push_key( curve& c, const curve_key& key );
+/// @brief evaluate curve at given time, time is clamped to the first and last key.
+/// checks the cached segment and the one after it before falling back to binary search
+/// @param c curve, cached segment is updated
+/// @param time time to sample
+/// @return value, 0 if curve has no keys
+f32 sample( curve& c, f32 time );
+/// @brief evaluate many curves at the same time
+/// @param curves curves to sample, cached segments are updated
+/// @param count number of curves
+/// @param time time to sample
+/// @param out_result array that can hold count floats
+void sample_n( curve* curves, usize count, f32 time, f32* out_result );
+
+/// @brief axis-aligned bounding box
+struct aabb {
+    /// @brief minimum corner
+    vec3 min;
+    /// @brief maximum corner
+    vec3 max;
+
+    /// @brief create bounding box from corners
+    /// @param min minimum corner
+    /// @param max maximum corner
+    /// @return bounding box
+    static aabb create( const vec3& min, const vec3& max );
+    /// @brief create bounding box from center and half extents
+    /// @param center center of box
+    /// @param extents half size of box on each axis
+    /// @return bounding box
+    static aabb from_center_extents( const vec3& center, const vec3& extents );
+};
+/// @brief center of bounding box
+/// @param box bounding box
+/// @return center
+vec3 center( const aabb& box );
+/// @brief half size of bounding box
+/// @param box bounding box
+/// @return half extents
+vec3 extents( const aabb& box );
+/// @brief smallest bounding box that contains both boxes
+/// @param a,b bounding boxes
+/// @return merged bounding box
+aabb merge( const aabb& a, const aabb& b );
+/// @brief check if point is inside bounding box, inclusive
+/// @param box bounding box
+/// @param point point
+/// @return true if point is inside
+bool32 contains( const aabb& box, const vec3& point );
+/// @brief check if two bounding boxes overlap, touching counts
+/// @param a,b bounding boxes
+/// @return true if they overlap
+bool32 overlaps( const aabb& a, const aabb& b );
+
+/// @brief bounding sphere
+struct sphere {
+    /// @brief center of sphere
+    vec3 center;
+    /// @brief radius of sphere
+    f32 radius;
+
+    /// @brief create sphere
+    /// @param center center of sphere
+    /// @param radius radius of sphere
+    /// @return sphere
+    static sphere create( const vec3& center, f32 radius );
+};
+/// @brief check if point is inside sphere, inclusive
+/// @param s sphere
+/// @param point point
+/// @return true if point is inside
+bool32 contains( const sphere& s, const vec3& point );
+/// @brief check if two spheres overlap, touching counts
+/// @param a,b spheres
+/// @return true if they overlap
+bool32 overlaps( const sphere& a, const sphere& b );
+/// @brief check if bounding box and sphere overlap, touching counts
+/// @param box bounding box
+/// @param s sphere
+/// @return true if they overlap
+bool32 overlaps( const aabb& box, const sphere& s );
+
+/// @brief view frustum as six inward facing planes.
+/// each plane is normal in xyz and distance in w, points with
+/// dot( normal, point ) + w >= 0 are on the inside
+struct frustum {
+    /// @brief left, right, bottom, top, near, far planes
+    vec4 planes[6];
+
+    /// @brief extract frustum planes from view-projection matrix,
+    /// expects -1 to 1 clip space depth like mat4::perspective
+    /// @param view_projection projection * view matrix
+    /// @return frustum with normalized planes
+    static frustum create( const mat4& view_projection );
+};
+/// @brief check if sphere is at least partially inside frustum
+/// @param f frustum
+/// @param s sphere
+/// @return true if visible
+bool32 intersects( const frustum& f, const sphere& s );
+/// @brief check if bounding box is at least partially inside frustum.
+/// conservative, boxes near frustum corners can pass while outside
+/// @param f frustum
+/// @param box bounding box
+/// @return true if visible
+bool32 intersects( const frustum& f, const aabb& box );
+/// @brief cull spheres against frustum
+/// @param f frustum
+/// @param centers centers of spheres
+/// @param radii radius of each sphere, array of centers.count floats
+/// @param out_visible list of u32, receives indices of visible spheres in ascending order.
+/// existing items are cleared, can be a zeroed list_t
+/// @return true if successful, false if list couldn't be allocated
+bool32 cull_spheres(
+    const frustum& f, const vec3_soa& centers,
+    const f32* radii, list_t* out_visible );
+/// @brief cull bounding boxes against frustum, same test as intersects( frustum, aabb )
+/// @param f frustum
+/// @param centers centers of boxes
+/// @param extents half extents of boxes, same count as centers
+/// @param out_visible list of u32, receives indices of visible boxes in ascending order.
+/// existing items are cleared, can be a zeroed list_t
+/// @return true if successful, false if list couldn't be allocated
+bool32 cull_aabbs(
+    const frustum& f, const vec3_soa& centers,
+    const vec3_soa& extents, list_t* out_visible );
+
+/// @brief ray with origin and direction
+struct ray {
+    /// @brief start of ray
+    vec3 origin;
+    /// @brief direction of ray, distances are measured in multiples of its length
+    vec3 direction;
+
+    /// @brief create ray
+    /// @param origin start of ray
+    /// @param direction direction of ray
+    /// @return ray
+    static ray create( const vec3& origin, const vec3& direction );
+};
+/// @brief point along ray
+/// @param r ray
+/// @param distance distance along ray
+/// @return origin + direction * distance
+vec3 point_at( const ray& r, f32 distance );
+/// @brief intersect ray with bounding box
+/// @param r ray
+/// @param box bounding box
+/// @param max_distance ignore hits further than this
+/// @param out_distance distance to entry point, 0 if origin is inside box
+/// @return true if ray hits box
+bool32 raycast( const ray& r, const aabb& box, f32 max_distance, f32* out_distance );
+/// @brief intersect ray with triangle, both sides are hit
+/// @param r ray
+/// @param a,b,c triangle vertices
+/// @param max_distance ignore hits further than this
+/// @param out_distance distance to hit
+/// @param out_u,out_v barycentric coordinates of hit for b and c
+/// @return true if ray hits triangle
+bool32 raycast(
+    const ray& r, const vec3& a, const vec3& b, const vec3& c,
+    f32 max_distance, f32* out_distance, f32* out_u, f32* out_v );
+
+/// @brief result of raycast against bvh
+struct raycast_hit {
+    /// @brief distance along ray
+    f32 distance;
+    /// @brief index of primitive that was hit
+    u32 primitive;
+    /// @brief barycentric coordinates of hit for triangle bvh, 0 otherwise
+    f32 u, v;
+};
+/// @brief four-wide bvh node.
+/// child bounds are stored as structure of arrays so a ray
+/// or box can be tested against all four children at once
+struct bvh_node {
+    f32 min_x[4];
+    f32 min_y[4];
+    f32 min_z[4];
+    f32 max_x[4];
+    f32 max_y[4];
+    f32 max_z[4];
+    /// @brief internal child: node index, leaf child: first index into bvh::indices
+    u32 child[4];
+    /// @brief number of primitives in leaf child, 0 for internal child.
+    /// unused slots have both child and count set to 0
+    u32 count[4];
+};
+/// @brief bounding volume hierarchy over boxes or triangles.
+/// built top-down with binned surface area heuristic into four-wide
+/// nodes stored depth-first in one array, root is node 0
+struct bvh {
+    /// @brief nodes, parents come before their children
+    bvh_node* nodes;
+    /// @brief number of nodes
+    u32 node_count;
+    /// @brief primitive indices referenced by leaves
+    u32* indices;
+    /// @brief bounds of each primitive
+    aabb* bounds;
+    /// @brief triangle vertices, 3 per primitive, not owned. null for box bvh
+    const vec3* triangles;
+    /// @brief number of primitives
+    u32 primitive_count;
+};
+/// @brief build bvh over bounding boxes
+/// @param bounds bounding box of each primitive, copied
+/// @param count number of primitives
+/// @param out_result bvh
+/// @return true if successful
+bool32 bvh_build( const aabb* bounds, usize count, bvh* out_result );
+/// @brief build bvh over triangles
+/// @param vertices 3 vertices per triangle, must outlive bvh
+/// @param triangle_count number of triangles
+/// @param out_result bvh
+/// @return true if successful
+bool32 bvh_build_triangles( const vec3* vertices, usize triangle_count, bvh* out_result );
+/// @brief free bvh
+/// @param tree bvh to free
+void bvh_free( bvh* tree );
+/// @brief refit box bvh to moved primitives, tree structure is kept.
+/// quality drops as primitives move far from where they were at build time
+/// @param tree bvh
+/// @param bounds new bounding box of each primitive, same count as at build time
+void bvh_refit( bvh& tree, const aabb* bounds );
+/// @brief refit triangle bvh to moved vertices, tree structure is kept
+/// @param tree bvh
+/// @param vertices new vertices, same count as at build time, must outlive bvh
+void bvh_refit_triangles( bvh& tree, const vec3* vertices );
+/// @brief find closest primitive hit by ray
+/// @param tree bvh
+/// @param r ray
+/// @param max_distance ignore hits further than this
+/// @param out_hit closest hit
+/// @return true if anything was hit
+bool32 raycast_closest( const bvh& tree, const ray& r, f32 max_distance, raycast_hit* out_hit );
+/// @brief check if ray hits any primitive, stops at first hit
+/// @param tree bvh
+/// @param r ray
+/// @param max_distance ignore hits further than this
+/// @return true if anything was hit
+bool32 raycast_any( const bvh& tree, const ray& r, f32 max_distance );
+/// @brief find primitives whose bounds overlap box
+/// @param tree bvh
+/// @param box query box
+/// @param out_primitives list of u32, receives primitive indices.
+/// existing items are cleared, can be a zeroed list_t
+/// @return true if successful, false if list couldn't be allocated
+bool32 overlap_aabb( const bvh& tree, const aabb& box, list_t* out_primitives );
+
+/// @brief uniform grid spatial hash over points.
+/// rebuilt each frame with a counting sort so every hash bucket's
+/// points sit next to each other, cells hash into a power of two table
+struct spatial_grid {
+    /// @brief size of each cell, queries are cheapest when radius is close to this
+    f32 cell_size;
+    /// @brief number of hash buckets
+    u32 bucket_count;
+    /// @brief first sorted point of each bucket, bucket_count + 1 entries
+    u32* bucket_start;
+    /// @brief original index of each sorted point
+    u32* indices;
+    /// @brief points sorted by bucket
+    vec3* positions;
+    /// @brief number of points
+    u32 count;
+    /// @brief number of points buffers can hold
+    u32 capacity;
+};
+/// @brief create empty spatial grid
+/// @param cell_size size of each cell
+/// @param capacity number of points to allocate up front, can be 0
+/// @param out_result spatial grid
+/// @return true if successful
+bool32 spatial_grid_create( f32 cell_size, usize capacity, spatial_grid* out_result );
+/// @brief free spatial grid
+/// @param grid grid to free
+void spatial_grid_free( spatial_grid* grid );
+/// @brief replace points in grid, grows buffers if needed
+/// @param grid grid
+/// @param positions points
+/// @param count number of points
+/// @return true if successful
+bool32 spatial_grid_rebuild( spatial_grid& grid, const vec3* positions, usize count );
+/// @brief replace points in grid with 2d points, z is 0
+/// @param grid grid
+/// @param positions points
+/// @param count number of points
+/// @return true if successful
+bool32 spatial_grid_rebuild( spatial_grid& grid, const vec2* positions, usize count );
+/// @brief find points within radius, inclusive
+/// @param grid grid
+/// @param center center of query
+/// @param radius radius of query
+/// @param out_indices list of u32, receives indices of points passed to rebuild.
+/// existing items are cleared, can be a zeroed list_t
+/// @return true if successful, false if list couldn't be allocated
+bool32 query_radius( const spatial_grid& grid, const vec3& center, f32 radius, list_t* out_indices );
+/// @brief find 2d points within radius, inclusive
+/// @param grid grid built from 2d points
+/// @param center center of query
+/// @param radius radius of query
+/// @param out_indices list of u32, receives indices of points passed to rebuild.
+/// existing items are cleared, can be a zeroed list_t
+/// @return true if successful, false if list couldn't be allocated
+bool32 query_radius( const spatial_grid& grid, const vec2& center, f32 radius, list_t* out_indices );
+/// @brief find points within radius of every center
+/// @param grid grid
+/// @param centers centers of queries
+/// @param count number of queries
+/// @param radius radius of every query
+/// @param out_indices list of u32, receives indices of points for every query back to back.
+/// existing items are cleared, can be a zeroed list_t
+/// @param out_offsets array of count + 1, results of query i are
+/// out_indices[out_offsets[i]] up to out_indices[out_offsets[i + 1]]
+/// @return true if successful, false if list couldn't be allocated
+bool32 query_radius_n(
+    const spatial_grid& grid, const vec3* centers, usize count,
+    f32 radius, list_t* out_indices, u32* out_offsets );
+
+/// @brief loose octree node
+struct octree_node {
+    /// @brief center of node
+    vec3 center;
+    /// @brief half size of node, loose bounds are twice as large
+    f32 half_size;
+    /// @brief index of child in each octant, 0 if octant has no child.
+    /// children are only made for octants that hold spheres
+    u32 children[8];
+    /// @brief first sorted sphere in node
+    u32 first;
+    /// @brief number of spheres in node
+    u32 count;
+};
+/// @brief loose octree over spheres of mixed size.
+/// each sphere goes into the deepest node that is at least as large as its radius
+/// and contains its center, node bounds are doubled so that node always contains it
+struct loose_octree {
+    /// @brief list of octree_node, root is node 0
+    list_t nodes;
+    /// @brief original index of each sorted sphere
+    u32* indices;
+    /// @brief spheres sorted by node, center in xyz and radius in w
+    vec4* spheres;
+    /// @brief number of spheres
+    u32 count;
+    /// @brief number of spheres buffers can hold
+    u32 capacity;
+    /// @brief deepest node level, root is level 0
+    u32 max_depth;
+};
+/// @brief create empty loose octree
+/// @param center center of root node
+/// @param half_size half size of root node, spheres outside are kept in root
+/// @param max_depth deepest node level
+/// @param out_result loose octree
+/// @return true if successful
+bool32 loose_octree_create(
+    const vec3& center, f32 half_size, u32 max_depth, loose_octree* out_result );
+/// @brief free loose octree
+/// @param tree tree to free
+void loose_octree_free( loose_octree* tree );
+/// @brief replace spheres in tree, nodes are reused between rebuilds
+/// @param tree tree
+/// @param centers center of each sphere
+/// @param radii radius of each sphere
+/// @param count number of spheres
+/// @return true if successful
+bool32 loose_octree_rebuild(
+    loose_octree& tree, const vec3* centers, const f32* radii, usize count );
+/// @brief find spheres that overlap query sphere, touching counts
+/// @param tree tree
+/// @param center center of query
+/// @param radius radius of query
+/// @param out_indices list of u32, receives indices of spheres passed to rebuild.
+/// existing items are cleared, can be a zeroed list_t
+/// @return true if successful, false if list couldn't be allocated
+bool32 query_radius( const loose_octree& tree, const vec3& center, f32 radius, list_t* out_indices );
+/// @brief find spheres that overlap every query sphere
+/// @param tree tree
+/// @param centers centers of queries
+/// @param count number of queries
+/// @param radius radius of every query
+/// @param out_indices list of u32, receives indices of spheres for every query back to back.
+/// existing items are cleared, can be a zeroed list_t
+/// @param out_offsets array of count + 1, results of query i are
+/// out_indices[out_offsets[i]] up to out_indices[out_offsets[i + 1]]
+/// @return true if successful, false if list couldn't be allocated
+bool32 query_radius_n(
+    const loose_octree& tree, const vec3* centers, usize count,
+    f32 radius, list_t* out_indices, u32* out_offsets );
 
 /// @brief linear congruential random number generator state
 struct lcg {
@@ -2868,6 +3764,66 @@ struct xor_shift64 {
     /// @brief current value in sequence
     u64 current;
 };
+/// @brief four independent xor shift streams, stepped together in one four-wide lane
+struct xor_shift_x4 {
+    /// @brief current value of each stream
+    u32 current[4];
+};
+/// @brief eight independent xor shift streams, stepped together in one eight-wide lane
+struct xor_shift_x8 {
+    /// @brief current value of each stream
+    u32 current[8];
+};
+/// @brief interval of generated floating point numbers
+enum rand_interval : u32 {
+    /// @brief 0 inclusive to 1 exclusive
+    RAND_INTERVAL_UNIT,
+    /// @brief -1 inclusive to 1 exclusive
+    RAND_INTERVAL_SIGNED,
+};
+/// @brief splitmix64 random number generator state.
+/// every seed gives a full period, good for seeding other generators
+struct splitmix64 {
+    /// @brief value to start with
+    u64 seed;
+    /// @brief current value in sequence
+    u64 current;
+};
+/// @brief permuted congruential random number generator state (pcg32, xsh-rr)
+struct pcg32 {
+    /// @brief current value in sequence
+    u64 current;
+    /// @brief stream selector, always odd
+    u64 increment;
+};
+/// @brief xoshiro128+ random number generator state.
+/// lowest bits are weak, use for floating point numbers
+struct xoshiro128plus {
+    /// @brief current value in sequence, never all zero
+    u32 current[4];
+};
+/// @brief xoshiro256** random number generator state
+struct xoshiro256starstar {
+    /// @brief current value in sequence, never all zero
+    u64 current[4];
+};
+/// @brief type erased generator for batch samplers.
+/// samplers draw from it in blocks, so it does not cost an indirect call per value
+struct rand_source {
+    /// @brief generator state, must outlive source
+    void* state;
+    /// @brief fill array with count random 32-bit unsigned integers
+    void (*fill)( void* state, u32* out_bits, usize count );
+};
+/// @brief alias table for constant time weighted choice (Vose)
+struct alias_table {
+    /// @brief chance of keeping each bucket's own index, count items
+    f32* probability;
+    /// @brief index to take when bucket's own index is not kept, count items
+    u32* alias;
+    /// @brief number of weights
+    u32 count;
+};
 
 // NOTE(alicia): FUNCTIONS (ext) -------------------------------------------------------------------------------------------
 
@@ -2981,6 +3937,402 @@ void rand( xor_shift64& state, i64& next );
 /// @param next [out] random value in -1-1 range
 void rand( xor_shift64& state, f64& next );
 
+/// @brief define new four stream xor shift generator state,
+/// each stream is seeded with a different scramble of seed
+/// @param seed value to start with
+/// @return xor shift state
+xor_shift_x4 new_xor_shift_x4( u32 seed );
+/// @brief define new eight stream xor shift generator state,
+/// each stream is seeded with a different scramble of seed
+/// @param seed value to start with
+/// @return xor shift state
+xor_shift_x8 new_xor_shift_x8( u32 seed );
+/// @brief step every stream once
+/// @param state reference to state to use
+/// @param next [out] next random number of each stream
+void rand( xor_shift_x4& state, simd::lane4i_t& next );
+/// @brief step every stream once
+/// @param state reference to state to use
+/// @param next [out] next random number of each stream
+void rand( xor_shift_x8& state, simd::lane8i_t& next );
+/// @brief step every stream once
+/// @param state reference to state to use
+/// @param next [out] random value of each stream in -1-1 range, 1 excluded
+void rand( xor_shift_x4& state, simd::lane4f_t& next );
+/// @brief step every stream once
+/// @param state reference to state to use
+/// @param next [out] random value of each stream in -1-1 range, 1 excluded
+void rand( xor_shift_x8& state, simd::lane8f_t& next );
+/// @brief fill array with random floating point numbers.
+/// mantissa bits are filled directly, there is no division per element
+/// @param state reference to state to use
+/// @param out_result array that can hold count floats
+/// @param count number of floats to generate
+/// @param interval interval of generated values
+void rand_fill( xor_shift_x4& state, f32* out_result, usize count, rand_interval interval );
+/// @brief fill array with random floating point numbers.
+/// mantissa bits are filled directly, there is no division per element
+/// @param state reference to state to use
+/// @param out_result array that can hold count floats
+/// @param count number of floats to generate
+/// @param interval interval of generated values
+void rand_fill( xor_shift_x8& state, f32* out_result, usize count, rand_interval interval );
+/// @brief fill array with random vectors
+/// @param state reference to state to use
+/// @param out_result array that can hold count vectors
+/// @param count number of vectors to generate
+/// @param interval interval of every component
+void rand_fill_vec3( xor_shift_x4& state, vec3* out_result, usize count, rand_interval interval );
+/// @brief fill array with random vectors
+/// @param state reference to state to use
+/// @param out_result array that can hold count vectors
+/// @param count number of vectors to generate
+/// @param interval interval of every component
+void rand_fill_vec3( xor_shift_x8& state, vec3* out_result, usize count, rand_interval interval );
+
+/// @brief define new splitmix64 generator state
+/// @param seed value to start with, any value is valid
+/// @return splitmix64 state
+splitmix64 new_splitmix64( u64 seed );
+/// @brief define new permuted congruential generator state
+/// @param seed value to start with, any value is valid
+/// @return pcg32 state
+pcg32 new_pcg32( u64 seed );
+/// @brief define new permuted congruential generator state on given stream.
+/// different streams produce different sequences from the same seed
+/// @param seed value to start with, any value is valid
+/// @param stream stream to generate from, any value is valid
+/// @return pcg32 state
+pcg32 new_pcg32( u64 seed, u64 stream );
+/// @brief define new xoshiro128+ generator state, seeded through splitmix64
+/// @param seed value to start with, any value is valid
+/// @return xoshiro128+ state
+xoshiro128plus new_xoshiro128plus( u64 seed );
+/// @brief define new xoshiro256** generator state, seeded through splitmix64
+/// @param seed value to start with, any value is valid
+/// @return xoshiro256** state
+xoshiro256starstar new_xoshiro256starstar( u64 seed );
+/// @brief generate new random 64-bit unsigned integer using splitmix64 generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( splitmix64& state, u64& next );
+/// @brief generate new random 64-bit integer using splitmix64 generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( splitmix64& state, i64& next );
+/// @brief generate new random 64-bit floating-point number using splitmix64 generator
+/// @param state reference to state to use
+/// @param next [out] random value in -1-1 range, 1 excluded
+void rand( splitmix64& state, f64& next );
+/// @brief generate new random 32-bit unsigned integer using splitmix64 generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( splitmix64& state, u32& next );
+/// @brief generate new random 32-bit integer using splitmix64 generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( splitmix64& state, i32& next );
+/// @brief generate new random 32-bit floating-point number using splitmix64 generator
+/// @param state reference to state to use
+/// @param next [out] random value in -1-1 range, 1 excluded
+void rand( splitmix64& state, f32& next );
+/// @brief generate random vector using splitmix64 generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( splitmix64& state, vec2& result );
+/// @brief generate random vector using splitmix64 generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( splitmix64& state, ivec2& result );
+/// @brief generate random vector using splitmix64 generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( splitmix64& state, vec3& result );
+/// @brief generate random vector using splitmix64 generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( splitmix64& state, ivec3& result );
+/// @brief generate random vector using splitmix64 generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( splitmix64& state, vec4& result );
+/// @brief generate random vector using splitmix64 generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( splitmix64& state, ivec4& result );
+/// @brief generate new random 32-bit unsigned integer using permuted congruential generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( pcg32& state, u32& next );
+/// @brief generate new random 32-bit integer using permuted congruential generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( pcg32& state, i32& next );
+/// @brief generate new random 32-bit floating-point number using permuted congruential generator
+/// @param state reference to state to use
+/// @param next [out] random value in -1-1 range, 1 excluded
+void rand( pcg32& state, f32& next );
+/// @brief generate random vector using permuted congruential generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( pcg32& state, vec2& result );
+/// @brief generate random vector using permuted congruential generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( pcg32& state, ivec2& result );
+/// @brief generate random vector using permuted congruential generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( pcg32& state, vec3& result );
+/// @brief generate random vector using permuted congruential generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( pcg32& state, ivec3& result );
+/// @brief generate random vector using permuted congruential generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( pcg32& state, vec4& result );
+/// @brief generate random vector using permuted congruential generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( pcg32& state, ivec4& result );
+/// @brief generate new random 32-bit unsigned integer using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( xoshiro128plus& state, u32& next );
+/// @brief generate new random 32-bit integer using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( xoshiro128plus& state, i32& next );
+/// @brief generate new random 32-bit floating-point number using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param next [out] random value in -1-1 range, 1 excluded
+void rand( xoshiro128plus& state, f32& next );
+/// @brief generate random vector using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( xoshiro128plus& state, vec2& result );
+/// @brief generate random vector using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( xoshiro128plus& state, ivec2& result );
+/// @brief generate random vector using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( xoshiro128plus& state, vec3& result );
+/// @brief generate random vector using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( xoshiro128plus& state, ivec3& result );
+/// @brief generate random vector using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( xoshiro128plus& state, vec4& result );
+/// @brief generate random vector using xoshiro128+ generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( xoshiro128plus& state, ivec4& result );
+/// @brief generate new random 64-bit unsigned integer using xoshiro256** generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( xoshiro256starstar& state, u64& next );
+/// @brief generate new random 64-bit integer using xoshiro256** generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( xoshiro256starstar& state, i64& next );
+/// @brief generate new random 64-bit floating-point number using xoshiro256** generator
+/// @param state reference to state to use
+/// @param next [out] random value in -1-1 range, 1 excluded
+void rand( xoshiro256starstar& state, f64& next );
+/// @brief generate new random 32-bit unsigned integer using xoshiro256** generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( xoshiro256starstar& state, u32& next );
+/// @brief generate new random 32-bit integer using xoshiro256** generator
+/// @param state reference to state to use
+/// @param next [out] next random number in sequence
+void rand( xoshiro256starstar& state, i32& next );
+/// @brief generate new random 32-bit floating-point number using xoshiro256** generator
+/// @param state reference to state to use
+/// @param next [out] random value in -1-1 range, 1 excluded
+void rand( xoshiro256starstar& state, f32& next );
+/// @brief generate random vector using xoshiro256** generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( xoshiro256starstar& state, vec2& result );
+/// @brief generate random vector using xoshiro256** generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( xoshiro256starstar& state, ivec2& result );
+/// @brief generate random vector using xoshiro256** generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( xoshiro256starstar& state, vec3& result );
+/// @brief generate random vector using xoshiro256** generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( xoshiro256starstar& state, ivec3& result );
+/// @brief generate random vector using xoshiro256** generator
+/// @param state reference to state to use
+/// @param result vector with random values in -1-1 range
+void rand( xoshiro256starstar& state, vec4& result );
+/// @brief generate random vector using xoshiro256** generator
+/// @param state reference to state to use
+/// @param result vector with random values
+void rand( xoshiro256starstar& state, ivec4& result );
+/// @brief skip ahead in sequence without generating values
+/// @param state reference to state to use
+/// @param delta number of values to skip
+void advance( splitmix64& state, u64 delta );
+/// @brief skip ahead in sequence without generating values, takes log2(delta) steps
+/// @param state reference to state to use
+/// @param delta number of values to skip
+void advance( pcg32& state, u64 delta );
+/// @brief skip ahead 2^64 values in sequence.
+/// copy state and jump once per worker, the 2^128 period holds 2^64 non-overlapping subsequences
+/// @param state reference to state to use
+void jump( xoshiro128plus& state );
+/// @brief skip ahead 2^128 values in sequence.
+/// copy state and jump once per worker, the 2^256 period holds 2^128 non-overlapping subsequences
+/// @param state reference to state to use
+void jump( xoshiro256starstar& state );
+
+/// @brief create batch sampler source from xor shift generator
+/// @param state reference to state to draw from, must outlive source
+/// @return rand source
+rand_source new_rand_source( xor_shift& state );
+/// @brief create batch sampler source from xor shift generator
+/// @param state reference to state to draw from, must outlive source
+/// @return rand source
+rand_source new_rand_source( xor_shift64& state );
+/// @brief create batch sampler source from four stream xor shift generator
+/// @param state reference to state to draw from, must outlive source
+/// @return rand source
+rand_source new_rand_source( xor_shift_x4& state );
+/// @brief create batch sampler source from eight stream xor shift generator
+/// @param state reference to state to draw from, must outlive source
+/// @return rand source
+rand_source new_rand_source( xor_shift_x8& state );
+/// @brief create batch sampler source from splitmix64 generator
+/// @param state reference to state to draw from, must outlive source
+/// @return rand source
+rand_source new_rand_source( splitmix64& state );
+/// @brief create batch sampler source from permuted congruential generator
+/// @param state reference to state to draw from, must outlive source
+/// @return rand source
+rand_source new_rand_source( pcg32& state );
+/// @brief create batch sampler source from xoshiro128+ generator
+/// @param state reference to state to draw from, must outlive source
+/// @return rand source
+rand_source new_rand_source( xoshiro128plus& state );
+/// @brief create batch sampler source from xoshiro256** generator
+/// @param state reference to state to draw from, must outlive source
+/// @return rand source
+rand_source new_rand_source( xoshiro256starstar& state );
+/// @brief fill array with uniformly distributed floating point numbers
+/// @param source generator to draw from
+/// @param min smallest value
+/// @param max largest value, excluded up to rounding
+/// @param out_values array that can hold count floats
+/// @param count number of values to generate
+void rand_range_n( rand_source& source, f32 min, f32 max, f32* out_values, usize count );
+/// @brief fill array with uniformly distributed integers, without modulo bias
+/// @param source generator to draw from
+/// @param min smallest value
+/// @param max largest value, excluded
+/// @param out_values array that can hold count integers
+/// @param count number of values to generate
+void rand_range_n( rand_source& source, i32 min, i32 max, i32* out_values, usize count );
+/// @brief clear list and fill it with uniformly distributed floating point numbers
+/// @param source generator to draw from
+/// @param min smallest value
+/// @param max largest value, excluded up to rounding
+/// @param count number of values to generate
+/// @param out_values list of f32, reallocated if too small
+/// @return true if list could hold count values
+bool32 rand_range_n( rand_source& source, f32 min, f32 max, usize count, list_t* out_values );
+/// @brief clear list and fill it with uniformly distributed integers, without modulo bias
+/// @param source generator to draw from
+/// @param min smallest value
+/// @param max largest value, excluded
+/// @param count number of values to generate
+/// @param out_values list of i32, reallocated if too small
+/// @return true if list could hold count values
+bool32 rand_range_n( rand_source& source, i32 min, i32 max, usize count, list_t* out_values );
+/// @brief fill array with normally distributed numbers (ziggurat)
+/// @param source generator to draw from
+/// @param mean mean of distribution
+/// @param std_dev standard deviation of distribution
+/// @param out_values array that can hold count floats
+/// @param count number of values to generate
+void rand_normal_n( rand_source& source, f32 mean, f32 std_dev, f32* out_values, usize count );
+/// @brief clear list and fill it with normally distributed numbers (ziggurat)
+/// @param source generator to draw from
+/// @param mean mean of distribution
+/// @param std_dev standard deviation of distribution
+/// @param count number of values to generate
+/// @param out_values list of f32, reallocated if too small
+/// @return true if list could hold count values
+bool32 rand_normal_n( rand_source& source, f32 mean, f32 std_dev, usize count, list_t* out_values );
+/// @brief fill array with directions uniformly distributed on unit sphere,
+/// no rejection sampling
+/// @param source generator to draw from
+/// @param out_values array that can hold count vectors
+/// @param count number of vectors to generate
+void rand_unit_vec3_n( rand_source& source, vec3* out_values, usize count );
+/// @brief clear list and fill it with directions uniformly distributed on unit sphere
+/// @param source generator to draw from
+/// @param count number of vectors to generate
+/// @param out_values list of vec3, reallocated if too small
+/// @return true if list could hold count vectors
+bool32 rand_unit_vec3_n( rand_source& source, usize count, list_t* out_values );
+/// @brief fill array with points uniformly distributed inside unit sphere,
+/// no rejection sampling
+/// @param source generator to draw from
+/// @param out_values array that can hold count vectors
+/// @param count number of vectors to generate
+void rand_in_sphere_n( rand_source& source, vec3* out_values, usize count );
+/// @brief clear list and fill it with points uniformly distributed inside unit sphere
+/// @param source generator to draw from
+/// @param count number of vectors to generate
+/// @param out_values list of vec3, reallocated if too small
+/// @return true if list could hold count vectors
+bool32 rand_in_sphere_n( rand_source& source, usize count, list_t* out_values );
+/// @brief fill array with points uniformly distributed inside unit disk,
+/// no rejection sampling
+/// @param source generator to draw from
+/// @param out_values array that can hold count vectors
+/// @param count number of vectors to generate
+void rand_in_disk_n( rand_source& source, vec2* out_values, usize count );
+/// @brief clear list and fill it with points uniformly distributed inside unit disk
+/// @param source generator to draw from
+/// @param count number of vectors to generate
+/// @param out_values list of vec2, reallocated if too small
+/// @return true if list could hold count vectors
+bool32 rand_in_disk_n( rand_source& source, usize count, list_t* out_values );
+/// @brief build alias table from weights
+/// @param weights relative weight of each index, must not be negative
+/// @param count number of weights
+/// @param out_result [out] alias table, free with alias_table_free
+/// @return true if allocation succeeded and weights have a positive sum
+bool32 alias_table_create( const f32* weights, usize count, alias_table* out_result );
+/// @brief free alias table
+/// @param table table to free
+void alias_table_free( alias_table* table );
+/// @brief fill array with indices chosen with chance proportional to their weight
+/// @param source generator to draw from
+/// @param table alias table to choose from
+/// @param out_indices array that can hold count indices
+/// @param count number of indices to choose
+void rand_choice_n( rand_source& source, const alias_table& table, u32* out_indices, usize count );
+/// @brief clear list and fill it with indices chosen with chance proportional to their weight
+/// @param source generator to draw from
+/// @param table alias table to choose from
+/// @param count number of indices to choose
+/// @param out_indices list of u32, reallocated if too small
+/// @return true if list could hold count indices
+bool32 rand_choice_n( rand_source& source, const alias_table& table, usize count, list_t* out_indices );
+
 // NOTE(alicia): perlin noise
 
 } // namespace smath
@@ -2989,4 +4341,8 @@ void rand( xor_shift64& state, f64& next );
     #pragma clang diagnostic pop
 #endif
 
+#if defined(SMATH_HEADER_ONLY)
+    #include "smath.cpp"
+#endif
+
 #endif
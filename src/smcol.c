@@ -90,6 +90,24 @@ void smcol_set_allocator(
     SMCOL_REALLOC = heap_realloc;
     SMCOL_FREE    = heap_free;
 }
+// NOTE(alicia): over-allocate and keep the original pointer
+// right before the aligned buffer so it can be freed later
+void* smcol_alloc_aligned( usize size, usize alignment ) {
+    usize header = sizeof(void*) + alignment - 1;
+    u8* buffer   = (u8*)(SMCOL_ALLOC( size + header ));
+    if( !buffer ) {
+        return NULL;
+    }
+
+    usize aligned = ( (usize)(buffer + header) ) & ~( alignment - 1 );
+    ((void**)aligned)[-1] = buffer;
+    return (void*)aligned;
+}
+void smcol_free_aligned( void* buffer ) {
+    if( buffer ) {
+        SMCOL_FREE( ((void**)buffer)[-1] );
+    }
+}
 
 // NOTE(alicia): list
 
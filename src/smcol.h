@@ -21,6 +21,13 @@ void smcol_set_allocator(
     smushy_collections_heap_realloc_fn heap_realloc,
     smushy_collections_heap_free_fn heap_free
 );
+/// allocate buffer with given alignment using current allocator functions
+/// @param size byte size of buffer
+/// @param alignment power of two alignment in bytes
+/// @return [void*] aligned buffer, NULL if allocation failed
+void* smcol_alloc_aligned( usize size, usize alignment );
+/// free buffer allocated with smcol_alloc_aligned
+void smcol_free_aligned( void* buffer );
 
 // collection types -----------------------------------------------------------
 
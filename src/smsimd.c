@@ -5,212 +5,592 @@
 */
 #include "smsimd.h"
 
-// TODO(alicia): ARM NEON
-// TODO(alicia): x86 AVX
-
-#if SMUSHY_SIMD_WIDTH != 1
-    #if defined(SM_ARCH_X86)
-        #include <immintrin.h>
-    #elif defined(SM_ARCH_ARM)
+// NOTE(alicia): x86 intrinsics are always included for runtime dispatch
+#if defined(SM_ARCH_X86)
+    #include <immintrin.h>
+    #if !defined(SM_COMPILER_MSVC)
+        #include <cpuid.h>
+    #endif
+#elif defined(SM_ARCH_ARM)
+    #if SMUSHY_SIMD_WIDTH != 1 || defined(__ARM_NEON)
         #include <arm_neon.h>
     #endif
+    #if defined(SM_PLATFORM_LINUX) || defined(SM_PLATFORM_ANDROID)
+        #include <sys/auxv.h>
+    #endif
 #endif
 
+// NOTE(alicia): msvc lets any intrinsic through,
+// gcc and clang need the target per function
 #if defined(SM_COMPILER_MSVC)
-    #include <math.h>
-    #define __builtin_sqrtf sqrtf
+    #define SMSIMD_TARGET(isa)
+#else
+    #define SMSIMD_TARGET(isa) __attribute__((target(isa)))
 #endif
 
+// NOTE(alicia): C++ already has these from smsimd.h, C gets the external definitions here
+#include "smsimd_lanes.inl"
+
 #if defined(__cplusplus)
     namespace smath {
     namespace simd  {
 #endif // c++
 
-// scalar
-#if SMUSHY_SIMD_WIDTH == 1
+// NOTE(alicia): runtime dispatch
 
-lane4f_t lane4f_set( f32 a, f32 b, f32 c, f32 d ) {
-    lane4f_t result;
-    result.a = a;
-    result.b = b;
-    result.c = c;
-    result.d = d;
-    return result;
+// scalar kernels
+static void smsimd_scalar_add_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        out[i] = lhs[i] + rhs[i];
+    }
 }
-lane4f_t lane4f_set_scalar( f32 scalar ) {
-    lane4f_t result;
-    result.a = scalar;
-    result.b = scalar;
-    result.c = scalar;
-    result.d = scalar;
-    return result;
+static void smsimd_scalar_sub_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        out[i] = lhs[i] - rhs[i];
+    }
 }
-lane4f_t lane4f_set_zero() {
-    lane4f_t result;
-    result.a = 0;
-    result.b = 0;
-    result.c = 0;
-    result.d = 0;
-    return result;
+static void smsimd_scalar_mul_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        out[i] = lhs[i] * rhs[i];
+    }
 }
-lane4f_t lane4f_load( const f32* load_array ) {
-    lane4f_t result;
-    result.a = load_array[0];
-    result.b = load_array[1];
-    result.c = load_array[2];
-    result.d = load_array[3];
-    return result;
+static void smsimd_scalar_div_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        out[i] = lhs[i] / rhs[i];
+    }
 }
-lane4f_t lane4f_add( lane4f_t lhs, lane4f_t rhs ) {
-    lane4f_t result;
-    result.a = lhs.a + rhs.a;
-    result.b = lhs.b + rhs.b;
-    result.c = lhs.c + rhs.c;
-    result.d = lhs.d + rhs.d;
-    return result;
+static void smsimd_scalar_sqrt_n( const f32* x, f32* out, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        out[i] = __builtin_sqrtf( x[i] );
+    }
 }
-lane4f_t lane4f_sub( lane4f_t lhs, lane4f_t rhs ) {
-    lane4f_t result;
-    result.a = lhs.a - rhs.a;
-    result.b = lhs.b - rhs.b;
-    result.c = lhs.c - rhs.c;
-    result.d = lhs.d - rhs.d;
-    return result;
+static void smsimd_scalar_scale_n( const f32* x, f32 scalar, f32* out, usize count ) {
+    for( usize i = 0; i < count; ++i ) {
+        out[i] = x[i] * scalar;
+    }
 }
-lane4f_t lane4f_mul( lane4f_t lhs, lane4f_t rhs ) {
-    lane4f_t result;
-    result.a = lhs.a * rhs.a;
-    result.b = lhs.b * rhs.b;
-    result.c = lhs.c * rhs.c;
-    result.d = lhs.d * rhs.d;
+static f32 smsimd_scalar_sum_n( const f32* x, usize count ) {
+    f32 result = 0.0f;
+    for( usize i = 0; i < count; ++i ) {
+        result += x[i];
+    }
     return result;
 }
-lane4f_t lane4f_div( lane4f_t lhs, lane4f_t rhs ) {
-    lane4f_t result;
-    result.a = lhs.a / rhs.a;
-    result.b = lhs.b / rhs.b;
-    result.c = lhs.c / rhs.c;
-    result.d = lhs.d / rhs.d;
-    return result;
+
+static const smsimd_kernels_t SMSIMD_KERNELS_SCALAR = {
+    SMSIMD_LEVEL_SCALAR,
+    smsimd_scalar_add_n,
+    smsimd_scalar_sub_n,
+    smsimd_scalar_mul_n,
+    smsimd_scalar_div_n,
+    smsimd_scalar_sqrt_n,
+    smsimd_scalar_scale_n,
+    smsimd_scalar_sum_n,
+};
+
+#if defined(SM_ARCH_X86)
+
+// SSE4 kernels
+SMSIMD_TARGET("sse4.1")
+static void smsimd_sse4_add_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_loadu_ps( lhs + i ), _mm_loadu_ps( rhs + i ) ) );
+    }
+    smsimd_scalar_add_n( lhs + i, rhs + i, out + i, count - i );
 }
-lane4f_t lane4f_sqrt( lane4f_t x ) {
-    lane4f_t result;
-    result.a = __builtin_sqrtf(x.a);
-    result.b = __builtin_sqrtf(x.b);
-    result.c = __builtin_sqrtf(x.c);
-    result.d = __builtin_sqrtf(x.d);
-    return result;
+SMSIMD_TARGET("sse4.1")
+static void smsimd_sse4_sub_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        _mm_storeu_ps( out + i, _mm_sub_ps( _mm_loadu_ps( lhs + i ), _mm_loadu_ps( rhs + i ) ) );
+    }
+    smsimd_scalar_sub_n( lhs + i, rhs + i, out + i, count - i );
 }
-void lane4f_store( lane4f_t registers, f32* store_array ) {
-    store_array[0] = registers.a;
-    store_array[1] = registers.b;
-    store_array[2] = registers.c;
-    store_array[3] = registers.d;
+SMSIMD_TARGET("sse4.1")
+static void smsimd_sse4_mul_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        _mm_storeu_ps( out + i, _mm_mul_ps( _mm_loadu_ps( lhs + i ), _mm_loadu_ps( rhs + i ) ) );
+    }
+    smsimd_scalar_mul_n( lhs + i, rhs + i, out + i, count - i );
+}
+SMSIMD_TARGET("sse4.1")
+static void smsimd_sse4_div_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        _mm_storeu_ps( out + i, _mm_div_ps( _mm_loadu_ps( lhs + i ), _mm_loadu_ps( rhs + i ) ) );
+    }
+    smsimd_scalar_div_n( lhs + i, rhs + i, out + i, count - i );
+}
+SMSIMD_TARGET("sse4.1")
+static void smsimd_sse4_sqrt_n( const f32* x, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        _mm_storeu_ps( out + i, _mm_sqrt_ps( _mm_loadu_ps( x + i ) ) );
+    }
+    smsimd_scalar_sqrt_n( x + i, out + i, count - i );
+}
+SMSIMD_TARGET("sse4.1")
+static void smsimd_sse4_scale_n( const f32* x, f32 scalar, f32* out, usize count ) {
+    __m128 scale = _mm_set1_ps( scalar );
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        _mm_storeu_ps( out + i, _mm_mul_ps( _mm_loadu_ps( x + i ), scale ) );
+    }
+    smsimd_scalar_scale_n( x + i, scalar, out + i, count - i );
+}
+SMSIMD_TARGET("sse4.1")
+static f32 smsimd_sse4_sum_n( const f32* x, usize count ) {
+    __m128 sum = _mm_setzero_ps();
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        sum = _mm_add_ps( sum, _mm_loadu_ps( x + i ) );
+    }
+    sum = _mm_add_ps( sum, _mm_movehl_ps( sum, sum ) );
+    sum = _mm_add_ss( sum, _mm_shuffle_ps( sum, sum, 0x55 ) );
+    return _mm_cvtss_f32( sum ) + smsimd_scalar_sum_n( x + i, count - i );
 }
 
-#endif // scalar
+static const smsimd_kernels_t SMSIMD_KERNELS_SSE4 = {
+    SMSIMD_LEVEL_SSE4,
+    smsimd_sse4_add_n,
+    smsimd_sse4_sub_n,
+    smsimd_sse4_mul_n,
+    smsimd_sse4_div_n,
+    smsimd_sse4_sqrt_n,
+    smsimd_sse4_scale_n,
+    smsimd_sse4_sum_n,
+};
 
-// SSE
-#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 4
+// AVX2 kernels
+SMSIMD_TARGET("avx2")
+static void smsimd_avx2_add_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 8 <= count; i += 8 ) {
+        _mm256_storeu_ps( out + i, _mm256_add_ps( _mm256_loadu_ps( lhs + i ), _mm256_loadu_ps( rhs + i ) ) );
+    }
+    smsimd_sse4_add_n( lhs + i, rhs + i, out + i, count - i );
+}
+SMSIMD_TARGET("avx2")
+static void smsimd_avx2_sub_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 8 <= count; i += 8 ) {
+        _mm256_storeu_ps( out + i, _mm256_sub_ps( _mm256_loadu_ps( lhs + i ), _mm256_loadu_ps( rhs + i ) ) );
+    }
+    smsimd_sse4_sub_n( lhs + i, rhs + i, out + i, count - i );
+}
+SMSIMD_TARGET("avx2")
+static void smsimd_avx2_mul_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 8 <= count; i += 8 ) {
+        _mm256_storeu_ps( out + i, _mm256_mul_ps( _mm256_loadu_ps( lhs + i ), _mm256_loadu_ps( rhs + i ) ) );
+    }
+    smsimd_sse4_mul_n( lhs + i, rhs + i, out + i, count - i );
+}
+SMSIMD_TARGET("avx2")
+static void smsimd_avx2_div_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 8 <= count; i += 8 ) {
+        _mm256_storeu_ps( out + i, _mm256_div_ps( _mm256_loadu_ps( lhs + i ), _mm256_loadu_ps( rhs + i ) ) );
+    }
+    smsimd_sse4_div_n( lhs + i, rhs + i, out + i, count - i );
+}
+SMSIMD_TARGET("avx2")
+static void smsimd_avx2_sqrt_n( const f32* x, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 8 <= count; i += 8 ) {
+        _mm256_storeu_ps( out + i, _mm256_sqrt_ps( _mm256_loadu_ps( x + i ) ) );
+    }
+    smsimd_sse4_sqrt_n( x + i, out + i, count - i );
+}
+SMSIMD_TARGET("avx2")
+static void smsimd_avx2_scale_n( const f32* x, f32 scalar, f32* out, usize count ) {
+    __m256 scale = _mm256_set1_ps( scalar );
+    usize i = 0;
+    for( ; i + 8 <= count; i += 8 ) {
+        _mm256_storeu_ps( out + i, _mm256_mul_ps( _mm256_loadu_ps( x + i ), scale ) );
+    }
+    smsimd_sse4_scale_n( x + i, scalar, out + i, count - i );
+}
+SMSIMD_TARGET("avx2")
+static f32 smsimd_avx2_sum_n( const f32* x, usize count ) {
+    __m256 sum = _mm256_setzero_ps();
+    usize i = 0;
+    for( ; i + 8 <= count; i += 8 ) {
+        sum = _mm256_add_ps( sum, _mm256_loadu_ps( x + i ) );
+    }
+    __m128 half = _mm_add_ps( _mm256_castps256_ps128( sum ), _mm256_extractf128_ps( sum, 1 ) );
+    half = _mm_add_ps( half, _mm_movehl_ps( half, half ) );
+    half = _mm_add_ss( half, _mm_shuffle_ps( half, half, 0x55 ) );
+    return _mm_cvtss_f32( half ) + smsimd_sse4_sum_n( x + i, count - i );
+}
+
+static const smsimd_kernels_t SMSIMD_KERNELS_AVX2 = {
+    SMSIMD_LEVEL_AVX2,
+    smsimd_avx2_add_n,
+    smsimd_avx2_sub_n,
+    smsimd_avx2_mul_n,
+    smsimd_avx2_div_n,
+    smsimd_avx2_sqrt_n,
+    smsimd_avx2_scale_n,
+    smsimd_avx2_sum_n,
+};
+
+// AVX-512 kernels
+// NOTE(alicia): tails use masked loads/stores instead of falling back
+#define SMSIMD_AVX512_TAIL_MASK( remaining ) ((__mmask16)((1u << (remaining)) - 1u))
 
-    lane4f_t lane4f_set( f32 a, f32 b, f32 c, f32 d ) {
-        lane4f_t result;
-        result.simd = _mm_setr_ps( a, b, c, d );
-        return result;
+SMSIMD_TARGET("avx512f")
+static void smsimd_avx512_add_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 16 <= count; i += 16 ) {
+        _mm512_storeu_ps( out + i, _mm512_add_ps( _mm512_loadu_ps( lhs + i ), _mm512_loadu_ps( rhs + i ) ) );
+    }
+    if( i < count ) {
+        __mmask16 mask = SMSIMD_AVX512_TAIL_MASK( count - i );
+        _mm512_mask_storeu_ps( out + i, mask, _mm512_add_ps(
+            _mm512_maskz_loadu_ps( mask, lhs + i ), _mm512_maskz_loadu_ps( mask, rhs + i ) ) );
+    }
+}
+SMSIMD_TARGET("avx512f")
+static void smsimd_avx512_sub_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 16 <= count; i += 16 ) {
+        _mm512_storeu_ps( out + i, _mm512_sub_ps( _mm512_loadu_ps( lhs + i ), _mm512_loadu_ps( rhs + i ) ) );
+    }
+    if( i < count ) {
+        __mmask16 mask = SMSIMD_AVX512_TAIL_MASK( count - i );
+        _mm512_mask_storeu_ps( out + i, mask, _mm512_sub_ps(
+            _mm512_maskz_loadu_ps( mask, lhs + i ), _mm512_maskz_loadu_ps( mask, rhs + i ) ) );
+    }
+}
+SMSIMD_TARGET("avx512f")
+static void smsimd_avx512_mul_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 16 <= count; i += 16 ) {
+        _mm512_storeu_ps( out + i, _mm512_mul_ps( _mm512_loadu_ps( lhs + i ), _mm512_loadu_ps( rhs + i ) ) );
     }
-    lane4f_t lane4f_set_scalar( f32 scalar ) {
-        lane4f_t result;
-        result.simd = _mm_set1_ps( scalar );
-        return result;
+    if( i < count ) {
+        __mmask16 mask = SMSIMD_AVX512_TAIL_MASK( count - i );
+        _mm512_mask_storeu_ps( out + i, mask, _mm512_mul_ps(
+            _mm512_maskz_loadu_ps( mask, lhs + i ), _mm512_maskz_loadu_ps( mask, rhs + i ) ) );
     }
-    lane4f_t lane4f_set_zero() {
-        lane4f_t result;
-        result.simd = _mm_setzero_ps();
-        return result;
+}
+SMSIMD_TARGET("avx512f")
+static void smsimd_avx512_div_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 16 <= count; i += 16 ) {
+        _mm512_storeu_ps( out + i, _mm512_div_ps( _mm512_loadu_ps( lhs + i ), _mm512_loadu_ps( rhs + i ) ) );
     }
-    lane4f_t lane4f_load( const f32* load_array ) {
-        lane4f_t result;
-        result.simd = _mm_load_ps( load_array );
-        return result;
+    if( i < count ) {
+        // NOTE(alicia): masked-off lanes divide by one so they don't raise
+        __mmask16 mask = SMSIMD_AVX512_TAIL_MASK( count - i );
+        __m512 divisor = _mm512_mask_loadu_ps( _mm512_set1_ps( 1.0f ), mask, rhs + i );
+        _mm512_mask_storeu_ps( out + i, mask, _mm512_div_ps(
+            _mm512_maskz_loadu_ps( mask, lhs + i ), divisor ) );
     }
-    lane4f_t lane4f_add( lane4f_t lhs, lane4f_t rhs ) {
-        lane4f_t result;
-        result.simd = _mm_add_ps( lhs.simd, rhs.simd );
-        return result;
+}
+SMSIMD_TARGET("avx512f")
+static void smsimd_avx512_sqrt_n( const f32* x, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 16 <= count; i += 16 ) {
+        _mm512_storeu_ps( out + i, _mm512_sqrt_ps( _mm512_loadu_ps( x + i ) ) );
     }
-    lane4f_t lane4f_sub( lane4f_t lhs, lane4f_t rhs ) {
-        lane4f_t result;
-        result.simd = _mm_sub_ps( lhs.simd, rhs.simd );
-        return result;
+    if( i < count ) {
+        __mmask16 mask = SMSIMD_AVX512_TAIL_MASK( count - i );
+        _mm512_mask_storeu_ps( out + i, mask, _mm512_sqrt_ps( _mm512_maskz_loadu_ps( mask, x + i ) ) );
     }
-    lane4f_t lane4f_mul( lane4f_t lhs, lane4f_t rhs ) {
-        lane4f_t result;
-        result.simd = _mm_mul_ps( lhs.simd, rhs.simd );
-        return result;
+}
+SMSIMD_TARGET("avx512f")
+static void smsimd_avx512_scale_n( const f32* x, f32 scalar, f32* out, usize count ) {
+    __m512 scale = _mm512_set1_ps( scalar );
+    usize i = 0;
+    for( ; i + 16 <= count; i += 16 ) {
+        _mm512_storeu_ps( out + i, _mm512_mul_ps( _mm512_loadu_ps( x + i ), scale ) );
     }
-    lane4f_t lane4f_div( lane4f_t lhs, lane4f_t rhs ) {
-        lane4f_t result;
-        result.simd = _mm_div_ps( lhs.simd, rhs.simd );
-        return result;
+    if( i < count ) {
+        __mmask16 mask = SMSIMD_AVX512_TAIL_MASK( count - i );
+        _mm512_mask_storeu_ps( out + i, mask, _mm512_mul_ps( _mm512_maskz_loadu_ps( mask, x + i ), scale ) );
     }
-    lane4f_t lane4f_sqrt( lane4f_t x ) {
-        lane4f_t result;
-        result.simd = _mm_sqrt_ps( x.simd );
-        return result;
+}
+SMSIMD_TARGET("avx512f")
+static f32 smsimd_avx512_sum_n( const f32* x, usize count ) {
+    __m512 sum = _mm512_setzero_ps();
+    usize i = 0;
+    for( ; i + 16 <= count; i += 16 ) {
+        sum = _mm512_add_ps( sum, _mm512_loadu_ps( x + i ) );
     }
-    void lane4f_store( lane4f_t registers, f32* store_array ) {
-        _mm_store_ps( store_array, registers.simd );
+    if( i < count ) {
+        __mmask16 mask = SMSIMD_AVX512_TAIL_MASK( count - i );
+        sum = _mm512_add_ps( sum, _mm512_maskz_loadu_ps( mask, x + i ) );
     }
+    return _mm512_reduce_add_ps( sum );
+}
+
+static const smsimd_kernels_t SMSIMD_KERNELS_AVX512 = {
+    SMSIMD_LEVEL_AVX512,
+    smsimd_avx512_add_n,
+    smsimd_avx512_sub_n,
+    smsimd_avx512_mul_n,
+    smsimd_avx512_div_n,
+    smsimd_avx512_sqrt_n,
+    smsimd_avx512_scale_n,
+    smsimd_avx512_sum_n,
+};
+
+#endif // x86 kernels
 
-#endif // SSE
+#if defined(SM_ARCH_ARM) && defined(__ARM_NEON) && defined(SM_ARCH_64_BIT)
 
-// AVX
-#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+// NEON kernels
+static void smsimd_neon_add_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        vst1q_f32( out + i, vaddq_f32( vld1q_f32( lhs + i ), vld1q_f32( rhs + i ) ) );
+    }
+    smsimd_scalar_add_n( lhs + i, rhs + i, out + i, count - i );
+}
+static void smsimd_neon_sub_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        vst1q_f32( out + i, vsubq_f32( vld1q_f32( lhs + i ), vld1q_f32( rhs + i ) ) );
+    }
+    smsimd_scalar_sub_n( lhs + i, rhs + i, out + i, count - i );
+}
+static void smsimd_neon_mul_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        vst1q_f32( out + i, vmulq_f32( vld1q_f32( lhs + i ), vld1q_f32( rhs + i ) ) );
+    }
+    smsimd_scalar_mul_n( lhs + i, rhs + i, out + i, count - i );
+}
+static void smsimd_neon_div_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        vst1q_f32( out + i, vdivq_f32( vld1q_f32( lhs + i ), vld1q_f32( rhs + i ) ) );
+    }
+    smsimd_scalar_div_n( lhs + i, rhs + i, out + i, count - i );
+}
+static void smsimd_neon_sqrt_n( const f32* x, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        vst1q_f32( out + i, vsqrtq_f32( vld1q_f32( x + i ) ) );
+    }
+    smsimd_scalar_sqrt_n( x + i, out + i, count - i );
+}
+static void smsimd_neon_scale_n( const f32* x, f32 scalar, f32* out, usize count ) {
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        vst1q_f32( out + i, vmulq_n_f32( vld1q_f32( x + i ), scalar ) );
+    }
+    smsimd_scalar_scale_n( x + i, scalar, out + i, count - i );
+}
+static f32 smsimd_neon_sum_n( const f32* x, usize count ) {
+    float32x4_t sum = vdupq_n_f32( 0.0f );
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        sum = vaddq_f32( sum, vld1q_f32( x + i ) );
+    }
+    return vaddvq_f32( sum ) + smsimd_scalar_sum_n( x + i, count - i );
+}
 
+static const smsimd_kernels_t SMSIMD_KERNELS_NEON = {
+    SMSIMD_LEVEL_NEON,
+    smsimd_neon_add_n,
+    smsimd_neon_sub_n,
+    smsimd_neon_mul_n,
+    smsimd_neon_div_n,
+    smsimd_neon_sqrt_n,
+    smsimd_neon_scale_n,
+    smsimd_neon_sum_n,
+};
 
+#endif // NEON kernels
 
-#endif // AVX
+#if defined(SM_ARCH_X86) && !defined(SM_COMPILER_MSVC)
+SMSIMD_TARGET("xsave")
+static u64 smsimd_xgetbv() {
+    u32 eax, edx;
+    __asm__ volatile( "xgetbv" : "=a"(eax), "=d"(edx) : "c"(0) );
+    return ((u64)edx << 32) | eax;
+}
+#endif
 
-// C++ operator overloads
+smsimd_features_t smsimd_detect() {
 #if defined(__cplusplus)
+    smsimd_features_t result = {};
+#else
+    smsimd_features_t result = { 0 };
+#endif
 
-    f32& lane4f_t::operator[](u32 index) { return this->value[index]; }
-    f32  lane4f_t::operator[](u32 index) const { return this->value[index]; }
+#if defined(SM_ARCH_X86)
+    u32 leaf1[4]  = { 0 };
+    u32 leaf7[4]  = { 0 };
+    u32 max_leaf  = 0;
+    #if defined(SM_COMPILER_MSVC)
+        int registers[4];
+        __cpuid( registers, 0 );
+        max_leaf = (u32)registers[0];
+        __cpuid( registers, 1 );
+        for( u32 i = 0; i < 4; ++i ) { leaf1[i] = (u32)registers[i]; }
+        if( max_leaf >= 7 ) {
+            __cpuidex( registers, 7, 0 );
+            for( u32 i = 0; i < 4; ++i ) { leaf7[i] = (u32)registers[i]; }
+        }
+    #else
+        max_leaf = __get_cpuid_max( 0, NULL );
+        __get_cpuid( 1, &leaf1[0], &leaf1[1], &leaf1[2], &leaf1[3] );
+        if( max_leaf >= 7 ) {
+            __cpuid_count( 7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3] );
+        }
+    #endif
 
-    lane4f_t& lane4f_t::operator+=( const lane4f_t& rhs ) {
-        *this = lane4f_add( *this, rhs );
-        return *this;
-    }
+    // NOTE(alicia): registers are eax, ebx, ecx, edx
+    result.sse4 = (leaf1[2] & (1u << 19)) != 0;
 
-    lane4f_t& lane4f_t::operator-=( const lane4f_t& rhs ) {
-        *this = lane4f_sub( *this, rhs );
-        return *this;
-    }
+    // NOTE(alicia): avx needs the os to save ymm/zmm state as well
+    bool32 osxsave = (leaf1[2] & (1u << 27)) != 0;
+    if( osxsave ) {
+        #if defined(SM_COMPILER_MSVC)
+            u64 xcr0 = _xgetbv( 0 );
+        #else
+            u64 xcr0 = smsimd_xgetbv();
+        #endif
+        bool32 ymm_enabled = (xcr0 & 0x06) == 0x06;
+        bool32 zmm_enabled = (xcr0 & 0xE6) == 0xE6;
 
-    lane4f_t& lane4f_t::operator*=( const lane4f_t& rhs ) {
-        *this = lane4f_mul( *this, rhs );
-        return *this;
+        result.avx    = ymm_enabled && (leaf1[2] & (1u << 28)) != 0;
+        result.fma    = result.avx  && (leaf1[2] & (1u << 12)) != 0;
+        result.avx2   = result.avx  && (leaf7[1] & (1u << 5))  != 0;
+        result.avx512 = zmm_enabled && (leaf7[1] & (1u << 16)) != 0;
     }
+#elif defined(SM_ARCH_ARM)
+    #if defined(SM_PLATFORM_LINUX) || defined(SM_PLATFORM_ANDROID)
+        #if defined(SM_ARCH_64_BIT)
+            // NOTE(alicia): HWCAP_ASIMD
+            result.neon = (getauxval( AT_HWCAP ) & (1ul << 1)) != 0;
+        #else
+            // NOTE(alicia): HWCAP_NEON
+            result.neon = (getauxval( AT_HWCAP ) & (1ul << 12)) != 0;
+        #endif
+    #elif defined(__ARM_NEON)
+        result.neon = TRUE;
+    #endif
+#endif
 
-    lane4f_t& lane4f_t::operator/=( const lane4f_t& rhs ) {
-        *this = lane4f_div( *this, rhs );
-        return *this;
-    }
+    return result;
+}
 
-    lane4f_t operator+( const lane4f_t& lhs, const lane4f_t& rhs ) {
-        return lane4f_add( lhs, rhs );
+smsimd_level_t smsimd_best_level( smsimd_features_t features ) {
+#if defined(SM_ARCH_X86)
+    if( features.avx512 ) {
+        return SMSIMD_LEVEL_AVX512;
     }
-    lane4f_t operator-( const lane4f_t& lhs, const lane4f_t& rhs ) {
-        return lane4f_sub( lhs, rhs );
+    if( features.avx2 ) {
+        return SMSIMD_LEVEL_AVX2;
     }
-    lane4f_t operator*( const lane4f_t& lhs, const lane4f_t& rhs ) {
-        return lane4f_mul( lhs, rhs );
+    if( features.sse4 ) {
+        return SMSIMD_LEVEL_SSE4;
     }
-    lane4f_t operator/( const lane4f_t& lhs, const lane4f_t& rhs ) {
-        return lane4f_div( lhs, rhs );
+#elif defined(SM_ARCH_ARM) && defined(__ARM_NEON) && defined(SM_ARCH_64_BIT)
+    if( features.neon ) {
+        return SMSIMD_LEVEL_NEON;
+    }
+#endif
+    SM_UNUSED(features);
+    return SMSIMD_LEVEL_SCALAR;
+}
+
+static const smsimd_kernels_t* smsimd_kernels_for_level( smsimd_level_t level ) {
+    switch( level ) {
+#if defined(SM_ARCH_X86)
+        case SMSIMD_LEVEL_AVX512: return &SMSIMD_KERNELS_AVX512;
+        case SMSIMD_LEVEL_AVX2:   return &SMSIMD_KERNELS_AVX2;
+        case SMSIMD_LEVEL_SSE4:   return &SMSIMD_KERNELS_SSE4;
+#elif defined(SM_ARCH_ARM) && defined(__ARM_NEON) && defined(SM_ARCH_64_BIT)
+        case SMSIMD_LEVEL_NEON:   return &SMSIMD_KERNELS_NEON;
+#endif
+        default: return &SMSIMD_KERNELS_SCALAR;
     }
+}
 
+// NOTE(alicia): the table pointer is read and written from any thread,
+// loads acquire and stores release so concurrent first use is not a data race
+#if defined(SM_COMPILER_MSVC)
+    #include <intrin.h>
+    #define SMSIMD_KERNELS_LOAD()\
+        ((const smsimd_kernels_t*)_InterlockedCompareExchangePointer(\
+            (void* volatile*)&SMSIMD_KERNELS, NULL, NULL ))
+    #define SMSIMD_KERNELS_STORE( kernels )\
+        _InterlockedExchangePointer( (void* volatile*)&SMSIMD_KERNELS, (void*)(kernels) )
+#else
+    #define SMSIMD_KERNELS_LOAD()\
+        __atomic_load_n( &SMSIMD_KERNELS, __ATOMIC_ACQUIRE )
+    #define SMSIMD_KERNELS_STORE( kernels )\
+        __atomic_store_n( &SMSIMD_KERNELS, (kernels), __ATOMIC_RELEASE )
 #endif
+static const smsimd_kernels_t* SMSIMD_KERNELS = NULL;
+
+void smsimd_initialize() {
+    SMSIMD_KERNELS_STORE( smsimd_kernels_for_level( smsimd_best_level( smsimd_detect() ) ) );
+}
+
+smsimd_level_t smsimd_set_level( smsimd_level_t level ) {
+    smsimd_level_t best = smsimd_best_level( smsimd_detect() );
+    // NOTE(alicia): levels from other architectures, or ones
+    // above what the host has, fall back to the best available
+    bool32 supported = level == SMSIMD_LEVEL_SCALAR;
+    switch( best ) {
+        case SMSIMD_LEVEL_AVX512:
+            supported = supported || level == SMSIMD_LEVEL_AVX512;
+            // fallthrough
+        case SMSIMD_LEVEL_AVX2:
+            supported = supported || level == SMSIMD_LEVEL_AVX2;
+            // fallthrough
+        case SMSIMD_LEVEL_SSE4:
+            supported = supported || level == SMSIMD_LEVEL_SSE4;
+            break;
+        case SMSIMD_LEVEL_NEON:
+            supported = supported || level == SMSIMD_LEVEL_NEON;
+            break;
+        default: break;
+    }
+    const smsimd_kernels_t* kernels = smsimd_kernels_for_level( supported ? level : best );
+    SMSIMD_KERNELS_STORE( kernels );
+    return kernels->level;
+}
+
+const smsimd_kernels_t* smsimd_kernels() {
+    const smsimd_kernels_t* kernels = SMSIMD_KERNELS_LOAD();
+    if( !kernels ) {
+        kernels = smsimd_kernels_for_level( smsimd_best_level( smsimd_detect() ) );
+        SMSIMD_KERNELS_STORE( kernels );
+    }
+    return kernels;
+}
+
+void smsimd_add_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    smsimd_kernels()->add_n( lhs, rhs, out, count );
+}
+void smsimd_sub_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    smsimd_kernels()->sub_n( lhs, rhs, out, count );
+}
+void smsimd_mul_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    smsimd_kernels()->mul_n( lhs, rhs, out, count );
+}
+void smsimd_div_n( const f32* lhs, const f32* rhs, f32* out, usize count ) {
+    smsimd_kernels()->div_n( lhs, rhs, out, count );
+}
+void smsimd_sqrt_n( const f32* x, f32* out, usize count ) {
+    smsimd_kernels()->sqrt_n( x, out, count );
+}
+void smsimd_scale_n( const f32* x, f32 scalar, f32* out, usize count ) {
+    smsimd_kernels()->scale_n( x, scalar, out, count );
+}
+f32 smsimd_sum_n( const f32* x, usize count ) {
+    return smsimd_kernels()->sum_n( x, count );
+}
 
 #if defined(__cplusplus)
     } // namespace smath::simd
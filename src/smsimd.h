@@ -3,9 +3,19 @@
  * Author:       Alicia Amarilla (smushyaa@gmail.com)
  * File Created: March 06, 2023
  * Notes:        set SMUSHY_SIMD_WIDTH to 1, 4, 8
- *               1 == scalar, 4 == SSE4/NEON, 8 == AVX
+ *               1 == scalar, 4 == SSE4.1/NEON, 8 == AVX2
  *               Default: 1
  *               otherwise uses scalar operations
+ *               width 8 on arm and width 4/8 on unknown
+ *               architectures fall back to what's available
+ *               lane8f_t is always available, if width is less than 8
+ *               it's made up of two lane4f_t halves,
+ *               same for lane8i_t and lane8b_t
+ *               mask lanes (lane4b_t/lane8b_t) are all ones when
+ *               true and all zeroes when false
+ * Includes:     <arm_neon.h> ARM ONLY
+ *               <immintrin.h> x86 C++ ONLY, lane definitions
+ *               are included from smsimd_lanes.inl in C++
 */
 #if !defined(SMUSHY_SIMD_ABS)
 #define SMUSHY_SIMD_ABS
@@ -16,15 +26,56 @@
     #define SMUSHY_SIMD_WIDTH 1
 #endif
 
+// NOTE(alicia): no simd backend for this architecture, use scalar
+#if SMUSHY_SIMD_WIDTH != 1 && !defined(SM_ARCH_X86) && !defined(SM_ARCH_ARM)
+    #undef SMUSHY_SIMD_WIDTH
+    #define SMUSHY_SIMD_WIDTH 1
+#endif
+
+// NOTE(alicia): NEON is only four-wide
+#if defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH > 4
+    #undef SMUSHY_SIMD_WIDTH
+    #define SMUSHY_SIMD_WIDTH 4
+#endif
+
 #if defined(SM_ARCH_X86)
     #if SMUSHY_SIMD_WIDTH >= 4
         typedef __attribute((vector_size(16))) float __m128;
+        typedef __attribute((vector_size(16))) long long __m128i;
     #endif
     #if SMUSHY_SIMD_WIDTH >= 8
         typedef __attribute((vector_size(32))) float __m256;
+        typedef __attribute((vector_size(32))) long long __m256i;
     #endif
 #endif // simd::x86
 
+#if defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+    #include <arm_neon.h>
+#endif // simd::arm
+
+// NOTE(alicia): compile-time lane shuffles go through the compiler's
+// vector extensions so the header doesn't need the intrinsics headers
+#if SMUSHY_SIMD_WIDTH != 1
+    #if defined(SM_COMPILER_CLANG) || (defined(SM_COMPILER_GCC) && __GNUC__ >= 12)
+        #define SMSIMD_SHUFFLE4( a, b, i, j, k, l ) \
+            __builtin_shufflevector( a, b, i, j, k, l )
+        #define SMSIMD_SHUFFLE8( a, b, i0, i1, i2, i3, i4, i5, i6, i7 ) \
+            __builtin_shufflevector( a, b, i0, i1, i2, i3, i4, i5, i6, i7 )
+    #else
+        typedef __attribute((vector_size(16))) i32 smsimd_index4_t;
+        typedef __attribute((vector_size(32))) i32 smsimd_index8_t;
+        #define SMSIMD_SHUFFLE4( a, b, i, j, k, l ) \
+            __builtin_shuffle( a, b, (smsimd_index4_t){ i, j, k, l } )
+        #define SMSIMD_SHUFFLE8( a, b, i0, i1, i2, i3, i4, i5, i6, i7 ) \
+            __builtin_shuffle( a, b, (smsimd_index8_t){ i0, i1, i2, i3, i4, i5, i6, i7 } )
+    #endif
+#endif
+
+// NOTE(alicia): definitions live in smsimd_lanes.inl,
+// C++ includes it at the end of this header so every translation unit
+// can inline lane functions, C calls the external definitions in smsimd.c
+#define SMSIMD_INLINE inline
+
 #if defined(__cplusplus)
 namespace smath {
 
@@ -37,85 +88,754 @@ typedef struct lane4f_t {
         f32 value[4];
         struct { f32 a, b, c, d; };
 
-    #if defined(SM_CURRENT_PLATFORM_X86) && SMUSHY_SIMD_WIDTH >= 4
+    #if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
         __m128 simd;
-    #endif // x86 SSE
+    #elif defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+        float32x4_t simd;
+    #endif // x86 SSE / arm NEON
     };
 
 #if defined(__cplusplus)
 
-    f32& operator[](u32 index);
-    f32  operator[](u32 index) const;
+    SMSIMD_INLINE f32& operator[](u32 index);
+    SMSIMD_INLINE f32  operator[](u32 index) const;
 
-    lane4f_t& operator+=( const lane4f_t& rhs );
-    lane4f_t& operator-=( const lane4f_t& rhs );
-    lane4f_t& operator*=( const lane4f_t& rhs );
-    lane4f_t& operator/=( const lane4f_t& rhs );
+    SMSIMD_INLINE lane4f_t& operator+=( const lane4f_t& rhs );
+    SMSIMD_INLINE lane4f_t& operator-=( const lane4f_t& rhs );
+    SMSIMD_INLINE lane4f_t& operator*=( const lane4f_t& rhs );
+    SMSIMD_INLINE lane4f_t& operator/=( const lane4f_t& rhs );
 
 #endif // c++
 } lane4f_t;
 
 #if defined(__cplusplus)
-    lane4f_t operator+( const lane4f_t& lhs, const lane4f_t& rhs );
-    lane4f_t operator-( const lane4f_t& lhs, const lane4f_t& rhs );
-    lane4f_t operator*( const lane4f_t& lhs, const lane4f_t& rhs );
-    lane4f_t operator/( const lane4f_t& lhs, const lane4f_t& rhs );
+    SMSIMD_INLINE lane4f_t operator+( const lane4f_t& lhs, const lane4f_t& rhs );
+    SMSIMD_INLINE lane4f_t operator-( const lane4f_t& lhs, const lane4f_t& rhs );
+    SMSIMD_INLINE lane4f_t operator*( const lane4f_t& lhs, const lane4f_t& rhs );
+    SMSIMD_INLINE lane4f_t operator/( const lane4f_t& lhs, const lane4f_t& rhs );
 #endif
 
 /// set four-wide vector components
-inline lane4f_t lane4f_set( f32 a, f32 b, f32 c, f32 d );
+SMSIMD_INLINE lane4f_t lane4f_set( f32 a, f32 b, f32 c, f32 d );
 /// set four-wide vector components to the same value
-inline lane4f_t lane4f_set_scalar( f32 scalar );
+SMSIMD_INLINE lane4f_t lane4f_set_scalar( f32 scalar );
 /// set four-wide vector components to zero
-inline lane4f_t lane4f_set_zero();
-/// load components for four-wide vector from array
-inline lane4f_t lane4f_load( const f32* load_array );
+SMSIMD_INLINE lane4f_t lane4f_set_zero();
+/// load components for four-wide vector from array,
+/// array must be 16-byte aligned, same as lane4f_load_aligned
+SMSIMD_INLINE lane4f_t lane4f_load( const f32* load_array );
+/// load components for four-wide vector from 16-byte aligned array
+SMSIMD_INLINE lane4f_t lane4f_load_aligned( const f32* load_array );
+/// load components for four-wide vector from array with any alignment
+SMSIMD_INLINE lane4f_t lane4f_load_unaligned( const f32* load_array );
+/// load first count components (at most 4) from array with any alignment,
+/// remaining components are zero, never reads past load_array[count - 1]
+SMSIMD_INLINE lane4f_t lane4f_load_partial( const f32* load_array, usize count );
 /// add four-wide vectors
-inline lane4f_t lane4f_add( lane4f_t lhs, lane4f_t rhs );
+SMSIMD_INLINE lane4f_t lane4f_add( lane4f_t lhs, lane4f_t rhs );
 /// subtract four-wide vectors
-inline lane4f_t lane4f_sub( lane4f_t lhs, lane4f_t rhs );
+SMSIMD_INLINE lane4f_t lane4f_sub( lane4f_t lhs, lane4f_t rhs );
 /// multiply four-wide vectors
-inline lane4f_t lane4f_mul( lane4f_t lhs, lane4f_t rhs );
+SMSIMD_INLINE lane4f_t lane4f_mul( lane4f_t lhs, lane4f_t rhs );
 /// divide four-wide vectors
-inline lane4f_t lane4f_div( lane4f_t lhs, lane4f_t rhs );
+SMSIMD_INLINE lane4f_t lane4f_div( lane4f_t lhs, lane4f_t rhs );
 /// sqrt four-wide vector components
-inline lane4f_t lane4f_sqrt( lane4f_t x );
-/// store four-wide vector components in array
-inline void lane4f_store( lane4f_t registers, f32* store_array );
-
-// struct lane8f {
-//     union {
-//         struct { f32 a, b, c, d, e, f, g, h; };
-// #if defined(SMUSHY_SIMD_ENABLED)
-//
-// #if defined(SMUSHY_X86_64_PLATFORM)
-//         __m256 simd;
-// #endif // simd::x86
-//
-// #endif // simd
-//     };
-//
-//     lane8f();
-//     lane8f( f32 a, f32 b, f32 c, f32 d, f32 e, f32 f, f32 g, f32 h );
-//     lane8f( f32 scalar );
-//     lane8f( const f32* eight_wide_array );
-//
-//     f32& operator[]( u32 index );
-//     f32  operator[]( u32 index ) const;
-//     lane8f& operator+=( const lane8f& rhs );
-//     lane8f& operator-=( const lane8f& rhs );
-//     lane8f& operator*=( const lane8f& rhs );
-//     lane8f& operator/=( const lane8f& rhs );
-// };
-// lane8f operator+( const lane8f& lhs, const lane8f& rhs );
-// lane8f operator-( const lane8f& lhs, const lane8f& rhs );
-// lane8f operator*( const lane8f& lhs, const lane8f& rhs );
-// lane8f operator/( const lane8f& lhs, const lane8f& rhs );
-// lane8f sqrt( lane8f x );
-// void store( f32* eight_wide_array, lane8f registers );
-// lane4f extract_high( lane8f a );
-// lane4f extract_low( lane8f a );
-//
+SMSIMD_INLINE lane4f_t lane4f_sqrt( lane4f_t x );
+/// multiply then add four-wide vectors, a * b + c,
+/// single rounding when the target has fma (FMA3/NEON aarch64)
+SMSIMD_INLINE lane4f_t lane4f_fmadd( lane4f_t a, lane4f_t b, lane4f_t c );
+/// multiply then subtract four-wide vectors, a * b - c
+SMSIMD_INLINE lane4f_t lane4f_fmsub( lane4f_t a, lane4f_t b, lane4f_t c );
+/// negated multiply then add four-wide vectors, c - a * b
+SMSIMD_INLINE lane4f_t lane4f_fnmadd( lane4f_t a, lane4f_t b, lane4f_t c );
+/// sum of four-wide vector components
+SMSIMD_INLINE f32 lane4f_hadd( lane4f_t x );
+/// smallest four-wide vector component
+SMSIMD_INLINE f32 lane4f_hmin( lane4f_t x );
+/// largest four-wide vector component
+SMSIMD_INLINE f32 lane4f_hmax( lane4f_t x );
+/// dot product of four-wide vectors
+SMSIMD_INLINE f32 lane4f_dot4( lane4f_t lhs, lane4f_t rhs );
+/// interleave low halves of four-wide vectors, { lhs.a, rhs.a, lhs.b, rhs.b }
+SMSIMD_INLINE lane4f_t lane4f_unpacklo( lane4f_t lhs, lane4f_t rhs );
+/// interleave high halves of four-wide vectors, { lhs.c, rhs.c, lhs.d, rhs.d }
+SMSIMD_INLINE lane4f_t lane4f_unpackhi( lane4f_t lhs, lane4f_t rhs );
+/// transpose four four-wide vectors in place, rows[i][j] becomes rows[j][i]
+SMSIMD_INLINE void lane4f_transpose4x4( lane4f_t rows[4] );
+
+/// compile-time shuffle of four-wide vector, { x[i], x[j], x[k], x[l] },
+/// indices must be constants in [0, 4)
+#if SMUSHY_SIMD_WIDTH == 1
+    #define LANE4F_SHUFFLE( x, i, j, k, l )\
+        lane4f_set( (x).value[i], (x).value[j], (x).value[k], (x).value[l] )
+#elif defined(__cplusplus)
+    #define LANE4F_SHUFFLE( x, i, j, k, l )\
+        lane4f_shuffle<i, j, k, l>( x )
+#else
+    #define LANE4F_SHUFFLE( x, i, j, k, l )\
+        ((lane4f_t){ .simd = SMSIMD_SHUFFLE4( (x).simd, (x).simd, i, j, k, l ) })
+#endif
+
+#if defined(__cplusplus)
+/// compile-time shuffle of four-wide vector, { x[i], x[j], x[k], x[l] }
+template<u32 i, u32 j, u32 k, u32 l>
+SMSIMD_INLINE lane4f_t lane4f_shuffle( lane4f_t x ) {
+    static_assert( i < 4 && j < 4 && k < 4 && l < 4, "shuffle index out of range!" );
+    lane4f_t result;
+#if SMUSHY_SIMD_WIDTH == 1
+    result.a = x.value[i];
+    result.b = x.value[j];
+    result.c = x.value[k];
+    result.d = x.value[l];
+#else
+    result.simd = SMSIMD_SHUFFLE4( x.simd, x.simd, i, j, k, l );
+#endif
+    return result;
+}
+#endif // c++
+
+/// compile-time shuffle of two four-wide vectors, { a[i], a[j], b[k], b[l] },
+/// indices must be constants in [0, 4)
+#if SMUSHY_SIMD_WIDTH == 1
+    #define LANE4F_SHUFFLE2( a, b, i, j, k, l )\
+        lane4f_set( (a).value[i], (a).value[j], (b).value[k], (b).value[l] )
+#elif defined(__cplusplus)
+    #define LANE4F_SHUFFLE2( a, b, i, j, k, l )\
+        lane4f_shuffle2<i, j, k, l>( a, b )
+#else
+    #define LANE4F_SHUFFLE2( a, b, i, j, k, l )\
+        ((lane4f_t){ .simd = SMSIMD_SHUFFLE4( (a).simd, (b).simd, i, j, (k) + 4, (l) + 4 ) })
+#endif
+
+#if defined(__cplusplus)
+/// compile-time shuffle of two four-wide vectors, { a[i], a[j], b[k], b[l] }
+template<u32 i, u32 j, u32 k, u32 l>
+SMSIMD_INLINE lane4f_t lane4f_shuffle2( lane4f_t a, lane4f_t b ) {
+    static_assert( i < 4 && j < 4 && k < 4 && l < 4, "shuffle index out of range!" );
+    lane4f_t result;
+#if SMUSHY_SIMD_WIDTH == 1
+    result.a = a.value[i];
+    result.b = a.value[j];
+    result.c = b.value[k];
+    result.d = b.value[l];
+#else
+    result.simd = SMSIMD_SHUFFLE4( a.simd, b.simd, i, j, k + 4, l + 4 );
+#endif
+    return result;
+}
+#endif // c++
+/// store four-wide vector components in array,
+/// array must be 16-byte aligned, same as lane4f_store_aligned
+SMSIMD_INLINE void lane4f_store( lane4f_t registers, f32* store_array );
+/// store four-wide vector components in 16-byte aligned array
+SMSIMD_INLINE void lane4f_store_aligned( lane4f_t registers, f32* store_array );
+/// store four-wide vector components in array with any alignment
+SMSIMD_INLINE void lane4f_store_unaligned( lane4f_t registers, f32* store_array );
+/// store first count components (at most 4) in array with any alignment,
+/// never writes past store_array[count - 1]
+SMSIMD_INLINE void lane4f_store_partial( lane4f_t registers, f32* store_array, usize count );
+/// store four-wide vector components in 16-byte aligned array bypassing the cache,
+/// call smsimd_stream_fence before other threads read the array
+SMSIMD_INLINE void lane4f_stream_store( lane4f_t registers, f32* store_array );
+
+/// four-wide 32-bit integer vector
+typedef struct lane4i_t {
+    union {
+        i32 value[4];
+        struct { i32 a, b, c, d; };
+
+    #if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
+        __m128i simd;
+    #elif defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+        int32x4_t simd;
+    #endif // x86 SSE / arm NEON
+    };
+
+#if defined(__cplusplus)
+
+    SMSIMD_INLINE i32& operator[](u32 index);
+    SMSIMD_INLINE i32  operator[](u32 index) const;
+
+    SMSIMD_INLINE lane4i_t& operator+=( const lane4i_t& rhs );
+    SMSIMD_INLINE lane4i_t& operator-=( const lane4i_t& rhs );
+    SMSIMD_INLINE lane4i_t& operator*=( const lane4i_t& rhs );
+
+#endif // c++
+} lane4i_t;
+
+#if defined(__cplusplus)
+    SMSIMD_INLINE lane4i_t operator+( const lane4i_t& lhs, const lane4i_t& rhs );
+    SMSIMD_INLINE lane4i_t operator-( const lane4i_t& lhs, const lane4i_t& rhs );
+    SMSIMD_INLINE lane4i_t operator*( const lane4i_t& lhs, const lane4i_t& rhs );
+#endif
+
+/// four-wide mask vector
+typedef struct lane4b_t {
+    union {
+        u32 value[4];
+        struct { u32 a, b, c, d; };
+
+    #if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
+        __m128i simd;
+    #elif defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+        uint32x4_t simd;
+    #endif // x86 SSE / arm NEON
+    };
+} lane4b_t;
+
+/// set four-wide integer vector components
+SMSIMD_INLINE lane4i_t lane4i_set( i32 a, i32 b, i32 c, i32 d );
+/// set four-wide integer vector components to the same value
+SMSIMD_INLINE lane4i_t lane4i_set_scalar( i32 scalar );
+/// set four-wide integer vector components to zero
+SMSIMD_INLINE lane4i_t lane4i_set_zero();
+/// load components for four-wide integer vector from 16-byte aligned array
+SMSIMD_INLINE lane4i_t lane4i_load( const i32* load_array );
+/// load components for four-wide integer vector from array with any alignment
+SMSIMD_INLINE lane4i_t lane4i_load_unaligned( const i32* load_array );
+/// store four-wide integer vector components in 16-byte aligned array
+SMSIMD_INLINE void lane4i_store( lane4i_t registers, i32* store_array );
+/// store four-wide integer vector components in array with any alignment
+SMSIMD_INLINE void lane4i_store_unaligned( lane4i_t registers, i32* store_array );
+/// add four-wide integer vectors, wraps on overflow
+SMSIMD_INLINE lane4i_t lane4i_add( lane4i_t lhs, lane4i_t rhs );
+/// subtract four-wide integer vectors, wraps on overflow
+SMSIMD_INLINE lane4i_t lane4i_sub( lane4i_t lhs, lane4i_t rhs );
+/// multiply four-wide integer vectors, keeps low 32 bits
+SMSIMD_INLINE lane4i_t lane4i_mul( lane4i_t lhs, lane4i_t rhs );
+/// component-wise minimum of four-wide integer vectors
+SMSIMD_INLINE lane4i_t lane4i_min( lane4i_t lhs, lane4i_t rhs );
+/// component-wise maximum of four-wide integer vectors
+SMSIMD_INLINE lane4i_t lane4i_max( lane4i_t lhs, lane4i_t rhs );
+/// absolute value of four-wide integer vector components
+SMSIMD_INLINE lane4i_t lane4i_abs( lane4i_t x );
+/// bitwise and of four-wide integer vectors
+SMSIMD_INLINE lane4i_t lane4i_and( lane4i_t lhs, lane4i_t rhs );
+/// bitwise or of four-wide integer vectors
+SMSIMD_INLINE lane4i_t lane4i_or( lane4i_t lhs, lane4i_t rhs );
+/// bitwise xor of four-wide integer vectors
+SMSIMD_INLINE lane4i_t lane4i_xor( lane4i_t lhs, lane4i_t rhs );
+/// bitwise lhs and not rhs of four-wide integer vectors
+SMSIMD_INLINE lane4i_t lane4i_andnot( lane4i_t lhs, lane4i_t rhs );
+/// bitwise not of four-wide integer vector
+SMSIMD_INLINE lane4i_t lane4i_not( lane4i_t x );
+/// shift four-wide integer vector components left
+SMSIMD_INLINE lane4i_t lane4i_shift_left( lane4i_t x, u32 count );
+/// shift four-wide integer vector components right, keeps sign
+SMSIMD_INLINE lane4i_t lane4i_shift_right( lane4i_t x, u32 count );
+/// shift four-wide integer vector components right, fills with zeroes
+SMSIMD_INLINE lane4i_t lane4i_shift_right_logical( lane4i_t x, u32 count );
+/// compare four-wide integer vectors, lhs == rhs
+SMSIMD_INLINE lane4b_t lane4i_cmp_eq( lane4i_t lhs, lane4i_t rhs );
+/// compare four-wide integer vectors, lhs > rhs
+SMSIMD_INLINE lane4b_t lane4i_cmp_gt( lane4i_t lhs, lane4i_t rhs );
+/// compare four-wide integer vectors, lhs < rhs
+SMSIMD_INLINE lane4b_t lane4i_cmp_lt( lane4i_t lhs, lane4i_t rhs );
+/// pick components from if_true where mask is set, if_false otherwise
+SMSIMD_INLINE lane4i_t lane4i_select( lane4b_t mask, lane4i_t if_true, lane4i_t if_false );
+/// convert four-wide integer vector to floating-point
+SMSIMD_INLINE lane4f_t lane4i_to_lane4f( lane4i_t x );
+/// reinterpret bits of four-wide integer vector as floating-point
+SMSIMD_INLINE lane4f_t lane4i_as_lane4f( lane4i_t x );
+
+/// compare four-wide vectors, lhs == rhs
+SMSIMD_INLINE lane4b_t lane4f_cmp_eq( lane4f_t lhs, lane4f_t rhs );
+/// compare four-wide vectors, lhs != rhs, true if either is NaN
+SMSIMD_INLINE lane4b_t lane4f_cmp_neq( lane4f_t lhs, lane4f_t rhs );
+/// compare four-wide vectors, lhs < rhs
+SMSIMD_INLINE lane4b_t lane4f_cmp_lt( lane4f_t lhs, lane4f_t rhs );
+/// compare four-wide vectors, lhs <= rhs
+SMSIMD_INLINE lane4b_t lane4f_cmp_le( lane4f_t lhs, lane4f_t rhs );
+/// compare four-wide vectors, lhs > rhs
+SMSIMD_INLINE lane4b_t lane4f_cmp_gt( lane4f_t lhs, lane4f_t rhs );
+/// compare four-wide vectors, lhs >= rhs
+SMSIMD_INLINE lane4b_t lane4f_cmp_ge( lane4f_t lhs, lane4f_t rhs );
+/// pick components from if_true where mask is set, if_false otherwise
+SMSIMD_INLINE lane4f_t lane4f_select( lane4b_t mask, lane4f_t if_true, lane4f_t if_false );
+/// component-wise minimum of four-wide vectors, NaN handling is platform specific
+SMSIMD_INLINE lane4f_t lane4f_min( lane4f_t lhs, lane4f_t rhs );
+/// component-wise maximum of four-wide vectors, NaN handling is platform specific
+SMSIMD_INLINE lane4f_t lane4f_max( lane4f_t lhs, lane4f_t rhs );
+/// absolute value of four-wide vector components
+SMSIMD_INLINE lane4f_t lane4f_abs( lane4f_t x );
+/// floor four-wide vector components
+SMSIMD_INLINE lane4f_t lane4f_floor( lane4f_t x );
+/// ceil four-wide vector components
+SMSIMD_INLINE lane4f_t lane4f_ceil( lane4f_t x );
+/// round four-wide vector components to nearest, ties to even
+SMSIMD_INLINE lane4f_t lane4f_round( lane4f_t x );
+/// convert four-wide vector to integer, truncates towards zero,
+/// NaN and values outside of i32 range give INT32_MIN (NEON saturates instead, NaN gives 0)
+SMSIMD_INLINE lane4i_t lane4f_to_lane4i( lane4f_t x );
+/// reinterpret bits of four-wide vector as integer
+SMSIMD_INLINE lane4i_t lane4f_as_lane4i( lane4f_t x );
+/// load base[indices[i] * stride] into each four-wide vector component,
+/// stride is counted in elements so indices can walk arrays of structs
+SMSIMD_INLINE lane4f_t lane4f_gather( const f32* base, lane4i_t indices, u32 stride );
+/// store each four-wide vector component to base[indices[i] * stride],
+/// with duplicate indices the highest component wins
+SMSIMD_INLINE void lane4f_scatter( f32* base, lane4i_t indices, u32 stride, lane4f_t values );
+/// load base[indices[i] * stride] into each four-wide integer vector component
+SMSIMD_INLINE lane4i_t lane4i_gather( const i32* base, lane4i_t indices, u32 stride );
+/// store each four-wide integer vector component to base[indices[i] * stride],
+/// with duplicate indices the highest component wins
+SMSIMD_INLINE void lane4i_scatter( i32* base, lane4i_t indices, u32 stride, lane4i_t values );
+
+/// set four-wide mask components
+SMSIMD_INLINE lane4b_t lane4b_set( bool32 a, bool32 b, bool32 c, bool32 d );
+/// and four-wide masks
+SMSIMD_INLINE lane4b_t lane4b_and( lane4b_t lhs, lane4b_t rhs );
+/// or four-wide masks
+SMSIMD_INLINE lane4b_t lane4b_or( lane4b_t lhs, lane4b_t rhs );
+/// xor four-wide masks
+SMSIMD_INLINE lane4b_t lane4b_xor( lane4b_t lhs, lane4b_t rhs );
+/// not four-wide mask
+SMSIMD_INLINE lane4b_t lane4b_not( lane4b_t x );
+/// check if any four-wide mask component is set
+SMSIMD_INLINE bool32 lane4b_any( lane4b_t x );
+/// check if all four-wide mask components are set
+SMSIMD_INLINE bool32 lane4b_all( lane4b_t x );
+/// pack four-wide mask into the low four bits of an integer
+SMSIMD_INLINE u32 lane4b_bitmask( lane4b_t x );
+
+/// sine of four-wide vector components, max error 1.5 ulp for |x| <= pi,
+/// absolute error under 1e-7 for |x| < 8192, accuracy degrades past that
+SMSIMD_INLINE lane4f_t lane4f_sin( lane4f_t x );
+/// cosine of four-wide vector components, max error 1.5 ulp for |x| <= pi,
+/// absolute error under 1e-7 for |x| < 8192, accuracy degrades past that
+SMSIMD_INLINE lane4f_t lane4f_cos( lane4f_t x );
+/// sine and cosine of four-wide vector components, same error as lane4f_sin/lane4f_cos
+SMSIMD_INLINE void lane4f_sincos( lane4f_t x, lane4f_t* out_sin, lane4f_t* out_cos );
+/// e^x of four-wide vector components, max error 1 ulp,
+/// saturates outside of [-87.33, 88.37], no denormal results
+SMSIMD_INLINE lane4f_t lane4f_exp( lane4f_t x );
+/// natural log of four-wide vector components, max error 1 ulp,
+/// denormals are treated as the smallest normal
+SMSIMD_INLINE lane4f_t lane4f_log( lane4f_t x );
+/// base^exponent of four-wide vector components, computed as exp(exponent * log(base)),
+/// max error 2 ulp for |exponent * log(base)| < 1, grows by about 2.5 ulp per unit after that,
+/// negative base gives NaN
+SMSIMD_INLINE lane4f_t lane4f_pow( lane4f_t base, lane4f_t exponent );
+/// arc tangent of y/x of four-wide vector components using signs to pick the quadrant,
+/// max error 4 ulp
+SMSIMD_INLINE lane4f_t lane4f_atan2( lane4f_t y, lane4f_t x );
+/// arc cosine of four-wide vector components, inputs are clamped to [-1, 1]
+/// so dot products that drift past 1 don't give NaN, max error 2 ulp
+SMSIMD_INLINE lane4f_t lane4f_acos( lane4f_t x );
+
+/// eight-wide floating-point vector
+typedef struct lane8f_t {
+    union {
+        f32 value[8];
+        struct { f32 a, b, c, d, e, f, g, h; };
+
+    #if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+        __m256 simd;
+    #else
+        struct { lane4f_t low, high; };
+    #endif // x86 AVX
+    };
+
+#if defined(__cplusplus)
+
+    SMSIMD_INLINE f32& operator[](u32 index);
+    SMSIMD_INLINE f32  operator[](u32 index) const;
+
+    SMSIMD_INLINE lane8f_t& operator+=( const lane8f_t& rhs );
+    SMSIMD_INLINE lane8f_t& operator-=( const lane8f_t& rhs );
+    SMSIMD_INLINE lane8f_t& operator*=( const lane8f_t& rhs );
+    SMSIMD_INLINE lane8f_t& operator/=( const lane8f_t& rhs );
+
+#endif // c++
+} lane8f_t;
+
+#if defined(__cplusplus)
+    SMSIMD_INLINE lane8f_t operator+( const lane8f_t& lhs, const lane8f_t& rhs );
+    SMSIMD_INLINE lane8f_t operator-( const lane8f_t& lhs, const lane8f_t& rhs );
+    SMSIMD_INLINE lane8f_t operator*( const lane8f_t& lhs, const lane8f_t& rhs );
+    SMSIMD_INLINE lane8f_t operator/( const lane8f_t& lhs, const lane8f_t& rhs );
+#endif
+
+/// set eight-wide vector components
+SMSIMD_INLINE lane8f_t lane8f_set( f32 a, f32 b, f32 c, f32 d, f32 e, f32 f, f32 g, f32 h );
+/// set eight-wide vector components to the same value
+SMSIMD_INLINE lane8f_t lane8f_set_scalar( f32 scalar );
+/// set eight-wide vector components to zero
+SMSIMD_INLINE lane8f_t lane8f_set_zero();
+/// create eight-wide vector from two four-wide vectors
+SMSIMD_INLINE lane8f_t lane8f_combine( lane4f_t low, lane4f_t high );
+/// load components for eight-wide vector from array,
+/// array must be 32-byte aligned, same as lane8f_load_aligned
+SMSIMD_INLINE lane8f_t lane8f_load( const f32* load_array );
+/// load components for eight-wide vector from 32-byte aligned array
+SMSIMD_INLINE lane8f_t lane8f_load_aligned( const f32* load_array );
+/// load components for eight-wide vector from array with any alignment
+SMSIMD_INLINE lane8f_t lane8f_load_unaligned( const f32* load_array );
+/// load first count components (at most 8) from array with any alignment,
+/// remaining components are zero, never reads past load_array[count - 1]
+SMSIMD_INLINE lane8f_t lane8f_load_partial( const f32* load_array, usize count );
+/// add eight-wide vectors
+SMSIMD_INLINE lane8f_t lane8f_add( lane8f_t lhs, lane8f_t rhs );
+/// subtract eight-wide vectors
+SMSIMD_INLINE lane8f_t lane8f_sub( lane8f_t lhs, lane8f_t rhs );
+/// multiply eight-wide vectors
+SMSIMD_INLINE lane8f_t lane8f_mul( lane8f_t lhs, lane8f_t rhs );
+/// divide eight-wide vectors
+SMSIMD_INLINE lane8f_t lane8f_div( lane8f_t lhs, lane8f_t rhs );
+/// sqrt eight-wide vector components
+SMSIMD_INLINE lane8f_t lane8f_sqrt( lane8f_t x );
+/// multiply then add eight-wide vectors, a * b + c,
+/// single rounding when the target has fma (FMA3/NEON aarch64)
+SMSIMD_INLINE lane8f_t lane8f_fmadd( lane8f_t a, lane8f_t b, lane8f_t c );
+/// multiply then subtract eight-wide vectors, a * b - c
+SMSIMD_INLINE lane8f_t lane8f_fmsub( lane8f_t a, lane8f_t b, lane8f_t c );
+/// negated multiply then add eight-wide vectors, c - a * b
+SMSIMD_INLINE lane8f_t lane8f_fnmadd( lane8f_t a, lane8f_t b, lane8f_t c );
+/// sum of eight-wide vector components
+SMSIMD_INLINE f32 lane8f_hadd( lane8f_t x );
+/// smallest eight-wide vector component
+SMSIMD_INLINE f32 lane8f_hmin( lane8f_t x );
+/// largest eight-wide vector component
+SMSIMD_INLINE f32 lane8f_hmax( lane8f_t x );
+/// interleave low halves of each four-wide half of eight-wide vectors,
+/// { lhs.a, rhs.a, lhs.b, rhs.b, lhs.e, rhs.e, lhs.f, rhs.f }
+SMSIMD_INLINE lane8f_t lane8f_unpacklo( lane8f_t lhs, lane8f_t rhs );
+/// interleave high halves of each four-wide half of eight-wide vectors,
+/// { lhs.c, rhs.c, lhs.d, rhs.d, lhs.g, rhs.g, lhs.h, rhs.h }
+SMSIMD_INLINE lane8f_t lane8f_unpackhi( lane8f_t lhs, lane8f_t rhs );
+/// transpose eight eight-wide vectors in place, rows[i][j] becomes rows[j][i]
+SMSIMD_INLINE void lane8f_transpose8x8( lane8f_t rows[8] );
+
+/// compile-time shuffle of eight-wide vector, { x[i0], x[i1], ... x[i7] },
+/// indices must be constants in [0, 8)
+#if SMUSHY_SIMD_WIDTH == 1
+    #define LANE8F_SHUFFLE( x, i0, i1, i2, i3, i4, i5, i6, i7 )\
+        lane8f_set(\
+            (x).value[i0], (x).value[i1], (x).value[i2], (x).value[i3],\
+            (x).value[i4], (x).value[i5], (x).value[i6], (x).value[i7] )
+#elif defined(__cplusplus)
+    #define LANE8F_SHUFFLE( x, i0, i1, i2, i3, i4, i5, i6, i7 )\
+        lane8f_shuffle<i0, i1, i2, i3, i4, i5, i6, i7>( x )
+#elif SMUSHY_SIMD_WIDTH == 8
+    #define LANE8F_SHUFFLE( x, i0, i1, i2, i3, i4, i5, i6, i7 )\
+        ((lane8f_t){ .simd = SMSIMD_SHUFFLE8( (x).simd, (x).simd, i0, i1, i2, i3, i4, i5, i6, i7 ) })
+#else
+    #define LANE8F_SHUFFLE( x, i0, i1, i2, i3, i4, i5, i6, i7 )\
+        lane8f_combine(\
+            ((lane4f_t){ .simd = SMSIMD_SHUFFLE4( (x).low.simd, (x).high.simd, i0, i1, i2, i3 ) }),\
+            ((lane4f_t){ .simd = SMSIMD_SHUFFLE4( (x).low.simd, (x).high.simd, i4, i5, i6, i7 ) }) )
+#endif
+
+#if defined(__cplusplus)
+/// compile-time shuffle of eight-wide vector, { x[i0], x[i1], ... x[i7] }
+template<u32 i0, u32 i1, u32 i2, u32 i3, u32 i4, u32 i5, u32 i6, u32 i7>
+SMSIMD_INLINE lane8f_t lane8f_shuffle( lane8f_t x ) {
+    static_assert(
+        i0 < 8 && i1 < 8 && i2 < 8 && i3 < 8 &&
+        i4 < 8 && i5 < 8 && i6 < 8 && i7 < 8, "shuffle index out of range!" );
+    lane8f_t result;
+#if SMUSHY_SIMD_WIDTH == 1
+    const u32 indices[8] = { i0, i1, i2, i3, i4, i5, i6, i7 };
+    for( u32 index = 0; index < 8; ++index ) {
+        result.value[index] = x.value[indices[index]];
+    }
+#elif SMUSHY_SIMD_WIDTH == 8
+    result.simd = SMSIMD_SHUFFLE8( x.simd, x.simd, i0, i1, i2, i3, i4, i5, i6, i7 );
+#else
+    // NOTE(alicia): two-source shuffle, indices 4-7 pick from the high half
+    result.low.simd  = SMSIMD_SHUFFLE4( x.low.simd, x.high.simd, i0, i1, i2, i3 );
+    result.high.simd = SMSIMD_SHUFFLE4( x.low.simd, x.high.simd, i4, i5, i6, i7 );
+#endif
+    return result;
+}
+#endif // c++
+/// store eight-wide vector components in array,
+/// array must be 32-byte aligned, same as lane8f_store_aligned
+SMSIMD_INLINE void lane8f_store( lane8f_t registers, f32* store_array );
+/// store eight-wide vector components in 32-byte aligned array
+SMSIMD_INLINE void lane8f_store_aligned( lane8f_t registers, f32* store_array );
+/// store eight-wide vector components in array with any alignment
+SMSIMD_INLINE void lane8f_store_unaligned( lane8f_t registers, f32* store_array );
+/// store first count components (at most 8) in array with any alignment,
+/// never writes past store_array[count - 1]
+SMSIMD_INLINE void lane8f_store_partial( lane8f_t registers, f32* store_array, usize count );
+/// store eight-wide vector components in 32-byte aligned array bypassing the cache,
+/// call smsimd_stream_fence before other threads read the array
+SMSIMD_INLINE void lane8f_stream_store( lane8f_t registers, f32* store_array );
+/// order stream stores before any stores that follow
+SMSIMD_INLINE void smsimd_stream_fence();
+/// get upper four components of eight-wide vector
+SMSIMD_INLINE lane4f_t lane8f_extract_high( lane8f_t x );
+/// get lower four components of eight-wide vector
+SMSIMD_INLINE lane4f_t lane8f_extract_low( lane8f_t x );
+
+/// eight-wide 32-bit integer vector
+typedef struct lane8i_t {
+    union {
+        i32 value[8];
+        struct { i32 a, b, c, d, e, f, g, h; };
+
+    #if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+        __m256i simd;
+    #else
+        struct { lane4i_t low, high; };
+    #endif // x86 AVX2
+    };
+
+#if defined(__cplusplus)
+
+    SMSIMD_INLINE i32& operator[](u32 index);
+    SMSIMD_INLINE i32  operator[](u32 index) const;
+
+    SMSIMD_INLINE lane8i_t& operator+=( const lane8i_t& rhs );
+    SMSIMD_INLINE lane8i_t& operator-=( const lane8i_t& rhs );
+    SMSIMD_INLINE lane8i_t& operator*=( const lane8i_t& rhs );
+
+#endif // c++
+} lane8i_t;
+
+#if defined(__cplusplus)
+    SMSIMD_INLINE lane8i_t operator+( const lane8i_t& lhs, const lane8i_t& rhs );
+    SMSIMD_INLINE lane8i_t operator-( const lane8i_t& lhs, const lane8i_t& rhs );
+    SMSIMD_INLINE lane8i_t operator*( const lane8i_t& lhs, const lane8i_t& rhs );
+#endif
+
+/// eight-wide mask vector
+typedef struct lane8b_t {
+    union {
+        u32 value[8];
+        struct { u32 a, b, c, d, e, f, g, h; };
+
+    #if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+        __m256i simd;
+    #else
+        struct { lane4b_t low, high; };
+    #endif // x86 AVX2
+    };
+} lane8b_t;
+
+/// set eight-wide integer vector components
+SMSIMD_INLINE lane8i_t lane8i_set( i32 a, i32 b, i32 c, i32 d, i32 e, i32 f, i32 g, i32 h );
+/// set eight-wide integer vector components to the same value
+SMSIMD_INLINE lane8i_t lane8i_set_scalar( i32 scalar );
+/// set eight-wide integer vector components to zero
+SMSIMD_INLINE lane8i_t lane8i_set_zero();
+/// create eight-wide integer vector from two four-wide integer vectors
+SMSIMD_INLINE lane8i_t lane8i_combine( lane4i_t low, lane4i_t high );
+/// load components for eight-wide integer vector from 32-byte aligned array
+SMSIMD_INLINE lane8i_t lane8i_load( const i32* load_array );
+/// load components for eight-wide integer vector from array with any alignment
+SMSIMD_INLINE lane8i_t lane8i_load_unaligned( const i32* load_array );
+/// store eight-wide integer vector components in 32-byte aligned array
+SMSIMD_INLINE void lane8i_store( lane8i_t registers, i32* store_array );
+/// store eight-wide integer vector components in array with any alignment
+SMSIMD_INLINE void lane8i_store_unaligned( lane8i_t registers, i32* store_array );
+/// get upper four components of eight-wide integer vector
+SMSIMD_INLINE lane4i_t lane8i_extract_high( lane8i_t x );
+/// get lower four components of eight-wide integer vector
+SMSIMD_INLINE lane4i_t lane8i_extract_low( lane8i_t x );
+/// add eight-wide integer vectors, wraps on overflow
+SMSIMD_INLINE lane8i_t lane8i_add( lane8i_t lhs, lane8i_t rhs );
+/// subtract eight-wide integer vectors, wraps on overflow
+SMSIMD_INLINE lane8i_t lane8i_sub( lane8i_t lhs, lane8i_t rhs );
+/// multiply eight-wide integer vectors, keeps low 32 bits
+SMSIMD_INLINE lane8i_t lane8i_mul( lane8i_t lhs, lane8i_t rhs );
+/// component-wise minimum of eight-wide integer vectors
+SMSIMD_INLINE lane8i_t lane8i_min( lane8i_t lhs, lane8i_t rhs );
+/// component-wise maximum of eight-wide integer vectors
+SMSIMD_INLINE lane8i_t lane8i_max( lane8i_t lhs, lane8i_t rhs );
+/// absolute value of eight-wide integer vector components
+SMSIMD_INLINE lane8i_t lane8i_abs( lane8i_t x );
+/// bitwise and of eight-wide integer vectors
+SMSIMD_INLINE lane8i_t lane8i_and( lane8i_t lhs, lane8i_t rhs );
+/// bitwise or of eight-wide integer vectors
+SMSIMD_INLINE lane8i_t lane8i_or( lane8i_t lhs, lane8i_t rhs );
+/// bitwise xor of eight-wide integer vectors
+SMSIMD_INLINE lane8i_t lane8i_xor( lane8i_t lhs, lane8i_t rhs );
+/// bitwise lhs and not rhs of eight-wide integer vectors
+SMSIMD_INLINE lane8i_t lane8i_andnot( lane8i_t lhs, lane8i_t rhs );
+/// bitwise not of eight-wide integer vector
+SMSIMD_INLINE lane8i_t lane8i_not( lane8i_t x );
+/// shift eight-wide integer vector components left
+SMSIMD_INLINE lane8i_t lane8i_shift_left( lane8i_t x, u32 count );
+/// shift eight-wide integer vector components right, keeps sign
+SMSIMD_INLINE lane8i_t lane8i_shift_right( lane8i_t x, u32 count );
+/// shift eight-wide integer vector components right, fills with zeroes
+SMSIMD_INLINE lane8i_t lane8i_shift_right_logical( lane8i_t x, u32 count );
+/// compare eight-wide integer vectors, lhs == rhs
+SMSIMD_INLINE lane8b_t lane8i_cmp_eq( lane8i_t lhs, lane8i_t rhs );
+/// compare eight-wide integer vectors, lhs > rhs
+SMSIMD_INLINE lane8b_t lane8i_cmp_gt( lane8i_t lhs, lane8i_t rhs );
+/// compare eight-wide integer vectors, lhs < rhs
+SMSIMD_INLINE lane8b_t lane8i_cmp_lt( lane8i_t lhs, lane8i_t rhs );
+/// pick components from if_true where mask is set, if_false otherwise
+SMSIMD_INLINE lane8i_t lane8i_select( lane8b_t mask, lane8i_t if_true, lane8i_t if_false );
+/// convert eight-wide integer vector to floating-point
+SMSIMD_INLINE lane8f_t lane8i_to_lane8f( lane8i_t x );
+/// reinterpret bits of eight-wide integer vector as floating-point
+SMSIMD_INLINE lane8f_t lane8i_as_lane8f( lane8i_t x );
+
+/// compare eight-wide vectors, lhs == rhs
+SMSIMD_INLINE lane8b_t lane8f_cmp_eq( lane8f_t lhs, lane8f_t rhs );
+/// compare eight-wide vectors, lhs != rhs, true if either is NaN
+SMSIMD_INLINE lane8b_t lane8f_cmp_neq( lane8f_t lhs, lane8f_t rhs );
+/// compare eight-wide vectors, lhs < rhs
+SMSIMD_INLINE lane8b_t lane8f_cmp_lt( lane8f_t lhs, lane8f_t rhs );
+/// compare eight-wide vectors, lhs <= rhs
+SMSIMD_INLINE lane8b_t lane8f_cmp_le( lane8f_t lhs, lane8f_t rhs );
+/// compare eight-wide vectors, lhs > rhs
+SMSIMD_INLINE lane8b_t lane8f_cmp_gt( lane8f_t lhs, lane8f_t rhs );
+/// compare eight-wide vectors, lhs >= rhs
+SMSIMD_INLINE lane8b_t lane8f_cmp_ge( lane8f_t lhs, lane8f_t rhs );
+/// pick components from if_true where mask is set, if_false otherwise
+SMSIMD_INLINE lane8f_t lane8f_select( lane8b_t mask, lane8f_t if_true, lane8f_t if_false );
+/// component-wise minimum of eight-wide vectors, NaN handling is platform specific
+SMSIMD_INLINE lane8f_t lane8f_min( lane8f_t lhs, lane8f_t rhs );
+/// component-wise maximum of eight-wide vectors, NaN handling is platform specific
+SMSIMD_INLINE lane8f_t lane8f_max( lane8f_t lhs, lane8f_t rhs );
+/// absolute value of eight-wide vector components
+SMSIMD_INLINE lane8f_t lane8f_abs( lane8f_t x );
+/// floor eight-wide vector components
+SMSIMD_INLINE lane8f_t lane8f_floor( lane8f_t x );
+/// ceil eight-wide vector components
+SMSIMD_INLINE lane8f_t lane8f_ceil( lane8f_t x );
+/// round eight-wide vector components to nearest, ties to even
+SMSIMD_INLINE lane8f_t lane8f_round( lane8f_t x );
+/// convert eight-wide vector to integer, truncates towards zero,
+/// NaN and values outside of i32 range give INT32_MIN (NEON saturates instead, NaN gives 0)
+SMSIMD_INLINE lane8i_t lane8f_to_lane8i( lane8f_t x );
+/// reinterpret bits of eight-wide vector as integer
+SMSIMD_INLINE lane8i_t lane8f_as_lane8i( lane8f_t x );
+/// load base[indices[i] * stride] into each eight-wide vector component,
+/// stride is counted in elements so indices can walk arrays of structs
+SMSIMD_INLINE lane8f_t lane8f_gather( const f32* base, lane8i_t indices, u32 stride );
+/// store each eight-wide vector component to base[indices[i] * stride],
+/// with duplicate indices the highest component wins
+SMSIMD_INLINE void lane8f_scatter( f32* base, lane8i_t indices, u32 stride, lane8f_t values );
+/// load base[indices[i] * stride] into each eight-wide integer vector component
+SMSIMD_INLINE lane8i_t lane8i_gather( const i32* base, lane8i_t indices, u32 stride );
+/// store each eight-wide integer vector component to base[indices[i] * stride],
+/// with duplicate indices the highest component wins
+SMSIMD_INLINE void lane8i_scatter( i32* base, lane8i_t indices, u32 stride, lane8i_t values );
+
+/// set eight-wide mask components
+SMSIMD_INLINE lane8b_t lane8b_set( bool32 a, bool32 b, bool32 c, bool32 d, bool32 e, bool32 f, bool32 g, bool32 h );
+/// and eight-wide masks
+SMSIMD_INLINE lane8b_t lane8b_and( lane8b_t lhs, lane8b_t rhs );
+/// or eight-wide masks
+SMSIMD_INLINE lane8b_t lane8b_or( lane8b_t lhs, lane8b_t rhs );
+/// xor eight-wide masks
+SMSIMD_INLINE lane8b_t lane8b_xor( lane8b_t lhs, lane8b_t rhs );
+/// not eight-wide mask
+SMSIMD_INLINE lane8b_t lane8b_not( lane8b_t x );
+/// check if any eight-wide mask component is set
+SMSIMD_INLINE bool32 lane8b_any( lane8b_t x );
+/// check if all eight-wide mask components are set
+SMSIMD_INLINE bool32 lane8b_all( lane8b_t x );
+/// pack eight-wide mask into the low eight bits of an integer
+SMSIMD_INLINE u32 lane8b_bitmask( lane8b_t x );
+
+/// sine of eight-wide vector components, max error 1.5 ulp for |x| <= pi,
+/// absolute error under 1e-7 for |x| < 8192, accuracy degrades past that
+SMSIMD_INLINE lane8f_t lane8f_sin( lane8f_t x );
+/// cosine of eight-wide vector components, max error 1.5 ulp for |x| <= pi,
+/// absolute error under 1e-7 for |x| < 8192, accuracy degrades past that
+SMSIMD_INLINE lane8f_t lane8f_cos( lane8f_t x );
+/// sine and cosine of eight-wide vector components, same error as lane8f_sin/lane8f_cos
+SMSIMD_INLINE void lane8f_sincos( lane8f_t x, lane8f_t* out_sin, lane8f_t* out_cos );
+/// e^x of eight-wide vector components, max error 1 ulp,
+/// saturates outside of [-87.33, 88.37], no denormal results
+SMSIMD_INLINE lane8f_t lane8f_exp( lane8f_t x );
+/// natural log of eight-wide vector components, max error 1 ulp,
+/// denormals are treated as the smallest normal
+SMSIMD_INLINE lane8f_t lane8f_log( lane8f_t x );
+/// base^exponent of eight-wide vector components, computed as exp(exponent * log(base)),
+/// max error 2 ulp for |exponent * log(base)| < 1, grows by about 2.5 ulp per unit after that,
+/// negative base gives NaN
+SMSIMD_INLINE lane8f_t lane8f_pow( lane8f_t base, lane8f_t exponent );
+/// arc tangent of y/x of eight-wide vector components using signs to pick the quadrant,
+/// max error 4 ulp
+SMSIMD_INLINE lane8f_t lane8f_atan2( lane8f_t y, lane8f_t x );
+/// arc cosine of eight-wide vector components, inputs are clamped to [-1, 1]
+/// so dot products that drift past 1 don't give NaN, max error 2 ulp
+SMSIMD_INLINE lane8f_t lane8f_acos( lane8f_t x );
+
+// NOTE(alicia): runtime dispatch
+// covers only the generic smsimd_*_n array kernels below, they are independent of
+// SMUSHY_SIMD_WIDTH and pick the best kernels the host cpu supports.
+// lane types and everything built on them are still fixed at compile time
+// by SMUSHY_SIMD_WIDTH and the target flags
+
+/// simd features supported by the host cpu
+typedef struct smsimd_features_t {
+    bool32 sse4;
+    bool32 avx;
+    bool32 avx2;
+    bool32 fma;
+    bool32 avx512;
+    bool32 neon;
+} smsimd_features_t;
+
+/// kernel table level
+typedef enum smsimd_level_t {
+    SMSIMD_LEVEL_SCALAR,
+    SMSIMD_LEVEL_SSE4,
+    SMSIMD_LEVEL_AVX2,
+    SMSIMD_LEVEL_AVX512,
+    SMSIMD_LEVEL_NEON,
+
+    SMSIMD_LEVEL_COUNT
+} smsimd_level_t;
+
+/// out[i] = lhs[i] op rhs[i]
+typedef void (*smsimd_binary_fn)( const f32* lhs, const f32* rhs, f32* out, usize count );
+/// out[i] = op(x[i])
+typedef void (*smsimd_unary_fn)( const f32* x, f32* out, usize count );
+/// out[i] = x[i] * scalar
+typedef void (*smsimd_scale_fn)( const f32* x, f32 scalar, f32* out, usize count );
+/// returns sum of x[0..count]
+typedef f32  (*smsimd_sum_fn)( const f32* x, usize count );
+
+/// table of batch kernels for one level
+typedef struct smsimd_kernels_t {
+    smsimd_level_t   level;
+    smsimd_binary_fn add_n;
+    smsimd_binary_fn sub_n;
+    smsimd_binary_fn mul_n;
+    smsimd_binary_fn div_n;
+    smsimd_unary_fn  sqrt_n;
+    smsimd_scale_fn  scale_n;
+    smsimd_sum_fn    sum_n;
+} smsimd_kernels_t;
+
+/// query host cpu simd features (cpuid on x86, getauxval on arm linux)
+smsimd_features_t smsimd_detect();
+/// best kernel level supported by features
+smsimd_level_t smsimd_best_level( smsimd_features_t features );
+/// resolve kernel table from host features,
+/// call once at startup to skip detection on first use, batch functions resolve
+/// it lazily otherwise, safe to call from any thread
+void smsimd_initialize();
+/// force kernel level, clamped to what the host supports,
+/// returns level that was selected
+smsimd_level_t smsimd_set_level( smsimd_level_t level );
+/// get currently selected kernel table
+const smsimd_kernels_t* smsimd_kernels();
+
+/// add arrays of count floats
+void smsimd_add_n( const f32* lhs, const f32* rhs, f32* out, usize count );
+/// subtract arrays of count floats
+void smsimd_sub_n( const f32* lhs, const f32* rhs, f32* out, usize count );
+/// multiply arrays of count floats
+void smsimd_mul_n( const f32* lhs, const f32* rhs, f32* out, usize count );
+/// divide arrays of count floats
+void smsimd_div_n( const f32* lhs, const f32* rhs, f32* out, usize count );
+/// sqrt array of count floats
+void smsimd_sqrt_n( const f32* x, f32* out, usize count );
+/// multiply array of count floats by scalar
+void smsimd_scale_n( const f32* x, f32 scalar, f32* out, usize count );
+/// sum array of count floats
+f32 smsimd_sum_n( const f32* x, usize count );
 
 #if defined(__cplusplus)
 } // namespace smath::simd
@@ -123,4 +843,8 @@ inline void lane4f_store( lane4f_t registers, f32* store_array );
 } // namespace smath
 #endif // c++
 
+#if defined(__cplusplus)
+    #include "smsimd_lanes.inl"
+#endif // c++
+
 #endif
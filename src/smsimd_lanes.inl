@@ -0,0 +1,3102 @@
+/**
+ * Description:  smsimd lane function definitions
+ * Author:       Alicia Amarilla (smushyaa@gmail.com)
+ * File Created: October 17, 2026
+ * Notes:        included by smsimd.h in C++ so lane functions inline
+ *               into every translation unit that calls them,
+ *               included by smsimd.c in C for the external definitions
+*/
+#if !defined(SMUSHY_SIMD_LANES_IMPL)
+#define SMUSHY_SIMD_LANES_IMPL
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
+    #include <immintrin.h>
+#endif
+
+#if defined(SM_COMPILER_MSVC)
+    #include <math.h>
+    #define __builtin_sqrtf  sqrtf
+    #define __builtin_fabsf  fabsf
+    #define __builtin_floorf floorf
+    #define __builtin_ceilf  ceilf
+    #define __builtin_rintf  rintf
+#endif
+
+#if defined(__cplusplus)
+    namespace smath {
+    namespace simd  {
+#endif // c++
+
+// scalar
+#if SMUSHY_SIMD_WIDTH == 1
+
+lane4f_t lane4f_set( f32 a, f32 b, f32 c, f32 d ) {
+    lane4f_t result;
+    result.a = a;
+    result.b = b;
+    result.c = c;
+    result.d = d;
+    return result;
+}
+lane4f_t lane4f_set_scalar( f32 scalar ) {
+    lane4f_t result;
+    result.a = scalar;
+    result.b = scalar;
+    result.c = scalar;
+    result.d = scalar;
+    return result;
+}
+lane4f_t lane4f_set_zero() {
+    lane4f_t result;
+    result.a = 0;
+    result.b = 0;
+    result.c = 0;
+    result.d = 0;
+    return result;
+}
+lane4f_t lane4f_load( const f32* load_array ) {
+    lane4f_t result;
+    result.a = load_array[0];
+    result.b = load_array[1];
+    result.c = load_array[2];
+    result.d = load_array[3];
+    return result;
+}
+lane4f_t lane4f_add( lane4f_t lhs, lane4f_t rhs ) {
+    lane4f_t result;
+    result.a = lhs.a + rhs.a;
+    result.b = lhs.b + rhs.b;
+    result.c = lhs.c + rhs.c;
+    result.d = lhs.d + rhs.d;
+    return result;
+}
+lane4f_t lane4f_sub( lane4f_t lhs, lane4f_t rhs ) {
+    lane4f_t result;
+    result.a = lhs.a - rhs.a;
+    result.b = lhs.b - rhs.b;
+    result.c = lhs.c - rhs.c;
+    result.d = lhs.d - rhs.d;
+    return result;
+}
+lane4f_t lane4f_mul( lane4f_t lhs, lane4f_t rhs ) {
+    lane4f_t result;
+    result.a = lhs.a * rhs.a;
+    result.b = lhs.b * rhs.b;
+    result.c = lhs.c * rhs.c;
+    result.d = lhs.d * rhs.d;
+    return result;
+}
+lane4f_t lane4f_div( lane4f_t lhs, lane4f_t rhs ) {
+    lane4f_t result;
+    result.a = lhs.a / rhs.a;
+    result.b = lhs.b / rhs.b;
+    result.c = lhs.c / rhs.c;
+    result.d = lhs.d / rhs.d;
+    return result;
+}
+lane4f_t lane4f_sqrt( lane4f_t x ) {
+    lane4f_t result;
+    result.a = __builtin_sqrtf(x.a);
+    result.b = __builtin_sqrtf(x.b);
+    result.c = __builtin_sqrtf(x.c);
+    result.d = __builtin_sqrtf(x.d);
+    return result;
+}
+void lane4f_store( lane4f_t registers, f32* store_array ) {
+    store_array[0] = registers.a;
+    store_array[1] = registers.b;
+    store_array[2] = registers.c;
+    store_array[3] = registers.d;
+}
+
+#endif // scalar
+
+// SSE
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
+
+    lane4f_t lane4f_set( f32 a, f32 b, f32 c, f32 d ) {
+        lane4f_t result;
+        result.simd = _mm_setr_ps( a, b, c, d );
+        return result;
+    }
+    lane4f_t lane4f_set_scalar( f32 scalar ) {
+        lane4f_t result;
+        result.simd = _mm_set1_ps( scalar );
+        return result;
+    }
+    lane4f_t lane4f_set_zero() {
+        lane4f_t result;
+        result.simd = _mm_setzero_ps();
+        return result;
+    }
+    lane4f_t lane4f_load( const f32* load_array ) {
+        lane4f_t result;
+        result.simd = _mm_load_ps( load_array );
+        return result;
+    }
+    lane4f_t lane4f_add( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = _mm_add_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_sub( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = _mm_sub_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_mul( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = _mm_mul_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_div( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = _mm_div_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_sqrt( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = _mm_sqrt_ps( x.simd );
+        return result;
+    }
+    void lane4f_store( lane4f_t registers, f32* store_array ) {
+        _mm_store_ps( store_array, registers.simd );
+    }
+
+#endif // SSE
+
+// NEON
+#if defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+
+    lane4f_t lane4f_set( f32 a, f32 b, f32 c, f32 d ) {
+        lane4f_t result;
+        f32 values[4] = { a, b, c, d };
+        result.simd = vld1q_f32( values );
+        return result;
+    }
+    lane4f_t lane4f_set_scalar( f32 scalar ) {
+        lane4f_t result;
+        result.simd = vdupq_n_f32( scalar );
+        return result;
+    }
+    lane4f_t lane4f_set_zero() {
+        lane4f_t result;
+        result.simd = vdupq_n_f32( 0.0f );
+        return result;
+    }
+    lane4f_t lane4f_load( const f32* load_array ) {
+        lane4f_t result;
+        result.simd = vld1q_f32( load_array );
+        return result;
+    }
+    lane4f_t lane4f_add( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = vaddq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_sub( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = vsubq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_mul( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = vmulq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+#if defined(SM_ARCH_64_BIT)
+    lane4f_t lane4f_div( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = vdivq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_sqrt( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = vsqrtq_f32( x.simd );
+        return result;
+    }
+#else // 32-bit
+    // NOTE(alicia): armv7 NEON has no divide or sqrt,
+    // refine the estimates with two newton-raphson steps
+    lane4f_t lane4f_div( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        float32x4_t reciprocal = vrecpeq_f32( rhs.simd );
+        reciprocal  = vmulq_f32( vrecpsq_f32( rhs.simd, reciprocal ), reciprocal );
+        reciprocal  = vmulq_f32( vrecpsq_f32( rhs.simd, reciprocal ), reciprocal );
+        result.simd = vmulq_f32( lhs.simd, reciprocal );
+        return result;
+    }
+    lane4f_t lane4f_sqrt( lane4f_t x ) {
+        lane4f_t result;
+        float32x4_t rsqrt = vrsqrteq_f32( x.simd );
+        rsqrt = vmulq_f32( vrsqrtsq_f32( vmulq_f32( x.simd, rsqrt ), rsqrt ), rsqrt );
+        rsqrt = vmulq_f32( vrsqrtsq_f32( vmulq_f32( x.simd, rsqrt ), rsqrt ), rsqrt );
+        // NOTE(alicia): rsqrt(0) is inf, mask those lanes back to zero
+        uint32x4_t non_zero = vcgtq_f32( x.simd, vdupq_n_f32( 0.0f ) );
+        result.simd = vreinterpretq_f32_u32( vandq_u32(
+            vreinterpretq_u32_f32( vmulq_f32( x.simd, rsqrt ) ), non_zero ) );
+        return result;
+    }
+#endif // 32-bit
+    void lane4f_store( lane4f_t registers, f32* store_array ) {
+        vst1q_f32( store_array, registers.simd );
+    }
+
+#endif // NEON
+
+// AVX
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+
+    lane8f_t lane8f_set( f32 a, f32 b, f32 c, f32 d, f32 e, f32 f, f32 g, f32 h ) {
+        lane8f_t result;
+        result.simd = _mm256_setr_ps( a, b, c, d, e, f, g, h );
+        return result;
+    }
+    lane8f_t lane8f_set_scalar( f32 scalar ) {
+        lane8f_t result;
+        result.simd = _mm256_set1_ps( scalar );
+        return result;
+    }
+    lane8f_t lane8f_set_zero() {
+        lane8f_t result;
+        result.simd = _mm256_setzero_ps();
+        return result;
+    }
+    lane8f_t lane8f_combine( lane4f_t low, lane4f_t high ) {
+        lane8f_t result;
+        result.simd = _mm256_insertf128_ps( _mm256_castps128_ps256( low.simd ), high.simd, 1 );
+        return result;
+    }
+    lane8f_t lane8f_load( const f32* load_array ) {
+        lane8f_t result;
+        result.simd = _mm256_load_ps( load_array );
+        return result;
+    }
+    lane8f_t lane8f_add( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.simd = _mm256_add_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8f_t lane8f_sub( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.simd = _mm256_sub_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8f_t lane8f_mul( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.simd = _mm256_mul_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8f_t lane8f_div( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.simd = _mm256_div_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8f_t lane8f_sqrt( lane8f_t x ) {
+        lane8f_t result;
+        result.simd = _mm256_sqrt_ps( x.simd );
+        return result;
+    }
+    void lane8f_store( lane8f_t registers, f32* store_array ) {
+        _mm256_store_ps( store_array, registers.simd );
+    }
+    lane4f_t lane8f_extract_high( lane8f_t x ) {
+        lane4f_t result;
+        result.simd = _mm256_extractf128_ps( x.simd, 1 );
+        return result;
+    }
+    lane4f_t lane8f_extract_low( lane8f_t x ) {
+        lane4f_t result;
+        result.simd = _mm256_castps256_ps128( x.simd );
+        return result;
+    }
+
+#else // AVX
+
+// NOTE(alicia): without AVX, lane8f is two lane4f
+
+    lane8f_t lane8f_set( f32 a, f32 b, f32 c, f32 d, f32 e, f32 f, f32 g, f32 h ) {
+        lane8f_t result;
+        result.low  = lane4f_set( a, b, c, d );
+        result.high = lane4f_set( e, f, g, h );
+        return result;
+    }
+    lane8f_t lane8f_set_scalar( f32 scalar ) {
+        lane8f_t result;
+        result.low  = lane4f_set_scalar( scalar );
+        result.high = result.low;
+        return result;
+    }
+    lane8f_t lane8f_set_zero() {
+        lane8f_t result;
+        result.low  = lane4f_set_zero();
+        result.high = result.low;
+        return result;
+    }
+    lane8f_t lane8f_combine( lane4f_t low, lane4f_t high ) {
+        lane8f_t result;
+        result.low  = low;
+        result.high = high;
+        return result;
+    }
+    lane8f_t lane8f_load( const f32* load_array ) {
+        lane8f_t result;
+        result.low  = lane4f_load( load_array );
+        result.high = lane4f_load( load_array + 4 );
+        return result;
+    }
+    lane8f_t lane8f_add( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.low  = lane4f_add( lhs.low, rhs.low );
+        result.high = lane4f_add( lhs.high, rhs.high );
+        return result;
+    }
+    lane8f_t lane8f_sub( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.low  = lane4f_sub( lhs.low, rhs.low );
+        result.high = lane4f_sub( lhs.high, rhs.high );
+        return result;
+    }
+    lane8f_t lane8f_mul( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.low  = lane4f_mul( lhs.low, rhs.low );
+        result.high = lane4f_mul( lhs.high, rhs.high );
+        return result;
+    }
+    lane8f_t lane8f_div( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.low  = lane4f_div( lhs.low, rhs.low );
+        result.high = lane4f_div( lhs.high, rhs.high );
+        return result;
+    }
+    lane8f_t lane8f_sqrt( lane8f_t x ) {
+        lane8f_t result;
+        result.low  = lane4f_sqrt( x.low );
+        result.high = lane4f_sqrt( x.high );
+        return result;
+    }
+    void lane8f_store( lane8f_t registers, f32* store_array ) {
+        lane4f_store( registers.low, store_array );
+        lane4f_store( registers.high, store_array + 4 );
+    }
+    lane4f_t lane8f_extract_high( lane8f_t x ) {
+        return x.high;
+    }
+    lane4f_t lane8f_extract_low( lane8f_t x ) {
+        return x.low;
+    }
+
+#endif // no AVX
+
+// scalar integer/mask lanes
+#if SMUSHY_SIMD_WIDTH == 1
+
+lane4i_t lane4i_set( i32 a, i32 b, i32 c, i32 d ) {
+    lane4i_t result;
+    result.a = a;
+    result.b = b;
+    result.c = c;
+    result.d = d;
+    return result;
+}
+lane4i_t lane4i_set_scalar( i32 scalar ) {
+    return lane4i_set( scalar, scalar, scalar, scalar );
+}
+lane4i_t lane4i_set_zero() {
+    return lane4i_set( 0, 0, 0, 0 );
+}
+lane4i_t lane4i_load( const i32* load_array ) {
+    return lane4i_set( load_array[0], load_array[1], load_array[2], load_array[3] );
+}
+void lane4i_store( lane4i_t registers, i32* store_array ) {
+    store_array[0] = registers.a;
+    store_array[1] = registers.b;
+    store_array[2] = registers.c;
+    store_array[3] = registers.d;
+}
+// NOTE(alicia): go through u32 so overflow wraps like simd lanes instead of being UB
+lane4i_t lane4i_add( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = (i32)((u32)lhs.value[i] + (u32)rhs.value[i]);
+    }
+    return result;
+}
+lane4i_t lane4i_sub( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = (i32)((u32)lhs.value[i] - (u32)rhs.value[i]);
+    }
+    return result;
+}
+lane4i_t lane4i_mul( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = (i32)((u32)lhs.value[i] * (u32)rhs.value[i]);
+    }
+    return result;
+}
+lane4i_t lane4i_min( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] < rhs.value[i] ? lhs.value[i] : rhs.value[i];
+    }
+    return result;
+}
+lane4i_t lane4i_max( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] > rhs.value[i] ? lhs.value[i] : rhs.value[i];
+    }
+    return result;
+}
+lane4i_t lane4i_abs( lane4i_t x ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = (i32)(x.value[i] < 0 ? 0u - (u32)x.value[i] : (u32)x.value[i]);
+    }
+    return result;
+}
+lane4i_t lane4i_and( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] & rhs.value[i];
+    }
+    return result;
+}
+lane4i_t lane4i_or( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] | rhs.value[i];
+    }
+    return result;
+}
+lane4i_t lane4i_xor( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] ^ rhs.value[i];
+    }
+    return result;
+}
+lane4i_t lane4i_andnot( lane4i_t lhs, lane4i_t rhs ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] & ~rhs.value[i];
+    }
+    return result;
+}
+lane4i_t lane4i_not( lane4i_t x ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = ~x.value[i];
+    }
+    return result;
+}
+// NOTE(alicia): counts past 31 give zero (or sign fill) like simd shifts
+lane4i_t lane4i_shift_left( lane4i_t x, u32 count ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = count > 31 ? 0 : (i32)((u32)x.value[i] << count);
+    }
+    return result;
+}
+lane4i_t lane4i_shift_right( lane4i_t x, u32 count ) {
+    lane4i_t result;
+    count = count > 31 ? 31 : count;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = x.value[i] >> count;
+    }
+    return result;
+}
+lane4i_t lane4i_shift_right_logical( lane4i_t x, u32 count ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = count > 31 ? 0 : (i32)((u32)x.value[i] >> count);
+    }
+    return result;
+}
+lane4b_t lane4i_cmp_eq( lane4i_t lhs, lane4i_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] == rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4b_t lane4i_cmp_gt( lane4i_t lhs, lane4i_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] > rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4b_t lane4i_cmp_lt( lane4i_t lhs, lane4i_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] < rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4i_t lane4i_select( lane4b_t mask, lane4i_t if_true, lane4i_t if_false ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = mask.value[i] ? if_true.value[i] : if_false.value[i];
+    }
+    return result;
+}
+lane4f_t lane4i_to_lane4f( lane4i_t x ) {
+    lane4f_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = (f32)x.value[i];
+    }
+    return result;
+}
+lane4f_t lane4i_as_lane4f( lane4i_t x ) {
+    union { lane4i_t i; lane4f_t f; } bits;
+    bits.i = x;
+    return bits.f;
+}
+lane4b_t lane4f_cmp_eq( lane4f_t lhs, lane4f_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] == rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4b_t lane4f_cmp_neq( lane4f_t lhs, lane4f_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] != rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4b_t lane4f_cmp_lt( lane4f_t lhs, lane4f_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] < rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4b_t lane4f_cmp_le( lane4f_t lhs, lane4f_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] <= rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4b_t lane4f_cmp_gt( lane4f_t lhs, lane4f_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] > rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4b_t lane4f_cmp_ge( lane4f_t lhs, lane4f_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] >= rhs.value[i] ? 0xFFFFFFFF : 0;
+    }
+    return result;
+}
+lane4f_t lane4f_select( lane4b_t mask, lane4f_t if_true, lane4f_t if_false ) {
+    lane4f_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = mask.value[i] ? if_true.value[i] : if_false.value[i];
+    }
+    return result;
+}
+lane4f_t lane4f_min( lane4f_t lhs, lane4f_t rhs ) {
+    lane4f_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] < rhs.value[i] ? lhs.value[i] : rhs.value[i];
+    }
+    return result;
+}
+lane4f_t lane4f_max( lane4f_t lhs, lane4f_t rhs ) {
+    lane4f_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] > rhs.value[i] ? lhs.value[i] : rhs.value[i];
+    }
+    return result;
+}
+lane4f_t lane4f_abs( lane4f_t x ) {
+    lane4f_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = __builtin_fabsf( x.value[i] );
+    }
+    return result;
+}
+lane4f_t lane4f_floor( lane4f_t x ) {
+    lane4f_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = __builtin_floorf( x.value[i] );
+    }
+    return result;
+}
+lane4f_t lane4f_ceil( lane4f_t x ) {
+    lane4f_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = __builtin_ceilf( x.value[i] );
+    }
+    return result;
+}
+lane4f_t lane4f_round( lane4f_t x ) {
+    lane4f_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = __builtin_rintf( x.value[i] );
+    }
+    return result;
+}
+lane4i_t lane4f_to_lane4i( lane4f_t x ) {
+    lane4i_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        // NOTE(alicia): casting NaN or out of range values is undefined,
+        // match cvttps and give INT32_MIN instead
+        f32 value = x.value[i];
+        result.value[i] = ( value >= -2147483648.0f && value < 2147483648.0f ) ?
+            (i32)value : ( -2147483647 - 1 );
+    }
+    return result;
+}
+lane4i_t lane4f_as_lane4i( lane4f_t x ) {
+    union { lane4f_t f; lane4i_t i; } bits;
+    bits.f = x;
+    return bits.i;
+}
+lane4b_t lane4b_set( bool32 a, bool32 b, bool32 c, bool32 d ) {
+    lane4b_t result;
+    result.a = a ? 0xFFFFFFFF : 0;
+    result.b = b ? 0xFFFFFFFF : 0;
+    result.c = c ? 0xFFFFFFFF : 0;
+    result.d = d ? 0xFFFFFFFF : 0;
+    return result;
+}
+lane4b_t lane4b_and( lane4b_t lhs, lane4b_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] & rhs.value[i];
+    }
+    return result;
+}
+lane4b_t lane4b_or( lane4b_t lhs, lane4b_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] | rhs.value[i];
+    }
+    return result;
+}
+lane4b_t lane4b_xor( lane4b_t lhs, lane4b_t rhs ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = lhs.value[i] ^ rhs.value[i];
+    }
+    return result;
+}
+lane4b_t lane4b_not( lane4b_t x ) {
+    lane4b_t result;
+    for( u32 i = 0; i < 4; ++i ) {
+        result.value[i] = ~x.value[i];
+    }
+    return result;
+}
+bool32 lane4b_any( lane4b_t x ) {
+    return lane4b_bitmask( x ) != 0;
+}
+bool32 lane4b_all( lane4b_t x ) {
+    return lane4b_bitmask( x ) == 0xF;
+}
+u32 lane4b_bitmask( lane4b_t x ) {
+    return
+        ((x.a >> 31) << 0) |
+        ((x.b >> 31) << 1) |
+        ((x.c >> 31) << 2) |
+        ((x.d >> 31) << 3);
+}
+
+#endif // scalar integer/mask lanes
+
+// SSE integer/mask lanes
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
+
+    lane4i_t lane4i_set( i32 a, i32 b, i32 c, i32 d ) {
+        lane4i_t result;
+        result.simd = _mm_setr_epi32( a, b, c, d );
+        return result;
+    }
+    lane4i_t lane4i_set_scalar( i32 scalar ) {
+        lane4i_t result;
+        result.simd = _mm_set1_epi32( scalar );
+        return result;
+    }
+    lane4i_t lane4i_set_zero() {
+        lane4i_t result;
+        result.simd = _mm_setzero_si128();
+        return result;
+    }
+    lane4i_t lane4i_load( const i32* load_array ) {
+        lane4i_t result;
+        result.simd = _mm_load_si128( (const __m128i*)load_array );
+        return result;
+    }
+    void lane4i_store( lane4i_t registers, i32* store_array ) {
+        _mm_store_si128( (__m128i*)store_array, registers.simd );
+    }
+    lane4i_t lane4i_add( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_add_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_sub( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_sub_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_mul( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_mullo_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_min( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_min_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_max( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_max_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_and( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_and_si128( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_or( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_or_si128( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_xor( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_xor_si128( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_abs( lane4i_t x ) {
+        lane4i_t result;
+        result.simd = _mm_abs_epi32( x.simd );
+        return result;
+    }
+    lane4i_t lane4i_andnot( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = _mm_andnot_si128( rhs.simd, lhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_not( lane4i_t x ) {
+        lane4i_t result;
+        result.simd = _mm_xor_si128( x.simd, _mm_set1_epi32( -1 ) );
+        return result;
+    }
+    lane4i_t lane4i_shift_left( lane4i_t x, u32 count ) {
+        lane4i_t result;
+        result.simd = _mm_sll_epi32( x.simd, _mm_cvtsi32_si128( (int)count ) );
+        return result;
+    }
+    lane4i_t lane4i_shift_right( lane4i_t x, u32 count ) {
+        lane4i_t result;
+        result.simd = _mm_sra_epi32( x.simd, _mm_cvtsi32_si128( (int)count ) );
+        return result;
+    }
+    lane4i_t lane4i_shift_right_logical( lane4i_t x, u32 count ) {
+        lane4i_t result;
+        result.simd = _mm_srl_epi32( x.simd, _mm_cvtsi32_si128( (int)count ) );
+        return result;
+    }
+    lane4b_t lane4i_cmp_eq( lane4i_t lhs, lane4i_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_cmpeq_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4i_cmp_gt( lane4i_t lhs, lane4i_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_cmpgt_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4i_cmp_lt( lane4i_t lhs, lane4i_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_cmplt_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_select( lane4b_t mask, lane4i_t if_true, lane4i_t if_false ) {
+        lane4i_t result;
+        result.simd = _mm_blendv_epi8( if_false.simd, if_true.simd, mask.simd );
+        return result;
+    }
+    lane4f_t lane4i_to_lane4f( lane4i_t x ) {
+        lane4f_t result;
+        result.simd = _mm_cvtepi32_ps( x.simd );
+        return result;
+    }
+    lane4f_t lane4i_as_lane4f( lane4i_t x ) {
+        lane4f_t result;
+        result.simd = _mm_castsi128_ps( x.simd );
+        return result;
+    }
+    lane4b_t lane4f_cmp_eq( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_castps_si128( _mm_cmpeq_ps( lhs.simd, rhs.simd ) );
+        return result;
+    }
+    lane4b_t lane4f_cmp_neq( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_castps_si128( _mm_cmpneq_ps( lhs.simd, rhs.simd ) );
+        return result;
+    }
+    lane4b_t lane4f_cmp_lt( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_castps_si128( _mm_cmplt_ps( lhs.simd, rhs.simd ) );
+        return result;
+    }
+    lane4b_t lane4f_cmp_le( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_castps_si128( _mm_cmple_ps( lhs.simd, rhs.simd ) );
+        return result;
+    }
+    lane4b_t lane4f_cmp_gt( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_castps_si128( _mm_cmpgt_ps( lhs.simd, rhs.simd ) );
+        return result;
+    }
+    lane4b_t lane4f_cmp_ge( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_castps_si128( _mm_cmpge_ps( lhs.simd, rhs.simd ) );
+        return result;
+    }
+    lane4f_t lane4f_select( lane4b_t mask, lane4f_t if_true, lane4f_t if_false ) {
+        lane4f_t result;
+        result.simd = _mm_blendv_ps( if_false.simd, if_true.simd, _mm_castsi128_ps( mask.simd ) );
+        return result;
+    }
+    lane4f_t lane4f_min( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = _mm_min_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_max( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = _mm_max_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_abs( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = _mm_andnot_ps( _mm_set1_ps( -0.0f ), x.simd );
+        return result;
+    }
+    lane4f_t lane4f_floor( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = _mm_round_ps( x.simd, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC );
+        return result;
+    }
+    lane4f_t lane4f_ceil( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = _mm_round_ps( x.simd, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC );
+        return result;
+    }
+    lane4f_t lane4f_round( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = _mm_round_ps( x.simd, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+        return result;
+    }
+    lane4i_t lane4f_to_lane4i( lane4f_t x ) {
+        lane4i_t result;
+        result.simd = _mm_cvttps_epi32( x.simd );
+        return result;
+    }
+    lane4i_t lane4f_as_lane4i( lane4f_t x ) {
+        lane4i_t result;
+        result.simd = _mm_castps_si128( x.simd );
+        return result;
+    }
+    lane4b_t lane4b_set( bool32 a, bool32 b, bool32 c, bool32 d ) {
+        lane4b_t result;
+        result.simd = _mm_setr_epi32( a ? -1 : 0, b ? -1 : 0, c ? -1 : 0, d ? -1 : 0 );
+        return result;
+    }
+    lane4b_t lane4b_and( lane4b_t lhs, lane4b_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_and_si128( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4b_or( lane4b_t lhs, lane4b_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_or_si128( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4b_xor( lane4b_t lhs, lane4b_t rhs ) {
+        lane4b_t result;
+        result.simd = _mm_xor_si128( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4b_not( lane4b_t x ) {
+        lane4b_t result;
+        result.simd = _mm_xor_si128( x.simd, _mm_set1_epi32( -1 ) );
+        return result;
+    }
+    bool32 lane4b_any( lane4b_t x ) {
+        return _mm_movemask_ps( _mm_castsi128_ps( x.simd ) ) != 0;
+    }
+    bool32 lane4b_all( lane4b_t x ) {
+        return _mm_movemask_ps( _mm_castsi128_ps( x.simd ) ) == 0xF;
+    }
+    u32 lane4b_bitmask( lane4b_t x ) {
+        return (u32)_mm_movemask_ps( _mm_castsi128_ps( x.simd ) );
+    }
+
+#endif // SSE integer/mask lanes
+
+// NEON integer/mask lanes
+#if defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+
+    lane4i_t lane4i_set( i32 a, i32 b, i32 c, i32 d ) {
+        lane4i_t result;
+        i32 values[4] = { a, b, c, d };
+        result.simd = vld1q_s32( values );
+        return result;
+    }
+    lane4i_t lane4i_set_scalar( i32 scalar ) {
+        lane4i_t result;
+        result.simd = vdupq_n_s32( scalar );
+        return result;
+    }
+    lane4i_t lane4i_set_zero() {
+        lane4i_t result;
+        result.simd = vdupq_n_s32( 0 );
+        return result;
+    }
+    lane4i_t lane4i_load( const i32* load_array ) {
+        lane4i_t result;
+        result.simd = vld1q_s32( load_array );
+        return result;
+    }
+    void lane4i_store( lane4i_t registers, i32* store_array ) {
+        vst1q_s32( store_array, registers.simd );
+    }
+    lane4i_t lane4i_add( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = vaddq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_sub( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = vsubq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_mul( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = vmulq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_min( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = vminq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_max( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = vmaxq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_and( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = vandq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_or( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = vorrq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_xor( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = veorq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_andnot( lane4i_t lhs, lane4i_t rhs ) {
+        lane4i_t result;
+        result.simd = vbicq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_abs( lane4i_t x ) {
+        lane4i_t result;
+        result.simd = vabsq_s32( x.simd );
+        return result;
+    }
+    lane4i_t lane4i_not( lane4i_t x ) {
+        lane4i_t result;
+        result.simd = vmvnq_s32( x.simd );
+        return result;
+    }
+    // NOTE(alicia): NEON shifts right with a negative left shift
+    lane4i_t lane4i_shift_left( lane4i_t x, u32 count ) {
+        lane4i_t result;
+        result.simd = vshlq_s32( x.simd, vdupq_n_s32( count > 32 ? 32 : (i32)count ) );
+        return result;
+    }
+    lane4i_t lane4i_shift_right( lane4i_t x, u32 count ) {
+        lane4i_t result;
+        result.simd = vshlq_s32( x.simd, vdupq_n_s32( -(count > 32 ? 32 : (i32)count) ) );
+        return result;
+    }
+    lane4i_t lane4i_shift_right_logical( lane4i_t x, u32 count ) {
+        lane4i_t result;
+        result.simd = vreinterpretq_s32_u32( vshlq_u32(
+            vreinterpretq_u32_s32( x.simd ), vdupq_n_s32( -(count > 32 ? 32 : (i32)count) ) ) );
+        return result;
+    }
+    lane4b_t lane4i_cmp_eq( lane4i_t lhs, lane4i_t rhs ) {
+        lane4b_t result;
+        result.simd = vceqq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4i_cmp_gt( lane4i_t lhs, lane4i_t rhs ) {
+        lane4b_t result;
+        result.simd = vcgtq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4i_cmp_lt( lane4i_t lhs, lane4i_t rhs ) {
+        lane4b_t result;
+        result.simd = vcltq_s32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4i_t lane4i_select( lane4b_t mask, lane4i_t if_true, lane4i_t if_false ) {
+        lane4i_t result;
+        result.simd = vbslq_s32( mask.simd, if_true.simd, if_false.simd );
+        return result;
+    }
+    lane4f_t lane4i_to_lane4f( lane4i_t x ) {
+        lane4f_t result;
+        result.simd = vcvtq_f32_s32( x.simd );
+        return result;
+    }
+    lane4f_t lane4i_as_lane4f( lane4i_t x ) {
+        lane4f_t result;
+        result.simd = vreinterpretq_f32_s32( x.simd );
+        return result;
+    }
+    lane4b_t lane4f_cmp_eq( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = vceqq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4f_cmp_neq( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = vmvnq_u32( vceqq_f32( lhs.simd, rhs.simd ) );
+        return result;
+    }
+    lane4b_t lane4f_cmp_lt( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = vcltq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4f_cmp_le( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = vcleq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4f_cmp_gt( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = vcgtq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4f_cmp_ge( lane4f_t lhs, lane4f_t rhs ) {
+        lane4b_t result;
+        result.simd = vcgeq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_select( lane4b_t mask, lane4f_t if_true, lane4f_t if_false ) {
+        lane4f_t result;
+        result.simd = vbslq_f32( mask.simd, if_true.simd, if_false.simd );
+        return result;
+    }
+    lane4f_t lane4f_min( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = vminq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_max( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = vmaxq_f32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_abs( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = vabsq_f32( x.simd );
+        return result;
+    }
+#if defined(SM_ARCH_64_BIT)
+    lane4f_t lane4f_floor( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = vrndmq_f32( x.simd );
+        return result;
+    }
+    lane4f_t lane4f_ceil( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = vrndpq_f32( x.simd );
+        return result;
+    }
+    lane4f_t lane4f_round( lane4f_t x ) {
+        lane4f_t result;
+        result.simd = vrndnq_f32( x.simd );
+        return result;
+    }
+#else // 32-bit
+    // NOTE(alicia): armv7 NEON has no rounding instructions,
+    // truncate through integers and fix up, only valid for |x| < 2^31
+    lane4f_t lane4f_floor( lane4f_t x ) {
+        lane4f_t result;
+        float32x4_t truncated = vcvtq_f32_s32( vcvtq_s32_f32( x.simd ) );
+        uint32x4_t  too_big   = vcgtq_f32( truncated, x.simd );
+        result.simd = vsubq_f32( truncated, vreinterpretq_f32_u32(
+            vandq_u32( too_big, vreinterpretq_u32_f32( vdupq_n_f32( 1.0f ) ) ) ) );
+        return result;
+    }
+    lane4f_t lane4f_ceil( lane4f_t x ) {
+        lane4f_t result;
+        float32x4_t truncated = vcvtq_f32_s32( vcvtq_s32_f32( x.simd ) );
+        uint32x4_t  too_small = vcltq_f32( truncated, x.simd );
+        result.simd = vaddq_f32( truncated, vreinterpretq_f32_u32(
+            vandq_u32( too_small, vreinterpretq_u32_f32( vdupq_n_f32( 1.0f ) ) ) ) );
+        return result;
+    }
+    lane4f_t lane4f_round( lane4f_t x ) {
+        // NOTE(alicia): adding and subtracting 2^23 rounds to nearest even
+        lane4f_t result;
+        float32x4_t magic  = vreinterpretq_f32_u32( vorrq_u32(
+            vreinterpretq_u32_f32( vdupq_n_f32( 8388608.0f ) ),
+            vandq_u32( vreinterpretq_u32_f32( x.simd ), vdupq_n_u32( 0x80000000 ) ) ) );
+        float32x4_t rounded = vsubq_f32( vaddq_f32( x.simd, magic ), magic );
+        uint32x4_t  small   = vcltq_f32( vabsq_f32( x.simd ), vdupq_n_f32( 8388608.0f ) );
+        result.simd = vbslq_f32( small, rounded, x.simd );
+        return result;
+    }
+#endif // 32-bit
+    lane4i_t lane4f_to_lane4i( lane4f_t x ) {
+        lane4i_t result;
+        result.simd = vcvtq_s32_f32( x.simd );
+        return result;
+    }
+    lane4i_t lane4f_as_lane4i( lane4f_t x ) {
+        lane4i_t result;
+        result.simd = vreinterpretq_s32_f32( x.simd );
+        return result;
+    }
+    lane4b_t lane4b_set( bool32 a, bool32 b, bool32 c, bool32 d ) {
+        lane4b_t result;
+        u32 values[4] = {
+            a ? 0xFFFFFFFF : 0, b ? 0xFFFFFFFF : 0,
+            c ? 0xFFFFFFFF : 0, d ? 0xFFFFFFFF : 0
+        };
+        result.simd = vld1q_u32( values );
+        return result;
+    }
+    lane4b_t lane4b_and( lane4b_t lhs, lane4b_t rhs ) {
+        lane4b_t result;
+        result.simd = vandq_u32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4b_or( lane4b_t lhs, lane4b_t rhs ) {
+        lane4b_t result;
+        result.simd = vorrq_u32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4b_xor( lane4b_t lhs, lane4b_t rhs ) {
+        lane4b_t result;
+        result.simd = veorq_u32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4b_t lane4b_not( lane4b_t x ) {
+        lane4b_t result;
+        result.simd = vmvnq_u32( x.simd );
+        return result;
+    }
+    u32 lane4b_bitmask( lane4b_t x ) {
+        u32 bits_array[4] = { 1, 2, 4, 8 };
+        uint32x4_t bits = vandq_u32( x.simd, vld1q_u32( bits_array ) );
+    #if defined(SM_ARCH_64_BIT)
+        return vaddvq_u32( bits );
+    #else
+        uint32x2_t pair = vadd_u32( vget_low_u32( bits ), vget_high_u32( bits ) );
+        return vget_lane_u32( vpadd_u32( pair, pair ), 0 );
+    #endif
+    }
+    bool32 lane4b_any( lane4b_t x ) {
+    #if defined(SM_ARCH_64_BIT)
+        return vmaxvq_u32( x.simd ) != 0;
+    #else
+        return lane4b_bitmask( x ) != 0;
+    #endif
+    }
+    bool32 lane4b_all( lane4b_t x ) {
+    #if defined(SM_ARCH_64_BIT)
+        return vminvq_u32( x.simd ) != 0;
+    #else
+        return lane4b_bitmask( x ) == 0xF;
+    #endif
+    }
+
+#endif // NEON integer/mask lanes
+
+// AVX2 integer/mask lanes
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+
+    lane8i_t lane8i_set( i32 a, i32 b, i32 c, i32 d, i32 e, i32 f, i32 g, i32 h ) {
+        lane8i_t result;
+        result.simd = _mm256_setr_epi32( a, b, c, d, e, f, g, h );
+        return result;
+    }
+    lane8i_t lane8i_set_scalar( i32 scalar ) {
+        lane8i_t result;
+        result.simd = _mm256_set1_epi32( scalar );
+        return result;
+    }
+    lane8i_t lane8i_set_zero() {
+        lane8i_t result;
+        result.simd = _mm256_setzero_si256();
+        return result;
+    }
+    lane8i_t lane8i_combine( lane4i_t low, lane4i_t high ) {
+        lane8i_t result;
+        result.simd = _mm256_inserti128_si256( _mm256_castsi128_si256( low.simd ), high.simd, 1 );
+        return result;
+    }
+    lane8i_t lane8i_load( const i32* load_array ) {
+        lane8i_t result;
+        result.simd = _mm256_load_si256( (const __m256i*)load_array );
+        return result;
+    }
+    void lane8i_store( lane8i_t registers, i32* store_array ) {
+        _mm256_store_si256( (__m256i*)store_array, registers.simd );
+    }
+    lane4i_t lane8i_extract_high( lane8i_t x ) {
+        lane4i_t result;
+        result.simd = _mm256_extracti128_si256( x.simd, 1 );
+        return result;
+    }
+    lane4i_t lane8i_extract_low( lane8i_t x ) {
+        lane4i_t result;
+        result.simd = _mm256_castsi256_si128( x.simd );
+        return result;
+    }
+    lane8i_t lane8i_add( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_add_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_sub( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_sub_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_mul( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_mullo_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_min( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_min_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_max( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_max_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_and( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_and_si256( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_or( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_or_si256( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_xor( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_xor_si256( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_abs( lane8i_t x ) {
+        lane8i_t result;
+        result.simd = _mm256_abs_epi32( x.simd );
+        return result;
+    }
+    lane8i_t lane8i_andnot( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.simd = _mm256_andnot_si256( rhs.simd, lhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_not( lane8i_t x ) {
+        lane8i_t result;
+        result.simd = _mm256_xor_si256( x.simd, _mm256_set1_epi32( -1 ) );
+        return result;
+    }
+    lane8i_t lane8i_shift_left( lane8i_t x, u32 count ) {
+        lane8i_t result;
+        result.simd = _mm256_sll_epi32( x.simd, _mm_cvtsi32_si128( (int)count ) );
+        return result;
+    }
+    lane8i_t lane8i_shift_right( lane8i_t x, u32 count ) {
+        lane8i_t result;
+        result.simd = _mm256_sra_epi32( x.simd, _mm_cvtsi32_si128( (int)count ) );
+        return result;
+    }
+    lane8i_t lane8i_shift_right_logical( lane8i_t x, u32 count ) {
+        lane8i_t result;
+        result.simd = _mm256_srl_epi32( x.simd, _mm_cvtsi32_si128( (int)count ) );
+        return result;
+    }
+    lane8b_t lane8i_cmp_eq( lane8i_t lhs, lane8i_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_cmpeq_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8b_t lane8i_cmp_gt( lane8i_t lhs, lane8i_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_cmpgt_epi32( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8b_t lane8i_cmp_lt( lane8i_t lhs, lane8i_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_cmpgt_epi32( rhs.simd, lhs.simd );
+        return result;
+    }
+    lane8i_t lane8i_select( lane8b_t mask, lane8i_t if_true, lane8i_t if_false ) {
+        lane8i_t result;
+        result.simd = _mm256_blendv_epi8( if_false.simd, if_true.simd, mask.simd );
+        return result;
+    }
+    lane8f_t lane8i_to_lane8f( lane8i_t x ) {
+        lane8f_t result;
+        result.simd = _mm256_cvtepi32_ps( x.simd );
+        return result;
+    }
+    lane8f_t lane8i_as_lane8f( lane8i_t x ) {
+        lane8f_t result;
+        result.simd = _mm256_castsi256_ps( x.simd );
+        return result;
+    }
+    lane8b_t lane8f_cmp_eq( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_castps_si256( _mm256_cmp_ps( lhs.simd, rhs.simd, _CMP_EQ_OQ ) );
+        return result;
+    }
+    lane8b_t lane8f_cmp_neq( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_castps_si256( _mm256_cmp_ps( lhs.simd, rhs.simd, _CMP_NEQ_UQ ) );
+        return result;
+    }
+    lane8b_t lane8f_cmp_lt( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_castps_si256( _mm256_cmp_ps( lhs.simd, rhs.simd, _CMP_LT_OQ ) );
+        return result;
+    }
+    lane8b_t lane8f_cmp_le( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_castps_si256( _mm256_cmp_ps( lhs.simd, rhs.simd, _CMP_LE_OQ ) );
+        return result;
+    }
+    lane8b_t lane8f_cmp_gt( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_castps_si256( _mm256_cmp_ps( lhs.simd, rhs.simd, _CMP_GT_OQ ) );
+        return result;
+    }
+    lane8b_t lane8f_cmp_ge( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_castps_si256( _mm256_cmp_ps( lhs.simd, rhs.simd, _CMP_GE_OQ ) );
+        return result;
+    }
+    lane8f_t lane8f_select( lane8b_t mask, lane8f_t if_true, lane8f_t if_false ) {
+        lane8f_t result;
+        result.simd = _mm256_blendv_ps( if_false.simd, if_true.simd, _mm256_castsi256_ps( mask.simd ) );
+        return result;
+    }
+    lane8f_t lane8f_min( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.simd = _mm256_min_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8f_t lane8f_max( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.simd = _mm256_max_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8f_t lane8f_abs( lane8f_t x ) {
+        lane8f_t result;
+        result.simd = _mm256_andnot_ps( _mm256_set1_ps( -0.0f ), x.simd );
+        return result;
+    }
+    lane8f_t lane8f_floor( lane8f_t x ) {
+        lane8f_t result;
+        result.simd = _mm256_round_ps( x.simd, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC );
+        return result;
+    }
+    lane8f_t lane8f_ceil( lane8f_t x ) {
+        lane8f_t result;
+        result.simd = _mm256_round_ps( x.simd, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC );
+        return result;
+    }
+    lane8f_t lane8f_round( lane8f_t x ) {
+        lane8f_t result;
+        result.simd = _mm256_round_ps( x.simd, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+        return result;
+    }
+    lane8i_t lane8f_to_lane8i( lane8f_t x ) {
+        lane8i_t result;
+        result.simd = _mm256_cvttps_epi32( x.simd );
+        return result;
+    }
+    lane8i_t lane8f_as_lane8i( lane8f_t x ) {
+        lane8i_t result;
+        result.simd = _mm256_castps_si256( x.simd );
+        return result;
+    }
+    lane8b_t lane8b_set( bool32 a, bool32 b, bool32 c, bool32 d, bool32 e, bool32 f, bool32 g, bool32 h ) {
+        lane8b_t result;
+        result.simd = _mm256_setr_epi32(
+            a ? -1 : 0, b ? -1 : 0, c ? -1 : 0, d ? -1 : 0,
+            e ? -1 : 0, f ? -1 : 0, g ? -1 : 0, h ? -1 : 0 );
+        return result;
+    }
+    lane8b_t lane8b_and( lane8b_t lhs, lane8b_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_and_si256( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8b_t lane8b_or( lane8b_t lhs, lane8b_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_or_si256( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8b_t lane8b_xor( lane8b_t lhs, lane8b_t rhs ) {
+        lane8b_t result;
+        result.simd = _mm256_xor_si256( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8b_t lane8b_not( lane8b_t x ) {
+        lane8b_t result;
+        result.simd = _mm256_xor_si256( x.simd, _mm256_set1_epi32( -1 ) );
+        return result;
+    }
+    bool32 lane8b_any( lane8b_t x ) {
+        return _mm256_movemask_ps( _mm256_castsi256_ps( x.simd ) ) != 0;
+    }
+    bool32 lane8b_all( lane8b_t x ) {
+        return _mm256_movemask_ps( _mm256_castsi256_ps( x.simd ) ) == 0xFF;
+    }
+    u32 lane8b_bitmask( lane8b_t x ) {
+        return (u32)_mm256_movemask_ps( _mm256_castsi256_ps( x.simd ) );
+    }
+
+#else // AVX2
+
+// NOTE(alicia): without AVX2, lane8i and lane8b are two four-wide halves
+
+    lane8i_t lane8i_set( i32 a, i32 b, i32 c, i32 d, i32 e, i32 f, i32 g, i32 h ) {
+        lane8i_t result;
+        result.low  = lane4i_set( a, b, c, d );
+        result.high = lane4i_set( e, f, g, h );
+        return result;
+    }
+    lane8i_t lane8i_set_scalar( i32 scalar ) {
+        lane8i_t result;
+        result.low  = lane4i_set_scalar( scalar );
+        result.high = result.low;
+        return result;
+    }
+    lane8i_t lane8i_set_zero() {
+        lane8i_t result;
+        result.low  = lane4i_set_zero();
+        result.high = result.low;
+        return result;
+    }
+    lane8i_t lane8i_combine( lane4i_t low, lane4i_t high ) {
+        lane8i_t result;
+        result.low  = low;
+        result.high = high;
+        return result;
+    }
+    lane8i_t lane8i_load( const i32* load_array ) {
+        lane8i_t result;
+        result.low  = lane4i_load( load_array );
+        result.high = lane4i_load( load_array + 4 );
+        return result;
+    }
+    void lane8i_store( lane8i_t registers, i32* store_array ) {
+        lane4i_store( registers.low, store_array );
+        lane4i_store( registers.high, store_array + 4 );
+    }
+    lane4i_t lane8i_extract_high( lane8i_t x ) {
+        return x.high;
+    }
+    lane4i_t lane8i_extract_low( lane8i_t x ) {
+        return x.low;
+    }
+    lane8i_t lane8i_add( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_add( lhs.low, rhs.low );
+        result.high = lane4i_add( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_sub( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_sub( lhs.low, rhs.low );
+        result.high = lane4i_sub( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_mul( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_mul( lhs.low, rhs.low );
+        result.high = lane4i_mul( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_min( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_min( lhs.low, rhs.low );
+        result.high = lane4i_min( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_max( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_max( lhs.low, rhs.low );
+        result.high = lane4i_max( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_and( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_and( lhs.low, rhs.low );
+        result.high = lane4i_and( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_or( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_or( lhs.low, rhs.low );
+        result.high = lane4i_or( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_xor( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_xor( lhs.low, rhs.low );
+        result.high = lane4i_xor( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_andnot( lane8i_t lhs, lane8i_t rhs ) {
+        lane8i_t result;
+        result.low  = lane4i_andnot( lhs.low, rhs.low );
+        result.high = lane4i_andnot( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_abs( lane8i_t x ) {
+        lane8i_t result;
+        result.low  = lane4i_abs( x.low );
+        result.high = lane4i_abs( x.high );
+        return result;
+    }
+    lane8i_t lane8i_not( lane8i_t x ) {
+        lane8i_t result;
+        result.low  = lane4i_not( x.low );
+        result.high = lane4i_not( x.high );
+        return result;
+    }
+    lane8i_t lane8i_shift_left( lane8i_t x, u32 count ) {
+        lane8i_t result;
+        result.low  = lane4i_shift_left( x.low, count );
+        result.high = lane4i_shift_left( x.high, count );
+        return result;
+    }
+    lane8i_t lane8i_shift_right( lane8i_t x, u32 count ) {
+        lane8i_t result;
+        result.low  = lane4i_shift_right( x.low, count );
+        result.high = lane4i_shift_right( x.high, count );
+        return result;
+    }
+    lane8i_t lane8i_shift_right_logical( lane8i_t x, u32 count ) {
+        lane8i_t result;
+        result.low  = lane4i_shift_right_logical( x.low, count );
+        result.high = lane4i_shift_right_logical( x.high, count );
+        return result;
+    }
+    lane8b_t lane8i_cmp_eq( lane8i_t lhs, lane8i_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4i_cmp_eq( lhs.low, rhs.low );
+        result.high = lane4i_cmp_eq( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8i_cmp_gt( lane8i_t lhs, lane8i_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4i_cmp_gt( lhs.low, rhs.low );
+        result.high = lane4i_cmp_gt( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8i_cmp_lt( lane8i_t lhs, lane8i_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4i_cmp_lt( lhs.low, rhs.low );
+        result.high = lane4i_cmp_lt( lhs.high, rhs.high );
+        return result;
+    }
+    lane8i_t lane8i_select( lane8b_t mask, lane8i_t if_true, lane8i_t if_false ) {
+        lane8i_t result;
+        result.low  = lane4i_select( mask.low, if_true.low, if_false.low );
+        result.high = lane4i_select( mask.high, if_true.high, if_false.high );
+        return result;
+    }
+    lane8f_t lane8i_to_lane8f( lane8i_t x ) {
+        lane8f_t result;
+        result.low  = lane4i_to_lane4f( x.low );
+        result.high = lane4i_to_lane4f( x.high );
+        return result;
+    }
+    lane8f_t lane8i_as_lane8f( lane8i_t x ) {
+        lane8f_t result;
+        result.low  = lane4i_as_lane4f( x.low );
+        result.high = lane4i_as_lane4f( x.high );
+        return result;
+    }
+    lane8b_t lane8f_cmp_eq( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4f_cmp_eq( lhs.low, rhs.low );
+        result.high = lane4f_cmp_eq( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8f_cmp_neq( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4f_cmp_neq( lhs.low, rhs.low );
+        result.high = lane4f_cmp_neq( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8f_cmp_lt( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4f_cmp_lt( lhs.low, rhs.low );
+        result.high = lane4f_cmp_lt( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8f_cmp_le( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4f_cmp_le( lhs.low, rhs.low );
+        result.high = lane4f_cmp_le( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8f_cmp_gt( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4f_cmp_gt( lhs.low, rhs.low );
+        result.high = lane4f_cmp_gt( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8f_cmp_ge( lane8f_t lhs, lane8f_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4f_cmp_ge( lhs.low, rhs.low );
+        result.high = lane4f_cmp_ge( lhs.high, rhs.high );
+        return result;
+    }
+    lane8f_t lane8f_select( lane8b_t mask, lane8f_t if_true, lane8f_t if_false ) {
+        lane8f_t result;
+        result.low  = lane4f_select( mask.low, if_true.low, if_false.low );
+        result.high = lane4f_select( mask.high, if_true.high, if_false.high );
+        return result;
+    }
+    lane8f_t lane8f_min( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.low  = lane4f_min( lhs.low, rhs.low );
+        result.high = lane4f_min( lhs.high, rhs.high );
+        return result;
+    }
+    lane8f_t lane8f_max( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.low  = lane4f_max( lhs.low, rhs.low );
+        result.high = lane4f_max( lhs.high, rhs.high );
+        return result;
+    }
+    lane8f_t lane8f_abs( lane8f_t x ) {
+        lane8f_t result;
+        result.low  = lane4f_abs( x.low );
+        result.high = lane4f_abs( x.high );
+        return result;
+    }
+    lane8f_t lane8f_floor( lane8f_t x ) {
+        lane8f_t result;
+        result.low  = lane4f_floor( x.low );
+        result.high = lane4f_floor( x.high );
+        return result;
+    }
+    lane8f_t lane8f_ceil( lane8f_t x ) {
+        lane8f_t result;
+        result.low  = lane4f_ceil( x.low );
+        result.high = lane4f_ceil( x.high );
+        return result;
+    }
+    lane8f_t lane8f_round( lane8f_t x ) {
+        lane8f_t result;
+        result.low  = lane4f_round( x.low );
+        result.high = lane4f_round( x.high );
+        return result;
+    }
+    lane8i_t lane8f_to_lane8i( lane8f_t x ) {
+        lane8i_t result;
+        result.low  = lane4f_to_lane4i( x.low );
+        result.high = lane4f_to_lane4i( x.high );
+        return result;
+    }
+    lane8i_t lane8f_as_lane8i( lane8f_t x ) {
+        lane8i_t result;
+        result.low  = lane4f_as_lane4i( x.low );
+        result.high = lane4f_as_lane4i( x.high );
+        return result;
+    }
+    lane8b_t lane8b_set( bool32 a, bool32 b, bool32 c, bool32 d, bool32 e, bool32 f, bool32 g, bool32 h ) {
+        lane8b_t result;
+        result.low  = lane4b_set( a, b, c, d );
+        result.high = lane4b_set( e, f, g, h );
+        return result;
+    }
+    lane8b_t lane8b_and( lane8b_t lhs, lane8b_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4b_and( lhs.low, rhs.low );
+        result.high = lane4b_and( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8b_or( lane8b_t lhs, lane8b_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4b_or( lhs.low, rhs.low );
+        result.high = lane4b_or( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8b_xor( lane8b_t lhs, lane8b_t rhs ) {
+        lane8b_t result;
+        result.low  = lane4b_xor( lhs.low, rhs.low );
+        result.high = lane4b_xor( lhs.high, rhs.high );
+        return result;
+    }
+    lane8b_t lane8b_not( lane8b_t x ) {
+        lane8b_t result;
+        result.low  = lane4b_not( x.low );
+        result.high = lane4b_not( x.high );
+        return result;
+    }
+    bool32 lane8b_any( lane8b_t x ) {
+        return lane4b_any( lane4b_or( x.low, x.high ) );
+    }
+    bool32 lane8b_all( lane8b_t x ) {
+        return lane4b_all( lane4b_and( x.low, x.high ) );
+    }
+    u32 lane8b_bitmask( lane8b_t x ) {
+        return lane4b_bitmask( x.low ) | (lane4b_bitmask( x.high ) << 4);
+    }
+
+#endif // no AVX2
+
+// memory operations
+#if SMUSHY_SIMD_WIDTH == 1
+
+lane4f_t lane4f_load_aligned( const f32* load_array ) {
+    return lane4f_load( load_array );
+}
+lane4f_t lane4f_load_unaligned( const f32* load_array ) {
+    return lane4f_load( load_array );
+}
+lane4f_t lane4f_load_partial( const f32* load_array, usize count ) {
+    lane4f_t result = lane4f_set_zero();
+    for( usize i = 0; i < count && i < 4; ++i ) {
+        result.value[i] = load_array[i];
+    }
+    return result;
+}
+void lane4f_store_aligned( lane4f_t registers, f32* store_array ) {
+    lane4f_store( registers, store_array );
+}
+void lane4f_store_unaligned( lane4f_t registers, f32* store_array ) {
+    lane4f_store( registers, store_array );
+}
+void lane4f_store_partial( lane4f_t registers, f32* store_array, usize count ) {
+    for( usize i = 0; i < count && i < 4; ++i ) {
+        store_array[i] = registers.value[i];
+    }
+}
+void lane4f_stream_store( lane4f_t registers, f32* store_array ) {
+    lane4f_store( registers, store_array );
+}
+lane4i_t lane4i_load_unaligned( const i32* load_array ) {
+    return lane4i_load( load_array );
+}
+void lane4i_store_unaligned( lane4i_t registers, i32* store_array ) {
+    lane4i_store( registers, store_array );
+}
+void smsimd_stream_fence() {}
+
+#endif // scalar memory operations
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
+
+    lane4f_t lane4f_load_aligned( const f32* load_array ) {
+        lane4f_t result;
+        result.simd = _mm_load_ps( load_array );
+        return result;
+    }
+    lane4f_t lane4f_load_unaligned( const f32* load_array ) {
+        lane4f_t result;
+        result.simd = _mm_loadu_ps( load_array );
+        return result;
+    }
+    lane4f_t lane4f_load_partial( const f32* load_array, usize count ) {
+        lane4f_t result;
+        switch( count ) {
+            case 0:
+                result.simd = _mm_setzero_ps();
+                break;
+            case 1:
+                result.simd = _mm_load_ss( load_array );
+                break;
+            case 2:
+                result.simd = _mm_castpd_ps( _mm_load_sd( (const double*)load_array ) );
+                break;
+            case 3:
+                result.simd = _mm_movelh_ps(
+                    _mm_castpd_ps( _mm_load_sd( (const double*)load_array ) ),
+                    _mm_load_ss( load_array + 2 ) );
+                break;
+            default:
+                result.simd = _mm_loadu_ps( load_array );
+                break;
+        }
+        return result;
+    }
+    void lane4f_store_aligned( lane4f_t registers, f32* store_array ) {
+        _mm_store_ps( store_array, registers.simd );
+    }
+    void lane4f_store_unaligned( lane4f_t registers, f32* store_array ) {
+        _mm_storeu_ps( store_array, registers.simd );
+    }
+    void lane4f_store_partial( lane4f_t registers, f32* store_array, usize count ) {
+        switch( count ) {
+            case 0:
+                break;
+            case 1:
+                _mm_store_ss( store_array, registers.simd );
+                break;
+            case 2:
+                _mm_store_sd( (double*)store_array, _mm_castps_pd( registers.simd ) );
+                break;
+            case 3:
+                _mm_store_sd( (double*)store_array, _mm_castps_pd( registers.simd ) );
+                _mm_store_ss( store_array + 2, _mm_movehl_ps( registers.simd, registers.simd ) );
+                break;
+            default:
+                _mm_storeu_ps( store_array, registers.simd );
+                break;
+        }
+    }
+    void lane4f_stream_store( lane4f_t registers, f32* store_array ) {
+        _mm_stream_ps( store_array, registers.simd );
+    }
+    lane4i_t lane4i_load_unaligned( const i32* load_array ) {
+        lane4i_t result;
+        result.simd = _mm_loadu_si128( (const __m128i*)load_array );
+        return result;
+    }
+    void lane4i_store_unaligned( lane4i_t registers, i32* store_array ) {
+        _mm_storeu_si128( (__m128i*)store_array, registers.simd );
+    }
+    void smsimd_stream_fence() {
+        _mm_sfence();
+    }
+
+#endif // SSE memory operations
+
+#if defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+
+    // NOTE(alicia): NEON loads and stores have no alignment requirement
+    lane4f_t lane4f_load_aligned( const f32* load_array ) {
+        return lane4f_load( load_array );
+    }
+    lane4f_t lane4f_load_unaligned( const f32* load_array ) {
+        return lane4f_load( load_array );
+    }
+    lane4f_t lane4f_load_partial( const f32* load_array, usize count ) {
+        if( count >= 4 ) {
+            return lane4f_load( load_array );
+        }
+        lane4f_t result;
+        result.simd = vdupq_n_f32( 0.0f );
+        switch( count ) {
+            case 3: result.simd = vld1q_lane_f32( load_array + 2, result.simd, 2 ); // fallthrough
+            case 2: result.simd = vld1q_lane_f32( load_array + 1, result.simd, 1 ); // fallthrough
+            case 1: result.simd = vld1q_lane_f32( load_array + 0, result.simd, 0 ); // fallthrough
+            default: break;
+        }
+        return result;
+    }
+    void lane4f_store_aligned( lane4f_t registers, f32* store_array ) {
+        lane4f_store( registers, store_array );
+    }
+    void lane4f_store_unaligned( lane4f_t registers, f32* store_array ) {
+        lane4f_store( registers, store_array );
+    }
+    void lane4f_store_partial( lane4f_t registers, f32* store_array, usize count ) {
+        if( count >= 4 ) {
+            lane4f_store( registers, store_array );
+            return;
+        }
+        switch( count ) {
+            case 3: vst1q_lane_f32( store_array + 2, registers.simd, 2 ); // fallthrough
+            case 2: vst1q_lane_f32( store_array + 1, registers.simd, 1 ); // fallthrough
+            case 1: vst1q_lane_f32( store_array + 0, registers.simd, 0 ); // fallthrough
+            default: break;
+        }
+    }
+    // NOTE(alicia): NEON intrinsics don't expose non-temporal stores, plain store
+    void lane4f_stream_store( lane4f_t registers, f32* store_array ) {
+        lane4f_store( registers, store_array );
+    }
+    lane4i_t lane4i_load_unaligned( const i32* load_array ) {
+        return lane4i_load( load_array );
+    }
+    void lane4i_store_unaligned( lane4i_t registers, i32* store_array ) {
+        lane4i_store( registers, store_array );
+    }
+    void smsimd_stream_fence() {}
+
+#endif // NEON memory operations
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+
+    // NOTE(alicia): mask with the first count components set
+    static inline __m256i smsimd_lane8_count_mask( usize count ) {
+        i32 clamped = count > 8 ? 8 : (i32)count;
+        return _mm256_cmpgt_epi32( _mm256_set1_epi32( clamped ),
+            _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) );
+    }
+
+    lane8f_t lane8f_load_aligned( const f32* load_array ) {
+        lane8f_t result;
+        result.simd = _mm256_load_ps( load_array );
+        return result;
+    }
+    lane8f_t lane8f_load_unaligned( const f32* load_array ) {
+        lane8f_t result;
+        result.simd = _mm256_loadu_ps( load_array );
+        return result;
+    }
+    lane8f_t lane8f_load_partial( const f32* load_array, usize count ) {
+        lane8f_t result;
+        result.simd = _mm256_maskload_ps( load_array, smsimd_lane8_count_mask( count ) );
+        return result;
+    }
+    void lane8f_store_aligned( lane8f_t registers, f32* store_array ) {
+        _mm256_store_ps( store_array, registers.simd );
+    }
+    void lane8f_store_unaligned( lane8f_t registers, f32* store_array ) {
+        _mm256_storeu_ps( store_array, registers.simd );
+    }
+    void lane8f_store_partial( lane8f_t registers, f32* store_array, usize count ) {
+        _mm256_maskstore_ps( store_array, smsimd_lane8_count_mask( count ), registers.simd );
+    }
+    void lane8f_stream_store( lane8f_t registers, f32* store_array ) {
+        _mm256_stream_ps( store_array, registers.simd );
+    }
+    lane8i_t lane8i_load_unaligned( const i32* load_array ) {
+        lane8i_t result;
+        result.simd = _mm256_loadu_si256( (const __m256i*)load_array );
+        return result;
+    }
+    void lane8i_store_unaligned( lane8i_t registers, i32* store_array ) {
+        _mm256_storeu_si256( (__m256i*)store_array, registers.simd );
+    }
+
+#else // AVX2 memory operations
+
+    lane8f_t lane8f_load_aligned( const f32* load_array ) {
+        lane8f_t result;
+        result.low  = lane4f_load_aligned( load_array );
+        result.high = lane4f_load_aligned( load_array + 4 );
+        return result;
+    }
+    lane8f_t lane8f_load_unaligned( const f32* load_array ) {
+        lane8f_t result;
+        result.low  = lane4f_load_unaligned( load_array );
+        result.high = lane4f_load_unaligned( load_array + 4 );
+        return result;
+    }
+    lane8f_t lane8f_load_partial( const f32* load_array, usize count ) {
+        lane8f_t result;
+        result.low  = lane4f_load_partial( load_array, count );
+        result.high = lane4f_load_partial( load_array + 4, count > 4 ? count - 4 : 0 );
+        return result;
+    }
+    void lane8f_store_aligned( lane8f_t registers, f32* store_array ) {
+        lane4f_store_aligned( registers.low, store_array );
+        lane4f_store_aligned( registers.high, store_array + 4 );
+    }
+    void lane8f_store_unaligned( lane8f_t registers, f32* store_array ) {
+        lane4f_store_unaligned( registers.low, store_array );
+        lane4f_store_unaligned( registers.high, store_array + 4 );
+    }
+    void lane8f_store_partial( lane8f_t registers, f32* store_array, usize count ) {
+        lane4f_store_partial( registers.low, store_array, count );
+        lane4f_store_partial( registers.high, store_array + 4, count > 4 ? count - 4 : 0 );
+    }
+    void lane8f_stream_store( lane8f_t registers, f32* store_array ) {
+        lane4f_stream_store( registers.low, store_array );
+        lane4f_stream_store( registers.high, store_array + 4 );
+    }
+    lane8i_t lane8i_load_unaligned( const i32* load_array ) {
+        lane8i_t result;
+        result.low  = lane4i_load_unaligned( load_array );
+        result.high = lane4i_load_unaligned( load_array + 4 );
+        return result;
+    }
+    void lane8i_store_unaligned( lane8i_t registers, i32* store_array ) {
+        lane4i_store_unaligned( registers.low, store_array );
+        lane4i_store_unaligned( registers.high, store_array + 4 );
+    }
+
+#endif // no AVX2 memory operations
+
+// fused multiply-add and horizontal reductions
+// NOTE(alicia): avx2 doesn't imply fma3, -mavx2 alone takes the mul + add path
+#if defined(SM_ARCH_X86) && defined(__FMA__)
+    #define SMSIMD_FMA
+#elif defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4 && defined(SM_ARCH_64_BIT)
+    #define SMSIMD_FMA
+#endif
+
+#if SMUSHY_SIMD_WIDTH == 1
+
+lane4f_t lane4f_fmadd( lane4f_t a, lane4f_t b, lane4f_t c ) {
+    return lane4f_add( lane4f_mul( a, b ), c );
+}
+lane4f_t lane4f_fmsub( lane4f_t a, lane4f_t b, lane4f_t c ) {
+    return lane4f_sub( lane4f_mul( a, b ), c );
+}
+lane4f_t lane4f_fnmadd( lane4f_t a, lane4f_t b, lane4f_t c ) {
+    return lane4f_sub( c, lane4f_mul( a, b ) );
+}
+f32 lane4f_hadd( lane4f_t x ) {
+    return (x.a + x.b) + (x.c + x.d);
+}
+f32 lane4f_hmin( lane4f_t x ) {
+    f32 low  = x.a < x.b ? x.a : x.b;
+    f32 high = x.c < x.d ? x.c : x.d;
+    return low < high ? low : high;
+}
+f32 lane4f_hmax( lane4f_t x ) {
+    f32 low  = x.a > x.b ? x.a : x.b;
+    f32 high = x.c > x.d ? x.c : x.d;
+    return low > high ? low : high;
+}
+
+#endif // scalar fma/reductions
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
+
+    lane4f_t lane4f_fmadd( lane4f_t a, lane4f_t b, lane4f_t c ) {
+        lane4f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = _mm_fmadd_ps( a.simd, b.simd, c.simd );
+    #else
+        result.simd = _mm_add_ps( _mm_mul_ps( a.simd, b.simd ), c.simd );
+    #endif
+        return result;
+    }
+    lane4f_t lane4f_fmsub( lane4f_t a, lane4f_t b, lane4f_t c ) {
+        lane4f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = _mm_fmsub_ps( a.simd, b.simd, c.simd );
+    #else
+        result.simd = _mm_sub_ps( _mm_mul_ps( a.simd, b.simd ), c.simd );
+    #endif
+        return result;
+    }
+    lane4f_t lane4f_fnmadd( lane4f_t a, lane4f_t b, lane4f_t c ) {
+        lane4f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = _mm_fnmadd_ps( a.simd, b.simd, c.simd );
+    #else
+        result.simd = _mm_sub_ps( c.simd, _mm_mul_ps( a.simd, b.simd ) );
+    #endif
+        return result;
+    }
+    // NOTE(alicia): fold high half onto low half, then odd onto even
+    f32 lane4f_hadd( lane4f_t x ) {
+        __m128 pairs = _mm_add_ps( x.simd, _mm_movehl_ps( x.simd, x.simd ) );
+        return _mm_cvtss_f32( _mm_add_ss( pairs, _mm_movehdup_ps( pairs ) ) );
+    }
+    f32 lane4f_hmin( lane4f_t x ) {
+        __m128 pairs = _mm_min_ps( x.simd, _mm_movehl_ps( x.simd, x.simd ) );
+        return _mm_cvtss_f32( _mm_min_ss( pairs, _mm_movehdup_ps( pairs ) ) );
+    }
+    f32 lane4f_hmax( lane4f_t x ) {
+        __m128 pairs = _mm_max_ps( x.simd, _mm_movehl_ps( x.simd, x.simd ) );
+        return _mm_cvtss_f32( _mm_max_ss( pairs, _mm_movehdup_ps( pairs ) ) );
+    }
+
+#endif // SSE fma/reductions
+
+#if defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+
+    lane4f_t lane4f_fmadd( lane4f_t a, lane4f_t b, lane4f_t c ) {
+        lane4f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = vfmaq_f32( c.simd, a.simd, b.simd );
+    #else
+        result.simd = vmlaq_f32( c.simd, a.simd, b.simd );
+    #endif
+        return result;
+    }
+    lane4f_t lane4f_fmsub( lane4f_t a, lane4f_t b, lane4f_t c ) {
+        lane4f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = vnegq_f32( vfmsq_f32( c.simd, a.simd, b.simd ) );
+    #else
+        result.simd = vsubq_f32( vmulq_f32( a.simd, b.simd ), c.simd );
+    #endif
+        return result;
+    }
+    lane4f_t lane4f_fnmadd( lane4f_t a, lane4f_t b, lane4f_t c ) {
+        lane4f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = vfmsq_f32( c.simd, a.simd, b.simd );
+    #else
+        result.simd = vmlsq_f32( c.simd, a.simd, b.simd );
+    #endif
+        return result;
+    }
+#if defined(SM_ARCH_64_BIT)
+    f32 lane4f_hadd( lane4f_t x ) {
+        return vaddvq_f32( x.simd );
+    }
+    f32 lane4f_hmin( lane4f_t x ) {
+        return vminvq_f32( x.simd );
+    }
+    f32 lane4f_hmax( lane4f_t x ) {
+        return vmaxvq_f32( x.simd );
+    }
+#else // 32-bit
+    f32 lane4f_hadd( lane4f_t x ) {
+        float32x2_t pairs = vadd_f32( vget_low_f32( x.simd ), vget_high_f32( x.simd ) );
+        return vget_lane_f32( vpadd_f32( pairs, pairs ), 0 );
+    }
+    f32 lane4f_hmin( lane4f_t x ) {
+        float32x2_t pairs = vmin_f32( vget_low_f32( x.simd ), vget_high_f32( x.simd ) );
+        return vget_lane_f32( vpmin_f32( pairs, pairs ), 0 );
+    }
+    f32 lane4f_hmax( lane4f_t x ) {
+        float32x2_t pairs = vmax_f32( vget_low_f32( x.simd ), vget_high_f32( x.simd ) );
+        return vget_lane_f32( vpmax_f32( pairs, pairs ), 0 );
+    }
+#endif // 32-bit
+
+#endif // NEON fma/reductions
+
+f32 lane4f_dot4( lane4f_t lhs, lane4f_t rhs ) {
+    return lane4f_hadd( lane4f_mul( lhs, rhs ) );
+}
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+
+    lane8f_t lane8f_fmadd( lane8f_t a, lane8f_t b, lane8f_t c ) {
+        lane8f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = _mm256_fmadd_ps( a.simd, b.simd, c.simd );
+    #else
+        result.simd = _mm256_add_ps( _mm256_mul_ps( a.simd, b.simd ), c.simd );
+    #endif
+        return result;
+    }
+    lane8f_t lane8f_fmsub( lane8f_t a, lane8f_t b, lane8f_t c ) {
+        lane8f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = _mm256_fmsub_ps( a.simd, b.simd, c.simd );
+    #else
+        result.simd = _mm256_sub_ps( _mm256_mul_ps( a.simd, b.simd ), c.simd );
+    #endif
+        return result;
+    }
+    lane8f_t lane8f_fnmadd( lane8f_t a, lane8f_t b, lane8f_t c ) {
+        lane8f_t result;
+    #if defined(SMSIMD_FMA)
+        result.simd = _mm256_fnmadd_ps( a.simd, b.simd, c.simd );
+    #else
+        result.simd = _mm256_sub_ps( c.simd, _mm256_mul_ps( a.simd, b.simd ) );
+    #endif
+        return result;
+    }
+    f32 lane8f_hadd( lane8f_t x ) {
+        return lane4f_hadd( lane4f_add( lane8f_extract_low( x ), lane8f_extract_high( x ) ) );
+    }
+    f32 lane8f_hmin( lane8f_t x ) {
+        return lane4f_hmin( lane4f_min( lane8f_extract_low( x ), lane8f_extract_high( x ) ) );
+    }
+    f32 lane8f_hmax( lane8f_t x ) {
+        return lane4f_hmax( lane4f_max( lane8f_extract_low( x ), lane8f_extract_high( x ) ) );
+    }
+
+#else // AVX2 fma/reductions
+
+    lane8f_t lane8f_fmadd( lane8f_t a, lane8f_t b, lane8f_t c ) {
+        lane8f_t result;
+        result.low  = lane4f_fmadd( a.low, b.low, c.low );
+        result.high = lane4f_fmadd( a.high, b.high, c.high );
+        return result;
+    }
+    lane8f_t lane8f_fmsub( lane8f_t a, lane8f_t b, lane8f_t c ) {
+        lane8f_t result;
+        result.low  = lane4f_fmsub( a.low, b.low, c.low );
+        result.high = lane4f_fmsub( a.high, b.high, c.high );
+        return result;
+    }
+    lane8f_t lane8f_fnmadd( lane8f_t a, lane8f_t b, lane8f_t c ) {
+        lane8f_t result;
+        result.low  = lane4f_fnmadd( a.low, b.low, c.low );
+        result.high = lane4f_fnmadd( a.high, b.high, c.high );
+        return result;
+    }
+    f32 lane8f_hadd( lane8f_t x ) {
+        return lane4f_hadd( lane4f_add( x.low, x.high ) );
+    }
+    f32 lane8f_hmin( lane8f_t x ) {
+        return lane4f_hmin( lane4f_min( x.low, x.high ) );
+    }
+    f32 lane8f_hmax( lane8f_t x ) {
+        return lane4f_hmax( lane4f_max( x.low, x.high ) );
+    }
+
+#endif // no AVX2 fma/reductions
+
+// permutes and transposes
+#if SMUSHY_SIMD_WIDTH == 1
+
+lane4f_t lane4f_unpacklo( lane4f_t lhs, lane4f_t rhs ) {
+    return lane4f_set( lhs.a, rhs.a, lhs.b, rhs.b );
+}
+lane4f_t lane4f_unpackhi( lane4f_t lhs, lane4f_t rhs ) {
+    return lane4f_set( lhs.c, rhs.c, lhs.d, rhs.d );
+}
+void lane4f_transpose4x4( lane4f_t rows[4] ) {
+    for( u32 row = 0; row < 4; ++row ) {
+        for( u32 column = row + 1; column < 4; ++column ) {
+            f32 temp = rows[row].value[column];
+            rows[row].value[column] = rows[column].value[row];
+            rows[column].value[row] = temp;
+        }
+    }
+}
+
+#endif // scalar permutes
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4
+
+    lane4f_t lane4f_unpacklo( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = _mm_unpacklo_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane4f_t lane4f_unpackhi( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+        result.simd = _mm_unpackhi_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    void lane4f_transpose4x4( lane4f_t rows[4] ) {
+        __m128 t0 = _mm_unpacklo_ps( rows[0].simd, rows[1].simd );
+        __m128 t1 = _mm_unpacklo_ps( rows[2].simd, rows[3].simd );
+        __m128 t2 = _mm_unpackhi_ps( rows[0].simd, rows[1].simd );
+        __m128 t3 = _mm_unpackhi_ps( rows[2].simd, rows[3].simd );
+        rows[0].simd = _mm_movelh_ps( t0, t1 );
+        rows[1].simd = _mm_movehl_ps( t1, t0 );
+        rows[2].simd = _mm_movelh_ps( t2, t3 );
+        rows[3].simd = _mm_movehl_ps( t3, t2 );
+    }
+
+#endif // SSE permutes
+
+#if defined(SM_ARCH_ARM) && SMUSHY_SIMD_WIDTH == 4
+
+    lane4f_t lane4f_unpacklo( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+    #if defined(SM_ARCH_64_BIT)
+        result.simd = vzip1q_f32( lhs.simd, rhs.simd );
+    #else
+        result.simd = vzipq_f32( lhs.simd, rhs.simd ).val[0];
+    #endif
+        return result;
+    }
+    lane4f_t lane4f_unpackhi( lane4f_t lhs, lane4f_t rhs ) {
+        lane4f_t result;
+    #if defined(SM_ARCH_64_BIT)
+        result.simd = vzip2q_f32( lhs.simd, rhs.simd );
+    #else
+        result.simd = vzipq_f32( lhs.simd, rhs.simd ).val[1];
+    #endif
+        return result;
+    }
+    void lane4f_transpose4x4( lane4f_t rows[4] ) {
+        // NOTE(alicia): transpose 2x2 blocks, then swap the off-diagonal halves
+        float32x4x2_t t01 = vtrnq_f32( rows[0].simd, rows[1].simd );
+        float32x4x2_t t23 = vtrnq_f32( rows[2].simd, rows[3].simd );
+        rows[0].simd = vcombine_f32( vget_low_f32( t01.val[0] ), vget_low_f32( t23.val[0] ) );
+        rows[1].simd = vcombine_f32( vget_low_f32( t01.val[1] ), vget_low_f32( t23.val[1] ) );
+        rows[2].simd = vcombine_f32( vget_high_f32( t01.val[0] ), vget_high_f32( t23.val[0] ) );
+        rows[3].simd = vcombine_f32( vget_high_f32( t01.val[1] ), vget_high_f32( t23.val[1] ) );
+    }
+
+#endif // NEON permutes
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+
+    lane8f_t lane8f_unpacklo( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.simd = _mm256_unpacklo_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    lane8f_t lane8f_unpackhi( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.simd = _mm256_unpackhi_ps( lhs.simd, rhs.simd );
+        return result;
+    }
+    void lane8f_transpose8x8( lane8f_t rows[8] ) {
+        __m256 t0 = _mm256_unpacklo_ps( rows[0].simd, rows[1].simd );
+        __m256 t1 = _mm256_unpackhi_ps( rows[0].simd, rows[1].simd );
+        __m256 t2 = _mm256_unpacklo_ps( rows[2].simd, rows[3].simd );
+        __m256 t3 = _mm256_unpackhi_ps( rows[2].simd, rows[3].simd );
+        __m256 t4 = _mm256_unpacklo_ps( rows[4].simd, rows[5].simd );
+        __m256 t5 = _mm256_unpackhi_ps( rows[4].simd, rows[5].simd );
+        __m256 t6 = _mm256_unpacklo_ps( rows[6].simd, rows[7].simd );
+        __m256 t7 = _mm256_unpackhi_ps( rows[6].simd, rows[7].simd );
+
+        __m256 s0 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 s1 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        __m256 s2 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 s3 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        __m256 s4 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 s5 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        __m256 s6 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 s7 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+        rows[0].simd = _mm256_permute2f128_ps( s0, s4, 0x20 );
+        rows[1].simd = _mm256_permute2f128_ps( s1, s5, 0x20 );
+        rows[2].simd = _mm256_permute2f128_ps( s2, s6, 0x20 );
+        rows[3].simd = _mm256_permute2f128_ps( s3, s7, 0x20 );
+        rows[4].simd = _mm256_permute2f128_ps( s0, s4, 0x31 );
+        rows[5].simd = _mm256_permute2f128_ps( s1, s5, 0x31 );
+        rows[6].simd = _mm256_permute2f128_ps( s2, s6, 0x31 );
+        rows[7].simd = _mm256_permute2f128_ps( s3, s7, 0x31 );
+    }
+
+#else // AVX2 permutes
+
+    lane8f_t lane8f_unpacklo( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.low  = lane4f_unpacklo( lhs.low, rhs.low );
+        result.high = lane4f_unpacklo( lhs.high, rhs.high );
+        return result;
+    }
+    lane8f_t lane8f_unpackhi( lane8f_t lhs, lane8f_t rhs ) {
+        lane8f_t result;
+        result.low  = lane4f_unpackhi( lhs.low, rhs.low );
+        result.high = lane4f_unpackhi( lhs.high, rhs.high );
+        return result;
+    }
+    // NOTE(alicia): transpose each 4x4 block, then swap the off-diagonal blocks
+    void lane8f_transpose8x8( lane8f_t rows[8] ) {
+        lane4f_t top_left[4], top_right[4], bottom_left[4], bottom_right[4];
+        for( u32 i = 0; i < 4; ++i ) {
+            top_left[i]     = rows[i].low;
+            top_right[i]    = rows[i].high;
+            bottom_left[i]  = rows[i + 4].low;
+            bottom_right[i] = rows[i + 4].high;
+        }
+        lane4f_transpose4x4( top_left );
+        lane4f_transpose4x4( top_right );
+        lane4f_transpose4x4( bottom_left );
+        lane4f_transpose4x4( bottom_right );
+        for( u32 i = 0; i < 4; ++i ) {
+            rows[i].low      = top_left[i];
+            rows[i].high     = bottom_left[i];
+            rows[i + 4].low  = top_right[i];
+            rows[i + 4].high = bottom_right[i];
+        }
+    }
+
+#endif // no AVX2 permutes
+
+// gather and scatter
+// NOTE(alicia): offsets are computed in 32 bits, indices * stride must fit in an i32
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH >= 4 && defined(__AVX2__)
+
+    lane4f_t lane4f_gather( const f32* base, lane4i_t indices, u32 stride ) {
+        lane4f_t result;
+        __m128i offsets = _mm_mullo_epi32( indices.simd, _mm_set1_epi32( (int)stride ) );
+        result.simd = _mm_i32gather_ps( base, offsets, 4 );
+        return result;
+    }
+    lane4i_t lane4i_gather( const i32* base, lane4i_t indices, u32 stride ) {
+        lane4i_t result;
+        __m128i offsets = _mm_mullo_epi32( indices.simd, _mm_set1_epi32( (int)stride ) );
+        result.simd = _mm_i32gather_epi32( (const int*)base, offsets, 4 );
+        return result;
+    }
+
+#else // AVX2 gather
+
+// NOTE(alicia): emulated, spill indices and load one component at a time
+lane4f_t lane4f_gather( const f32* base, lane4i_t indices, u32 stride ) {
+    i32 offsets[4];
+    lane4i_store_unaligned( lane4i_mul( indices, lane4i_set_scalar( (i32)stride ) ), offsets );
+    return lane4f_set(
+        base[offsets[0]], base[offsets[1]],
+        base[offsets[2]], base[offsets[3]] );
+}
+lane4i_t lane4i_gather( const i32* base, lane4i_t indices, u32 stride ) {
+    i32 offsets[4];
+    lane4i_store_unaligned( lane4i_mul( indices, lane4i_set_scalar( (i32)stride ) ), offsets );
+    return lane4i_set(
+        base[offsets[0]], base[offsets[1]],
+        base[offsets[2]], base[offsets[3]] );
+}
+
+#endif // emulated gather
+
+// NOTE(alicia): no scatter instruction below AVX-512, always emulated
+void lane4f_scatter( f32* base, lane4i_t indices, u32 stride, lane4f_t values ) {
+    i32 offsets[4];
+    f32 components[4];
+    lane4i_store_unaligned( lane4i_mul( indices, lane4i_set_scalar( (i32)stride ) ), offsets );
+    lane4f_store_unaligned( values, components );
+    for( u32 i = 0; i < 4; ++i ) {
+        base[offsets[i]] = components[i];
+    }
+}
+void lane4i_scatter( i32* base, lane4i_t indices, u32 stride, lane4i_t values ) {
+    i32 offsets[4];
+    i32 components[4];
+    lane4i_store_unaligned( lane4i_mul( indices, lane4i_set_scalar( (i32)stride ) ), offsets );
+    lane4i_store_unaligned( values, components );
+    for( u32 i = 0; i < 4; ++i ) {
+        base[offsets[i]] = components[i];
+    }
+}
+
+#if defined(SM_ARCH_X86) && SMUSHY_SIMD_WIDTH == 8
+
+    lane8f_t lane8f_gather( const f32* base, lane8i_t indices, u32 stride ) {
+        lane8f_t result;
+        __m256i offsets = _mm256_mullo_epi32( indices.simd, _mm256_set1_epi32( (int)stride ) );
+        result.simd = _mm256_i32gather_ps( base, offsets, 4 );
+        return result;
+    }
+    lane8i_t lane8i_gather( const i32* base, lane8i_t indices, u32 stride ) {
+        lane8i_t result;
+        __m256i offsets = _mm256_mullo_epi32( indices.simd, _mm256_set1_epi32( (int)stride ) );
+        result.simd = _mm256_i32gather_epi32( (const int*)base, offsets, 4 );
+        return result;
+    }
+
+#else // AVX2 gather
+
+    lane8f_t lane8f_gather( const f32* base, lane8i_t indices, u32 stride ) {
+        lane8f_t result;
+        result.low  = lane4f_gather( base, indices.low, stride );
+        result.high = lane4f_gather( base, indices.high, stride );
+        return result;
+    }
+    lane8i_t lane8i_gather( const i32* base, lane8i_t indices, u32 stride ) {
+        lane8i_t result;
+        result.low  = lane4i_gather( base, indices.low, stride );
+        result.high = lane4i_gather( base, indices.high, stride );
+        return result;
+    }
+
+#endif // no AVX2 gather
+
+void lane8f_scatter( f32* base, lane8i_t indices, u32 stride, lane8f_t values ) {
+    lane4f_scatter( base, lane8i_extract_low( indices ), stride, lane8f_extract_low( values ) );
+    lane4f_scatter( base, lane8i_extract_high( indices ), stride, lane8f_extract_high( values ) );
+}
+void lane8i_scatter( i32* base, lane8i_t indices, u32 stride, lane8i_t values ) {
+    lane4i_scatter( base, lane8i_extract_low( indices ), stride, lane8i_extract_low( values ) );
+    lane4i_scatter( base, lane8i_extract_high( indices ), stride, lane8i_extract_high( values ) );
+}
+
+// transcendental functions
+
+// NOTE(alicia): cephes style polynomial approximations,
+// written against the lane API so every backend gets them
+
+    void lane4f_sincos( lane4f_t x, lane4f_t* out_sin, lane4f_t* out_cos ) {
+        lane4i_t sign_bit = lane4i_set_scalar( (i32)0x80000000 );
+        lane4i_t sign_sin = lane4i_and( lane4f_as_lane4i( x ), sign_bit );
+        x = lane4f_abs( x );
+
+        // NOTE(alicia): octant, rounded up to even
+        lane4i_t j = lane4f_to_lane4i( lane4f_mul( x, lane4f_set_scalar( 1.27323954473516f ) ) );
+        j = lane4i_and( lane4i_add( j, lane4i_set_scalar( 1 ) ), lane4i_set_scalar( ~1 ) );
+        lane4f_t y = lane4i_to_lane4f( j );
+
+        lane4b_t use_sin_poly = lane4i_cmp_eq(
+            lane4i_and( j, lane4i_set_scalar( 2 ) ), lane4i_set_zero() );
+        sign_sin = lane4i_xor( sign_sin,
+            lane4i_shift_left( lane4i_and( j, lane4i_set_scalar( 4 ) ), 29 ) );
+        lane4i_t sign_cos = lane4i_shift_left( lane4i_andnot(
+            lane4i_set_scalar( 4 ), lane4i_sub( j, lane4i_set_scalar( 2 ) ) ), 29 );
+
+        // NOTE(alicia): extended precision x - y * pi/4
+        x = lane4f_fnmadd( y, lane4f_set_scalar( 0.78515625f ), x );
+        x = lane4f_fnmadd( y, lane4f_set_scalar( 2.4187564849853515625e-4f ), x );
+        x = lane4f_fnmadd( y, lane4f_set_scalar( 3.77489497744594108e-8f ), x );
+
+        lane4f_t z = lane4f_mul( x, x );
+
+        lane4f_t cos_poly = lane4f_set_scalar( 2.443315711809948e-5f );
+        cos_poly = lane4f_fmadd( cos_poly, z, lane4f_set_scalar( -1.388731625493765e-3f ) );
+        cos_poly = lane4f_fmadd( cos_poly, z, lane4f_set_scalar( 4.166664568298827e-2f ) );
+        cos_poly = lane4f_mul( cos_poly, lane4f_mul( z, z ) );
+        cos_poly = lane4f_fnmadd( z, lane4f_set_scalar( 0.5f ), cos_poly );
+        cos_poly = lane4f_add( cos_poly, lane4f_set_scalar( 1.0f ) );
+
+        lane4f_t sin_poly = lane4f_set_scalar( -1.9515295891e-4f );
+        sin_poly = lane4f_fmadd( sin_poly, z, lane4f_set_scalar( 8.3321608736e-3f ) );
+        sin_poly = lane4f_fmadd( sin_poly, z, lane4f_set_scalar( -1.6666654611e-1f ) );
+        sin_poly = lane4f_add( lane4f_mul( lane4f_mul( sin_poly, z ), x ), x );
+
+        lane4f_t sin_result = lane4f_select( use_sin_poly, sin_poly, cos_poly );
+        lane4f_t cos_result = lane4f_select( use_sin_poly, cos_poly, sin_poly );
+
+        *out_sin = lane4i_as_lane4f( lane4i_xor( lane4f_as_lane4i( sin_result ), sign_sin ) );
+        *out_cos = lane4i_as_lane4f( lane4i_xor( lane4f_as_lane4i( cos_result ), sign_cos ) );
+    }
+    lane4f_t lane4f_sin( lane4f_t x ) {
+        lane4f_t sin_result, cos_result;
+        lane4f_sincos( x, &sin_result, &cos_result );
+        return sin_result;
+    }
+    lane4f_t lane4f_cos( lane4f_t x ) {
+        lane4f_t sin_result, cos_result;
+        lane4f_sincos( x, &sin_result, &cos_result );
+        return cos_result;
+    }
+    lane4f_t lane4f_exp( lane4f_t x ) {
+        lane4b_t is_nan = lane4f_cmp_neq( x, x );
+        lane4f_t input  = x;
+        x = lane4f_min( x, lane4f_set_scalar( 88.3762626647949f ) );
+        x = lane4f_max( x, lane4f_set_scalar( -87.3365478515625f ) );
+
+        // NOTE(alicia): exp(x) = 2^n * exp(r), r = x - n * ln2
+        lane4f_t n = lane4f_floor( lane4f_add(
+            lane4f_mul( x, lane4f_set_scalar( 1.44269504088896341f ) ), lane4f_set_scalar( 0.5f ) ) );
+        x = lane4f_fnmadd( n, lane4f_set_scalar( 0.693359375f ), x );
+        x = lane4f_fnmadd( n, lane4f_set_scalar( -2.12194440e-4f ), x );
+
+        lane4f_t z = lane4f_mul( x, x );
+        lane4f_t poly = lane4f_set_scalar( 1.9875691500e-4f );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 1.3981999507e-3f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 8.3334519073e-3f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 4.1665795894e-2f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 1.6666665459e-1f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 5.0000001201e-1f ) );
+        poly = lane4f_add( lane4f_add( lane4f_mul( poly, z ), x ), lane4f_set_scalar( 1.0f ) );
+
+        // NOTE(alicia): build 2^n directly in the exponent bits
+        lane4i_t exponent = lane4i_shift_left( lane4i_add(
+            lane4f_to_lane4i( n ), lane4i_set_scalar( 127 ) ), 23 );
+        lane4f_t result = lane4f_mul( poly, lane4i_as_lane4f( exponent ) );
+        return lane4f_select( is_nan, input, result );
+    }
+    lane4f_t lane4f_log( lane4f_t x ) {
+        lane4f_t zero    = lane4f_set_zero();
+        lane4b_t is_zero = lane4f_cmp_eq( x, zero );
+        // NOTE(alicia): negative and NaN inputs give NaN
+        lane4b_t is_invalid = lane4b_not( lane4f_cmp_ge( x, zero ) );
+        lane4f_t infinity = lane4i_as_lane4f( lane4i_set_scalar( 0x7F800000 ) );
+        lane4b_t is_inf   = lane4f_cmp_eq( x, infinity );
+
+        // NOTE(alicia): denormals are flushed to the smallest normal
+        x = lane4f_max( x, lane4f_set_scalar( 1.17549435e-38f ) );
+        lane4i_t bits = lane4f_as_lane4i( x );
+        lane4f_t e = lane4i_to_lane4f( lane4i_sub(
+            lane4i_shift_right_logical( bits, 23 ), lane4i_set_scalar( 126 ) ) );
+
+        // NOTE(alicia): mantissa in [0.5, 1)
+        bits = lane4i_or( lane4i_and( bits, lane4i_set_scalar( 0x807FFFFF ) ),
+            lane4i_set_scalar( 0x3F000000 ) );
+        x = lane4i_as_lane4f( bits );
+
+        // NOTE(alicia): keep mantissa in [sqrt(0.5), sqrt(2)) so the series converges faster
+        lane4b_t below_sqrt_half = lane4f_cmp_lt( x, lane4f_set_scalar( 0.707106781186547524f ) );
+        lane4f_t one = lane4f_set_scalar( 1.0f );
+        e = lane4f_sub( e, lane4f_select( below_sqrt_half, one, zero ) );
+        x = lane4f_sub( lane4f_add( x, lane4f_select( below_sqrt_half, x, zero ) ), one );
+
+        lane4f_t z = lane4f_mul( x, x );
+        lane4f_t poly = lane4f_set_scalar( 7.0376836292e-2f );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( -1.1514610310e-1f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 1.1676998740e-1f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( -1.2420140846e-1f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 1.4249322787e-1f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( -1.6668057665e-1f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 2.0000714765e-1f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( -2.4999993993e-1f ) );
+        poly = lane4f_fmadd( poly, x, lane4f_set_scalar( 3.3333331174e-1f ) );
+        poly = lane4f_mul( lane4f_mul( poly, x ), z );
+
+        poly = lane4f_add( poly, lane4f_mul( e, lane4f_set_scalar( -2.12194440e-4f ) ) );
+        poly = lane4f_fnmadd( z, lane4f_set_scalar( 0.5f ), poly );
+        lane4f_t result = lane4f_add( x, poly );
+        result = lane4f_add( result, lane4f_mul( e, lane4f_set_scalar( 0.693359375f ) ) );
+
+        result = lane4f_select( is_inf, infinity, result );
+        result = lane4f_select( is_zero, lane4f_sub( zero, infinity ), result );
+        return lane4f_select( is_invalid, lane4i_as_lane4f( lane4i_set_scalar( 0x7FC00000 ) ), result );
+    }
+    lane4f_t lane4f_pow( lane4f_t base, lane4f_t exponent ) {
+        lane4f_t zero = lane4f_set_zero();
+        lane4f_t result = lane4f_exp( lane4f_mul( exponent, lane4f_log( base ) ) );
+        // NOTE(alicia): x^0 is 1 for any x, 0^y is 0 for y > 0
+        lane4b_t base_zero = lane4b_and(
+            lane4f_cmp_eq( base, zero ), lane4f_cmp_gt( exponent, zero ) );
+        result = lane4f_select( base_zero, zero, result );
+        return lane4f_select( lane4f_cmp_eq( exponent, zero ), lane4f_set_scalar( 1.0f ), result );
+    }
+    lane4f_t lane4f_atan2( lane4f_t y, lane4f_t x ) {
+        lane4f_t zero = lane4f_set_zero();
+        lane4i_t sign_bit = lane4i_set_scalar( (i32)0x80000000 );
+
+        lane4f_t ratio = lane4f_div( y, x );
+        lane4i_t sign  = lane4i_and( lane4f_as_lane4i( ratio ), sign_bit );
+        lane4f_t t     = lane4f_abs( ratio );
+
+        // NOTE(alicia): reduce to |t| <= tan(pi/8)
+        lane4b_t above_3pi8 = lane4f_cmp_gt( t, lane4f_set_scalar( 2.414213562373095f ) );
+        lane4b_t above_pi8  = lane4b_and( lane4b_not( above_3pi8 ),
+            lane4f_cmp_gt( t, lane4f_set_scalar( 0.4142135623730950f ) ) );
+        lane4f_t one = lane4f_set_scalar( 1.0f );
+
+        lane4f_t offset = lane4f_select( above_3pi8, lane4f_set_scalar( 1.5707963267948966f ), zero );
+        offset = lane4f_select( above_pi8, lane4f_set_scalar( 0.7853981633974483f ), offset );
+
+        lane4f_t reduced_3pi8 = lane4f_div( lane4f_set_scalar( -1.0f ), t );
+        lane4f_t reduced_pi8  = lane4f_div( lane4f_sub( t, one ), lane4f_add( t, one ) );
+        t = lane4f_select( above_3pi8, reduced_3pi8, t );
+        t = lane4f_select( above_pi8, reduced_pi8, t );
+
+        lane4f_t z = lane4f_mul( t, t );
+        lane4f_t poly = lane4f_set_scalar( 8.05374449538e-2f );
+        poly = lane4f_fmadd( poly, z, lane4f_set_scalar( -1.38776856032e-1f ) );
+        poly = lane4f_fmadd( poly, z, lane4f_set_scalar( 1.99777106478e-1f ) );
+        poly = lane4f_fmadd( poly, z, lane4f_set_scalar( -3.33329491539e-1f ) );
+        poly = lane4f_add( lane4f_mul( lane4f_mul( poly, z ), t ), t );
+
+        lane4f_t result = lane4i_as_lane4f( lane4i_xor(
+            lane4f_as_lane4i( lane4f_add( poly, offset ) ), sign ) );
+
+        // NOTE(alicia): move to the left half-plane when the sign bit of x is set,
+        // the half turn copies the sign bit of y so signed zeros follow libm,
+        // atan2(-0, -1) is -pi and atan2(y, -0) is +-pi/2.
+        // selected rather than added so atan2(-0, 1) stays -0
+        lane4b_t x_signed  = lane4i_cmp_lt( lane4f_as_lane4i( x ), lane4i_set_scalar( 0 ) );
+        lane4f_t half_turn = lane4i_as_lane4f( lane4i_or(
+            lane4f_as_lane4i( lane4f_set_scalar( 3.14159265358979323846f ) ),
+            lane4i_and( lane4f_as_lane4i( y ), sign_bit ) ) );
+        result = lane4f_select( x_signed, lane4f_add( result, half_turn ), result );
+
+        // NOTE(alicia): atan2(+-0, +0) gives +-0 and atan2(+-0, -0) gives +-pi instead of NaN
+        lane4b_t both_zero = lane4b_and( lane4f_cmp_eq( x, zero ), lane4f_cmp_eq( y, zero ) );
+        return lane4f_select( both_zero, lane4f_select( x_signed, half_turn, y ), result );
+    }
+    lane4f_t lane4f_acos( lane4f_t x ) {
+        lane4f_t one  = lane4f_set_scalar( 1.0f );
+        lane4f_t half = lane4f_set_scalar( 0.5f );
+        x = lane4f_min( lane4f_max( x, lane4f_set_scalar( -1.0f ) ), one );
+        lane4f_t t = lane4f_abs( x );
+
+        // NOTE(alicia): asin(t) for t <= 0.5,
+        // otherwise asin(sqrt((1 - t) / 2)) which is half of acos(t)
+        lane4b_t above_half = lane4f_cmp_gt( t, half );
+        lane4f_t z = lane4f_select( above_half,
+            lane4f_mul( lane4f_sub( one, t ), half ), lane4f_mul( t, t ) );
+        t = lane4f_select( above_half, lane4f_sqrt( z ), t );
+
+        lane4f_t poly = lane4f_set_scalar( 4.2163199048e-2f );
+        poly = lane4f_fmadd( poly, z, lane4f_set_scalar( 2.4181311049e-2f ) );
+        poly = lane4f_fmadd( poly, z, lane4f_set_scalar( 4.5470025998e-2f ) );
+        poly = lane4f_fmadd( poly, z, lane4f_set_scalar( 7.4953002686e-2f ) );
+        poly = lane4f_fmadd( poly, z, lane4f_set_scalar( 1.6666752422e-1f ) );
+        poly = lane4f_fmadd( lane4f_mul( poly, z ), t, t );
+
+        // NOTE(alicia): x > 0.5 gives 2 * asin, x < -0.5 gives pi - 2 * asin,
+        // otherwise pi/2 - asin(x)
+        lane4f_t sign_x = lane4i_as_lane4f( lane4i_and(
+            lane4f_as_lane4i( x ), lane4i_set_scalar( (i32)0x80000000 ) ) );
+        lane4f_t signed_poly = lane4i_as_lane4f( lane4i_xor(
+            lane4f_as_lane4i( poly ), lane4f_as_lane4i( sign_x ) ) );
+
+        lane4f_t pi = lane4f_set_scalar( 3.14159265358979323846f );
+        lane4f_t large = lane4f_add( signed_poly, signed_poly );
+        large = lane4f_select( lane4f_cmp_lt( x, lane4f_set_zero() ), lane4f_add( pi, large ), large );
+        lane4f_t small = lane4f_sub( lane4f_set_scalar( 1.5707963267948966f ), signed_poly );
+        return lane4f_select( above_half, large, small );
+    }
+
+
+    void lane8f_sincos( lane8f_t x, lane8f_t* out_sin, lane8f_t* out_cos ) {
+        lane8i_t sign_bit = lane8i_set_scalar( (i32)0x80000000 );
+        lane8i_t sign_sin = lane8i_and( lane8f_as_lane8i( x ), sign_bit );
+        x = lane8f_abs( x );
+
+        // NOTE(alicia): octant, rounded up to even
+        lane8i_t j = lane8f_to_lane8i( lane8f_mul( x, lane8f_set_scalar( 1.27323954473516f ) ) );
+        j = lane8i_and( lane8i_add( j, lane8i_set_scalar( 1 ) ), lane8i_set_scalar( ~1 ) );
+        lane8f_t y = lane8i_to_lane8f( j );
+
+        lane8b_t use_sin_poly = lane8i_cmp_eq(
+            lane8i_and( j, lane8i_set_scalar( 2 ) ), lane8i_set_zero() );
+        sign_sin = lane8i_xor( sign_sin,
+            lane8i_shift_left( lane8i_and( j, lane8i_set_scalar( 4 ) ), 29 ) );
+        lane8i_t sign_cos = lane8i_shift_left( lane8i_andnot(
+            lane8i_set_scalar( 4 ), lane8i_sub( j, lane8i_set_scalar( 2 ) ) ), 29 );
+
+        // NOTE(alicia): extended precision x - y * pi/4
+        x = lane8f_fnmadd( y, lane8f_set_scalar( 0.78515625f ), x );
+        x = lane8f_fnmadd( y, lane8f_set_scalar( 2.4187564849853515625e-4f ), x );
+        x = lane8f_fnmadd( y, lane8f_set_scalar( 3.77489497744594108e-8f ), x );
+
+        lane8f_t z = lane8f_mul( x, x );
+
+        lane8f_t cos_poly = lane8f_set_scalar( 2.443315711809948e-5f );
+        cos_poly = lane8f_fmadd( cos_poly, z, lane8f_set_scalar( -1.388731625493765e-3f ) );
+        cos_poly = lane8f_fmadd( cos_poly, z, lane8f_set_scalar( 4.166664568298827e-2f ) );
+        cos_poly = lane8f_mul( cos_poly, lane8f_mul( z, z ) );
+        cos_poly = lane8f_fnmadd( z, lane8f_set_scalar( 0.5f ), cos_poly );
+        cos_poly = lane8f_add( cos_poly, lane8f_set_scalar( 1.0f ) );
+
+        lane8f_t sin_poly = lane8f_set_scalar( -1.9515295891e-4f );
+        sin_poly = lane8f_fmadd( sin_poly, z, lane8f_set_scalar( 8.3321608736e-3f ) );
+        sin_poly = lane8f_fmadd( sin_poly, z, lane8f_set_scalar( -1.6666654611e-1f ) );
+        sin_poly = lane8f_add( lane8f_mul( lane8f_mul( sin_poly, z ), x ), x );
+
+        lane8f_t sin_result = lane8f_select( use_sin_poly, sin_poly, cos_poly );
+        lane8f_t cos_result = lane8f_select( use_sin_poly, cos_poly, sin_poly );
+
+        *out_sin = lane8i_as_lane8f( lane8i_xor( lane8f_as_lane8i( sin_result ), sign_sin ) );
+        *out_cos = lane8i_as_lane8f( lane8i_xor( lane8f_as_lane8i( cos_result ), sign_cos ) );
+    }
+    lane8f_t lane8f_sin( lane8f_t x ) {
+        lane8f_t sin_result, cos_result;
+        lane8f_sincos( x, &sin_result, &cos_result );
+        return sin_result;
+    }
+    lane8f_t lane8f_cos( lane8f_t x ) {
+        lane8f_t sin_result, cos_result;
+        lane8f_sincos( x, &sin_result, &cos_result );
+        return cos_result;
+    }
+    lane8f_t lane8f_exp( lane8f_t x ) {
+        lane8b_t is_nan = lane8f_cmp_neq( x, x );
+        lane8f_t input  = x;
+        x = lane8f_min( x, lane8f_set_scalar( 88.3762626647949f ) );
+        x = lane8f_max( x, lane8f_set_scalar( -87.3365478515625f ) );
+
+        // NOTE(alicia): exp(x) = 2^n * exp(r), r = x - n * ln2
+        lane8f_t n = lane8f_floor( lane8f_add(
+            lane8f_mul( x, lane8f_set_scalar( 1.44269504088896341f ) ), lane8f_set_scalar( 0.5f ) ) );
+        x = lane8f_fnmadd( n, lane8f_set_scalar( 0.693359375f ), x );
+        x = lane8f_fnmadd( n, lane8f_set_scalar( -2.12194440e-4f ), x );
+
+        lane8f_t z = lane8f_mul( x, x );
+        lane8f_t poly = lane8f_set_scalar( 1.9875691500e-4f );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 1.3981999507e-3f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 8.3334519073e-3f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 4.1665795894e-2f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 1.6666665459e-1f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 5.0000001201e-1f ) );
+        poly = lane8f_add( lane8f_add( lane8f_mul( poly, z ), x ), lane8f_set_scalar( 1.0f ) );
+
+        // NOTE(alicia): build 2^n directly in the exponent bits
+        lane8i_t exponent = lane8i_shift_left( lane8i_add(
+            lane8f_to_lane8i( n ), lane8i_set_scalar( 127 ) ), 23 );
+        lane8f_t result = lane8f_mul( poly, lane8i_as_lane8f( exponent ) );
+        return lane8f_select( is_nan, input, result );
+    }
+    lane8f_t lane8f_log( lane8f_t x ) {
+        lane8f_t zero    = lane8f_set_zero();
+        lane8b_t is_zero = lane8f_cmp_eq( x, zero );
+        // NOTE(alicia): negative and NaN inputs give NaN
+        lane8b_t is_invalid = lane8b_not( lane8f_cmp_ge( x, zero ) );
+        lane8f_t infinity = lane8i_as_lane8f( lane8i_set_scalar( 0x7F800000 ) );
+        lane8b_t is_inf   = lane8f_cmp_eq( x, infinity );
+
+        // NOTE(alicia): denormals are flushed to the smallest normal
+        x = lane8f_max( x, lane8f_set_scalar( 1.17549435e-38f ) );
+        lane8i_t bits = lane8f_as_lane8i( x );
+        lane8f_t e = lane8i_to_lane8f( lane8i_sub(
+            lane8i_shift_right_logical( bits, 23 ), lane8i_set_scalar( 126 ) ) );
+
+        // NOTE(alicia): mantissa in [0.5, 1)
+        bits = lane8i_or( lane8i_and( bits, lane8i_set_scalar( 0x807FFFFF ) ),
+            lane8i_set_scalar( 0x3F000000 ) );
+        x = lane8i_as_lane8f( bits );
+
+        // NOTE(alicia): keep mantissa in [sqrt(0.5), sqrt(2)) so the series converges faster
+        lane8b_t below_sqrt_half = lane8f_cmp_lt( x, lane8f_set_scalar( 0.707106781186547524f ) );
+        lane8f_t one = lane8f_set_scalar( 1.0f );
+        e = lane8f_sub( e, lane8f_select( below_sqrt_half, one, zero ) );
+        x = lane8f_sub( lane8f_add( x, lane8f_select( below_sqrt_half, x, zero ) ), one );
+
+        lane8f_t z = lane8f_mul( x, x );
+        lane8f_t poly = lane8f_set_scalar( 7.0376836292e-2f );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( -1.1514610310e-1f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 1.1676998740e-1f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( -1.2420140846e-1f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 1.4249322787e-1f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( -1.6668057665e-1f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 2.0000714765e-1f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( -2.4999993993e-1f ) );
+        poly = lane8f_fmadd( poly, x, lane8f_set_scalar( 3.3333331174e-1f ) );
+        poly = lane8f_mul( lane8f_mul( poly, x ), z );
+
+        poly = lane8f_add( poly, lane8f_mul( e, lane8f_set_scalar( -2.12194440e-4f ) ) );
+        poly = lane8f_fnmadd( z, lane8f_set_scalar( 0.5f ), poly );
+        lane8f_t result = lane8f_add( x, poly );
+        result = lane8f_add( result, lane8f_mul( e, lane8f_set_scalar( 0.693359375f ) ) );
+
+        result = lane8f_select( is_inf, infinity, result );
+        result = lane8f_select( is_zero, lane8f_sub( zero, infinity ), result );
+        return lane8f_select( is_invalid, lane8i_as_lane8f( lane8i_set_scalar( 0x7FC00000 ) ), result );
+    }
+    lane8f_t lane8f_pow( lane8f_t base, lane8f_t exponent ) {
+        lane8f_t zero = lane8f_set_zero();
+        lane8f_t result = lane8f_exp( lane8f_mul( exponent, lane8f_log( base ) ) );
+        // NOTE(alicia): x^0 is 1 for any x, 0^y is 0 for y > 0
+        lane8b_t base_zero = lane8b_and(
+            lane8f_cmp_eq( base, zero ), lane8f_cmp_gt( exponent, zero ) );
+        result = lane8f_select( base_zero, zero, result );
+        return lane8f_select( lane8f_cmp_eq( exponent, zero ), lane8f_set_scalar( 1.0f ), result );
+    }
+    lane8f_t lane8f_atan2( lane8f_t y, lane8f_t x ) {
+        lane8f_t zero = lane8f_set_zero();
+        lane8i_t sign_bit = lane8i_set_scalar( (i32)0x80000000 );
+
+        lane8f_t ratio = lane8f_div( y, x );
+        lane8i_t sign  = lane8i_and( lane8f_as_lane8i( ratio ), sign_bit );
+        lane8f_t t     = lane8f_abs( ratio );
+
+        // NOTE(alicia): reduce to |t| <= tan(pi/8)
+        lane8b_t above_3pi8 = lane8f_cmp_gt( t, lane8f_set_scalar( 2.414213562373095f ) );
+        lane8b_t above_pi8  = lane8b_and( lane8b_not( above_3pi8 ),
+            lane8f_cmp_gt( t, lane8f_set_scalar( 0.4142135623730950f ) ) );
+        lane8f_t one = lane8f_set_scalar( 1.0f );
+
+        lane8f_t offset = lane8f_select( above_3pi8, lane8f_set_scalar( 1.5707963267948966f ), zero );
+        offset = lane8f_select( above_pi8, lane8f_set_scalar( 0.7853981633974483f ), offset );
+
+        lane8f_t reduced_3pi8 = lane8f_div( lane8f_set_scalar( -1.0f ), t );
+        lane8f_t reduced_pi8  = lane8f_div( lane8f_sub( t, one ), lane8f_add( t, one ) );
+        t = lane8f_select( above_3pi8, reduced_3pi8, t );
+        t = lane8f_select( above_pi8, reduced_pi8, t );
+
+        lane8f_t z = lane8f_mul( t, t );
+        lane8f_t poly = lane8f_set_scalar( 8.05374449538e-2f );
+        poly = lane8f_fmadd( poly, z, lane8f_set_scalar( -1.38776856032e-1f ) );
+        poly = lane8f_fmadd( poly, z, lane8f_set_scalar( 1.99777106478e-1f ) );
+        poly = lane8f_fmadd( poly, z, lane8f_set_scalar( -3.33329491539e-1f ) );
+        poly = lane8f_add( lane8f_mul( lane8f_mul( poly, z ), t ), t );
+
+        lane8f_t result = lane8i_as_lane8f( lane8i_xor(
+            lane8f_as_lane8i( lane8f_add( poly, offset ) ), sign ) );
+
+        // NOTE(alicia): move to the left half-plane when the sign bit of x is set,
+        // the half turn copies the sign bit of y so signed zeros follow libm,
+        // atan2(-0, -1) is -pi and atan2(y, -0) is +-pi/2.
+        // selected rather than added so atan2(-0, 1) stays -0
+        lane8b_t x_signed  = lane8i_cmp_lt( lane8f_as_lane8i( x ), lane8i_set_scalar( 0 ) );
+        lane8f_t half_turn = lane8i_as_lane8f( lane8i_or(
+            lane8f_as_lane8i( lane8f_set_scalar( 3.14159265358979323846f ) ),
+            lane8i_and( lane8f_as_lane8i( y ), sign_bit ) ) );
+        result = lane8f_select( x_signed, lane8f_add( result, half_turn ), result );
+
+        // NOTE(alicia): atan2(+-0, +0) gives +-0 and atan2(+-0, -0) gives +-pi instead of NaN
+        lane8b_t both_zero = lane8b_and( lane8f_cmp_eq( x, zero ), lane8f_cmp_eq( y, zero ) );
+        return lane8f_select( both_zero, lane8f_select( x_signed, half_turn, y ), result );
+    }
+    lane8f_t lane8f_acos( lane8f_t x ) {
+        lane8f_t one  = lane8f_set_scalar( 1.0f );
+        lane8f_t half = lane8f_set_scalar( 0.5f );
+        x = lane8f_min( lane8f_max( x, lane8f_set_scalar( -1.0f ) ), one );
+        lane8f_t t = lane8f_abs( x );
+
+        // NOTE(alicia): asin(t) for t <= 0.5,
+        // otherwise asin(sqrt((1 - t) / 2)) which is half of acos(t)
+        lane8b_t above_half = lane8f_cmp_gt( t, half );
+        lane8f_t z = lane8f_select( above_half,
+            lane8f_mul( lane8f_sub( one, t ), half ), lane8f_mul( t, t ) );
+        t = lane8f_select( above_half, lane8f_sqrt( z ), t );
+
+        lane8f_t poly = lane8f_set_scalar( 4.2163199048e-2f );
+        poly = lane8f_fmadd( poly, z, lane8f_set_scalar( 2.4181311049e-2f ) );
+        poly = lane8f_fmadd( poly, z, lane8f_set_scalar( 4.5470025998e-2f ) );
+        poly = lane8f_fmadd( poly, z, lane8f_set_scalar( 7.4953002686e-2f ) );
+        poly = lane8f_fmadd( poly, z, lane8f_set_scalar( 1.6666752422e-1f ) );
+        poly = lane8f_fmadd( lane8f_mul( poly, z ), t, t );
+
+        // NOTE(alicia): x > 0.5 gives 2 * asin, x < -0.5 gives pi - 2 * asin,
+        // otherwise pi/2 - asin(x)
+        lane8f_t sign_x = lane8i_as_lane8f( lane8i_and(
+            lane8f_as_lane8i( x ), lane8i_set_scalar( (i32)0x80000000 ) ) );
+        lane8f_t signed_poly = lane8i_as_lane8f( lane8i_xor(
+            lane8f_as_lane8i( poly ), lane8f_as_lane8i( sign_x ) ) );
+
+        lane8f_t pi = lane8f_set_scalar( 3.14159265358979323846f );
+        lane8f_t large = lane8f_add( signed_poly, signed_poly );
+        large = lane8f_select( lane8f_cmp_lt( x, lane8f_set_zero() ), lane8f_add( pi, large ), large );
+        lane8f_t small = lane8f_sub( lane8f_set_scalar( 1.5707963267948966f ), signed_poly );
+        return lane8f_select( above_half, large, small );
+    }
+
+// end transcendental functions
+
+// C++ operator overloads
+#if defined(__cplusplus)
+
+    f32& lane4f_t::operator[](u32 index) { return this->value[index]; }
+    f32  lane4f_t::operator[](u32 index) const { return this->value[index]; }
+
+    lane4f_t& lane4f_t::operator+=( const lane4f_t& rhs ) {
+        *this = lane4f_add( *this, rhs );
+        return *this;
+    }
+
+    lane4f_t& lane4f_t::operator-=( const lane4f_t& rhs ) {
+        *this = lane4f_sub( *this, rhs );
+        return *this;
+    }
+
+    lane4f_t& lane4f_t::operator*=( const lane4f_t& rhs ) {
+        *this = lane4f_mul( *this, rhs );
+        return *this;
+    }
+
+    lane4f_t& lane4f_t::operator/=( const lane4f_t& rhs ) {
+        *this = lane4f_div( *this, rhs );
+        return *this;
+    }
+
+    lane4f_t operator+( const lane4f_t& lhs, const lane4f_t& rhs ) {
+        return lane4f_add( lhs, rhs );
+    }
+    lane4f_t operator-( const lane4f_t& lhs, const lane4f_t& rhs ) {
+        return lane4f_sub( lhs, rhs );
+    }
+    lane4f_t operator*( const lane4f_t& lhs, const lane4f_t& rhs ) {
+        return lane4f_mul( lhs, rhs );
+    }
+    lane4f_t operator/( const lane4f_t& lhs, const lane4f_t& rhs ) {
+        return lane4f_div( lhs, rhs );
+    }
+
+    f32& lane8f_t::operator[](u32 index) { return this->value[index]; }
+    f32  lane8f_t::operator[](u32 index) const { return this->value[index]; }
+
+    lane8f_t& lane8f_t::operator+=( const lane8f_t& rhs ) {
+        *this = lane8f_add( *this, rhs );
+        return *this;
+    }
+
+    lane8f_t& lane8f_t::operator-=( const lane8f_t& rhs ) {
+        *this = lane8f_sub( *this, rhs );
+        return *this;
+    }
+
+    lane8f_t& lane8f_t::operator*=( const lane8f_t& rhs ) {
+        *this = lane8f_mul( *this, rhs );
+        return *this;
+    }
+
+    lane8f_t& lane8f_t::operator/=( const lane8f_t& rhs ) {
+        *this = lane8f_div( *this, rhs );
+        return *this;
+    }
+
+    lane8f_t operator+( const lane8f_t& lhs, const lane8f_t& rhs ) {
+        return lane8f_add( lhs, rhs );
+    }
+    lane8f_t operator-( const lane8f_t& lhs, const lane8f_t& rhs ) {
+        return lane8f_sub( lhs, rhs );
+    }
+    lane8f_t operator*( const lane8f_t& lhs, const lane8f_t& rhs ) {
+        return lane8f_mul( lhs, rhs );
+    }
+    lane8f_t operator/( const lane8f_t& lhs, const lane8f_t& rhs ) {
+        return lane8f_div( lhs, rhs );
+    }
+
+    i32& lane4i_t::operator[](u32 index) { return this->value[index]; }
+    i32  lane4i_t::operator[](u32 index) const { return this->value[index]; }
+
+    lane4i_t& lane4i_t::operator+=( const lane4i_t& rhs ) {
+        *this = lane4i_add( *this, rhs );
+        return *this;
+    }
+
+    lane4i_t& lane4i_t::operator-=( const lane4i_t& rhs ) {
+        *this = lane4i_sub( *this, rhs );
+        return *this;
+    }
+
+    lane4i_t& lane4i_t::operator*=( const lane4i_t& rhs ) {
+        *this = lane4i_mul( *this, rhs );
+        return *this;
+    }
+
+    lane4i_t operator+( const lane4i_t& lhs, const lane4i_t& rhs ) {
+        return lane4i_add( lhs, rhs );
+    }
+    lane4i_t operator-( const lane4i_t& lhs, const lane4i_t& rhs ) {
+        return lane4i_sub( lhs, rhs );
+    }
+    lane4i_t operator*( const lane4i_t& lhs, const lane4i_t& rhs ) {
+        return lane4i_mul( lhs, rhs );
+    }
+
+    i32& lane8i_t::operator[](u32 index) { return this->value[index]; }
+    i32  lane8i_t::operator[](u32 index) const { return this->value[index]; }
+
+    lane8i_t& lane8i_t::operator+=( const lane8i_t& rhs ) {
+        *this = lane8i_add( *this, rhs );
+        return *this;
+    }
+
+    lane8i_t& lane8i_t::operator-=( const lane8i_t& rhs ) {
+        *this = lane8i_sub( *this, rhs );
+        return *this;
+    }
+
+    lane8i_t& lane8i_t::operator*=( const lane8i_t& rhs ) {
+        *this = lane8i_mul( *this, rhs );
+        return *this;
+    }
+
+    lane8i_t operator+( const lane8i_t& lhs, const lane8i_t& rhs ) {
+        return lane8i_add( lhs, rhs );
+    }
+    lane8i_t operator-( const lane8i_t& lhs, const lane8i_t& rhs ) {
+        return lane8i_sub( lhs, rhs );
+    }
+    lane8i_t operator*( const lane8i_t& lhs, const lane8i_t& rhs ) {
+        return lane8i_mul( lhs, rhs );
+    }
+
+#endif
+
+#if defined(__cplusplus)
+    } // namespace smath::simd
+    } // namespace smath
+#endif // c++
+
+#endif // SMUSHY_SIMD_LANES_IMPL